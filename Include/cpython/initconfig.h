@@ -122,6 +122,18 @@ typedef struct PyPreConfig {
     /* Memory allocator: PYTHONMALLOC env var.
        See PyMemAllocatorName for valid values. */
     int allocator;
+
+#ifdef Py_GIL_DISABLED
+    /* Bind the segments backing the per-thread mimalloc heaps to the NUMA
+       node of the allocating thread?
+
+       Set to 1 by "-X numa_heaps" and "-X numa_heaps=1" command line options
+       and by PYTHON_NUMA_HEAPS=1. Set to 0 by "-X numa_heaps=0" and
+       PYTHON_NUMA_HEAPS=0.
+
+       If equals to -1 (default), it is set to 0. */
+    int numa_heaps;
+#endif
 } PyPreConfig;
 
 PyAPI_FUNC(void) PyPreConfig_InitPythonConfig(PyPreConfig *config);
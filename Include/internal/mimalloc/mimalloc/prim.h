@@ -75,6 +75,10 @@ size_t _mi_prim_numa_node(void);
 // Return the number of logical NUMA nodes
 size_t _mi_prim_numa_node_count(void);
 
+// Set a preferred NUMA node for the pages in the given range that are
+// faulted in after this call. Returns error code or 0 on success.
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node);
+
 // Clock ticks
 mi_msecs_t _mi_prim_clock_now(void);
 
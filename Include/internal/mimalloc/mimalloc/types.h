@@ -469,6 +469,9 @@ typedef struct mi_segment_s {
   bool              allow_decommit;
   bool              allow_purge;
   size_t            segment_size;
+#ifdef Py_GIL_DISABLED
+  int               numa_node;          // NUMA node the segment was accounted to (or -1)
+#endif
 
   // segment fields
   mi_msecs_t        purge_expire;
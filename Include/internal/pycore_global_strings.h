@@ -241,6 +241,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_asyncio_future_blocking)
         STRUCT_FOR_ID(_blksize)
         STRUCT_FOR_ID(_bootstrap)
+        STRUCT_FOR_ID(_cancelled)
         STRUCT_FOR_ID(_check_retval_)
         STRUCT_FOR_ID(_dealloc_warn)
         STRUCT_FOR_ID(_feature_version)
@@ -265,6 +266,8 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_needs_com_addref_)
         STRUCT_FOR_ID(_only_immortal)
         STRUCT_FOR_ID(_restype_)
+        STRUCT_FOR_ID(_run)
+        STRUCT_FOR_ID(_scheduled)
         STRUCT_FOR_ID(_showwarnmsg)
         STRUCT_FOR_ID(_shutdown)
         STRUCT_FOR_ID(_slotnames)
@@ -275,10 +278,12 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_type_)
         STRUCT_FOR_ID(_uninitialized_submodules)
         STRUCT_FOR_ID(_warn_unawaited_coroutine)
+        STRUCT_FOR_ID(_when)
         STRUCT_FOR_ID(_xoptions)
         STRUCT_FOR_ID(abs_tol)
         STRUCT_FOR_ID(access)
         STRUCT_FOR_ID(aclose)
+        STRUCT_FOR_ID(adaptive)
         STRUCT_FOR_ID(add)
         STRUCT_FOR_ID(add_done_callback)
         STRUCT_FOR_ID(after_in_child)
@@ -313,6 +318,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(buffer)
         STRUCT_FOR_ID(buffer_callback)
         STRUCT_FOR_ID(buffer_size)
+        STRUCT_FOR_ID(buffer_threshold)
         STRUCT_FOR_ID(buffering)
         STRUCT_FOR_ID(buffers)
         STRUCT_FOR_ID(bufsize)
@@ -420,6 +426,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(end_lineno)
         STRUCT_FOR_ID(end_offset)
         STRUCT_FOR_ID(endpos)
+        STRUCT_FOR_ID(entries)
         STRUCT_FOR_ID(entrypoint)
         STRUCT_FOR_ID(env)
         STRUCT_FOR_ID(errors)
@@ -581,6 +588,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(maxvalue)
         STRUCT_FOR_ID(memLevel)
         STRUCT_FOR_ID(memlimit)
+        STRUCT_FOR_ID(memoize_strings)
         STRUCT_FOR_ID(message)
         STRUCT_FOR_ID(metaclass)
         STRUCT_FOR_ID(metadata)
@@ -655,10 +663,13 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(pi_factory)
         STRUCT_FOR_ID(pid)
         STRUCT_FOR_ID(policy)
+        STRUCT_FOR_ID(popleft)
         STRUCT_FOR_ID(pos)
         STRUCT_FOR_ID(pos1)
         STRUCT_FOR_ID(pos2)
         STRUCT_FOR_ID(posix)
+        STRUCT_FOR_ID(pread)
+        STRUCT_FOR_ID(preadv)
         STRUCT_FOR_ID(print_file_and_line)
         STRUCT_FOR_ID(priority)
         STRUCT_FOR_ID(progress)
@@ -667,6 +678,8 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(protocol)
         STRUCT_FOR_ID(ps1)
         STRUCT_FOR_ID(ps2)
+        STRUCT_FOR_ID(pwrite)
+        STRUCT_FOR_ID(pwritev)
         STRUCT_FOR_ID(query)
         STRUCT_FOR_ID(quotetabs)
         STRUCT_FOR_ID(raw)
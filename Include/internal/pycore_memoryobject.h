@@ -14,6 +14,10 @@ PyObject *
 _PyMemoryView_FromBufferProc(PyObject *v, int flags,
                              getbufferproc bufferproc);
 
+// Export for 'mmap' shared extension
+PyAPI_FUNC(PyObject *) _PyMemoryView_GetSlice(PyObject *mv, Py_ssize_t start,
+                                               Py_ssize_t stop);
+
 #ifdef __cplusplus
 }
 #endif
@@ -971,6 +971,10 @@ extern PyObject* _PyObject_NextNotImplemented(PyObject *);
 // Pickle support.
 // Export for '_datetime' shared extension
 PyAPI_FUNC(PyObject*) _PyObject_GetState(PyObject *);
+// Same as _PyObject_GetState(), but if required is true, the default
+// __getstate__() fails for objects which have C-level state it cannot save.
+// Export for '_pickle' shared extension
+PyAPI_FUNC(PyObject*) _PyObject_GetStateEx(PyObject *, int required);
 
 /* C function call trampolines to mitigate bad function pointer casts.
  *
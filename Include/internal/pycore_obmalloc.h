@@ -657,9 +657,26 @@ struct _obmalloc_usage {
 #endif /* WITH_PYMALLOC_RADIX_TREE */
 
 
+#ifdef Py_GIL_DISABLED
+/* Per-node accounting of mimalloc segments when PYTHON_NUMA_HEAPS is set.
+ * Nodes above the limit share the entry of (node % _Py_NUMA_MAX_NODES). */
+#define _Py_NUMA_MAX_NODES 64
+
+struct _obmalloc_numa_stats {
+    Py_ssize_t segments;            // segments currently allocated
+    Py_ssize_t bytes;               // size of the segments currently allocated
+    Py_ssize_t total_segments;      // segments allocated since startup
+    Py_ssize_t bind_failures;       // segments that could not be bound
+};
+#endif
+
 struct _obmalloc_global_state {
     int dump_debug_stats;
     Py_ssize_t interpreter_leaks;
+#ifdef Py_GIL_DISABLED
+    int numa_heaps;
+    struct _obmalloc_numa_stats numa_stats[_Py_NUMA_MAX_NODES];
+#endif
 };
 
 struct _obmalloc_state {
@@ -54,10 +54,18 @@ extern "C" {
 #  error "NB_SMALL_SIZE_CLASSES should be less than 64"
 #endif
 
-#define _obmalloc_global_state_INIT \
+#ifdef Py_GIL_DISABLED
+#  define _obmalloc_global_state_INIT \
     { \
         .dump_debug_stats = -1, \
+        .numa_heaps = 0, \
     }
+#else
+#  define _obmalloc_global_state_INIT \
+    { \
+        .dump_debug_stats = -1, \
+    }
+#endif
 
 
 #ifdef __cplusplus
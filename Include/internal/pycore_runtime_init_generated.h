@@ -748,6 +748,7 @@ extern "C" {
     INIT_ID(_asyncio_future_blocking), \
     INIT_ID(_blksize), \
     INIT_ID(_bootstrap), \
+    INIT_ID(_cancelled), \
     INIT_ID(_check_retval_), \
     INIT_ID(_dealloc_warn), \
     INIT_ID(_feature_version), \
@@ -772,6 +773,8 @@ extern "C" {
     INIT_ID(_needs_com_addref_), \
     INIT_ID(_only_immortal), \
     INIT_ID(_restype_), \
+    INIT_ID(_run), \
+    INIT_ID(_scheduled), \
     INIT_ID(_showwarnmsg), \
     INIT_ID(_shutdown), \
     INIT_ID(_slotnames), \
@@ -782,10 +785,12 @@ extern "C" {
     INIT_ID(_type_), \
     INIT_ID(_uninitialized_submodules), \
     INIT_ID(_warn_unawaited_coroutine), \
+    INIT_ID(_when), \
     INIT_ID(_xoptions), \
     INIT_ID(abs_tol), \
     INIT_ID(access), \
     INIT_ID(aclose), \
+    INIT_ID(adaptive), \
     INIT_ID(add), \
     INIT_ID(add_done_callback), \
     INIT_ID(after_in_child), \
@@ -820,6 +825,7 @@ extern "C" {
     INIT_ID(buffer), \
     INIT_ID(buffer_callback), \
     INIT_ID(buffer_size), \
+    INIT_ID(buffer_threshold), \
     INIT_ID(buffering), \
     INIT_ID(buffers), \
     INIT_ID(bufsize), \
@@ -927,6 +933,7 @@ extern "C" {
     INIT_ID(end_lineno), \
     INIT_ID(end_offset), \
     INIT_ID(endpos), \
+    INIT_ID(entries), \
     INIT_ID(entrypoint), \
     INIT_ID(env), \
     INIT_ID(errors), \
@@ -1088,6 +1095,7 @@ extern "C" {
     INIT_ID(maxvalue), \
     INIT_ID(memLevel), \
     INIT_ID(memlimit), \
+    INIT_ID(memoize_strings), \
     INIT_ID(message), \
     INIT_ID(metaclass), \
     INIT_ID(metadata), \
@@ -1162,10 +1170,13 @@ extern "C" {
     INIT_ID(pi_factory), \
     INIT_ID(pid), \
     INIT_ID(policy), \
+    INIT_ID(popleft), \
     INIT_ID(pos), \
     INIT_ID(pos1), \
     INIT_ID(pos2), \
     INIT_ID(posix), \
+    INIT_ID(pread), \
+    INIT_ID(preadv), \
     INIT_ID(print_file_and_line), \
     INIT_ID(priority), \
     INIT_ID(progress), \
@@ -1174,6 +1185,8 @@ extern "C" {
     INIT_ID(protocol), \
     INIT_ID(ps1), \
     INIT_ID(ps2), \
+    INIT_ID(pwrite), \
+    INIT_ID(pwritev), \
     INIT_ID(query), \
     INIT_ID(quotetabs), \
     INIT_ID(raw), \
@@ -27,6 +27,11 @@
 # when the device block size is available.
 DEFAULT_BUFFER_SIZE = 128 * 1024  # bytes
 
+# Bounds and growth rate of the buffer of an adaptive BufferedReader.
+_ADAPTIVE_MIN_BUFFER_SIZE = 8 * 1024
+_ADAPTIVE_MAX_BUFFER_SIZE = 1024 * 1024
+_ADAPTIVE_SEQUENTIAL_FILLS = 2
+
 # NOTE: Base classes defined here are registered with the "official" ABCs
 # defined in io.py. We don't use real inheritance though, because we don't want
 # to inherit the C implementations.
@@ -1010,16 +1015,18 @@ def seekable(self):
 
 class BufferedReader(_BufferedIOMixin):
 
-    """BufferedReader(raw[, buffer_size])
+    """BufferedReader(raw[, buffer_size], *, adaptive=False)
 
     A buffer for a readable, sequential BaseRawIO object.
 
     The constructor creates a BufferedReader for the given readable raw
     stream and buffer_size. If buffer_size is omitted, DEFAULT_BUFFER_SIZE
-    is used.
+    is used. If adaptive is true, the buffer grows while the stream is
+    read sequentially and shrinks when it is accessed randomly.
     """
 
-    def __init__(self, raw, buffer_size=DEFAULT_BUFFER_SIZE):
+    def __init__(self, raw, buffer_size=DEFAULT_BUFFER_SIZE, *,
+                 adaptive=False):
         """Create a new buffered reader using the given readable raw IO object.
         """
         if not raw.readable():
@@ -1028,9 +1035,29 @@ def __init__(self, raw, buffer_size=DEFAULT_BUFFER_SIZE):
         _BufferedIOMixin.__init__(self, raw)
         if buffer_size <= 0:
             raise ValueError("invalid buffer size")
-        self.buffer_size = buffer_size
+        self._buffer_size = buffer_size
         self._reset_read_buf()
         self._read_lock = Lock()
+        self._adaptive = adaptive
+        self._can_advise = (adaptive and isinstance(raw, FileIO)
+                            and hasattr(os, 'posix_fadvise'))
+        self._advised = False
+        self._sequential_fills = 0
+        self._initial_buffer_size = buffer_size
+        self._raw_reads = 0
+        self._bytes_copied = 0
+
+    @property
+    def buffer_size(self):
+        return self._buffer_size
+
+    @property
+    def raw_reads(self):
+        return self._raw_reads
+
+    @property
+    def bytes_copied(self):
+        return self._bytes_copied
 
     def readable(self):
         return self.raw.readable()
@@ -1039,6 +1066,33 @@ def _reset_read_buf(self):
         self._read_buf = b""
         self._read_pos = 0
 
+    def _advise(self, advice):
+        try:
+            os.posix_fadvise(self.raw.fileno(), 0, 0, advice)
+        except (OSError, ValueError):
+            pass
+
+    def _adapt_on_fill(self):
+        # Called in adaptive mode before the buffer is refilled.
+        self._sequential_fills += 1
+        if self._sequential_fills < _ADAPTIVE_SEQUENTIAL_FILLS:
+            return
+        self._sequential_fills = 0
+        if self._can_advise and not self._advised:
+            self._advise(os.POSIX_FADV_SEQUENTIAL)
+            self._advised = True
+        limit = max(self._initial_buffer_size, _ADAPTIVE_MAX_BUFFER_SIZE)
+        self._buffer_size = min(self._buffer_size * 2, limit)
+
+    def _adapt_on_seek(self):
+        # Called in adaptive mode after a seek which invalidated the buffer.
+        self._sequential_fills = 0
+        if self._advised:
+            self._advise(os.POSIX_FADV_NORMAL)
+            self._advised = False
+        floor = min(self._initial_buffer_size, _ADAPTIVE_MIN_BUFFER_SIZE)
+        self._buffer_size = max(self._buffer_size // 2, floor)
+
     def read(self, size=None):
         """Read size bytes.
 
@@ -1062,6 +1116,7 @@ def _read_unlocked(self, n=None):
         if n is None or n == -1:
             self._reset_read_buf()
             if hasattr(self.raw, 'readall'):
+                self._raw_reads += 1
                 chunk = self.raw.readall()
                 if chunk is None:
                     return buf[pos:] or None
@@ -1071,6 +1126,7 @@ def _read_unlocked(self, n=None):
             current_size = 0
             while True:
                 # Read until EOF or until read() would block.
+                self._raw_reads += 1
                 chunk = self.raw.read()
                 if chunk in empty_values:
                     nodata_val = chunk
@@ -1088,13 +1144,17 @@ def _read_unlocked(self, n=None):
         # Slow path: read from the stream until enough bytes are read,
         # or until an EOF occurs or until read() would block.
         chunks = [buf[pos:]]
-        wanted = max(self.buffer_size, n)
+        if self._adaptive:
+            self._adapt_on_fill()
+        wanted = max(self._buffer_size, n)
         while avail < n:
+            self._raw_reads += 1
             chunk = self.raw.read(wanted)
             if chunk in empty_values:
                 nodata_val = chunk
                 break
             avail += len(chunk)
+            self._bytes_copied += len(chunk)
             chunks.append(chunk)
         # n is more than avail only when an EOF occurred or when
         # read() would have blocked.
@@ -1116,12 +1176,16 @@ def peek(self, size=0):
             return self._peek_unlocked(size)
 
     def _peek_unlocked(self, n=0):
-        want = min(n, self.buffer_size)
+        want = min(n, self._buffer_size)
         have = len(self._read_buf) - self._read_pos
         if have < want or have <= 0:
-            to_read = self.buffer_size - have
+            if self._adaptive and have <= 0:
+                self._adapt_on_fill()
+            to_read = self._buffer_size - have
+            self._raw_reads += 1
             current = self.raw.read(to_read)
             if current:
+                self._bytes_copied += len(current)
                 self._read_buf = self._read_buf[self._read_pos:] + current
                 self._read_pos = 0
         return self._read_buf[self._read_pos:]
@@ -1132,7 +1196,7 @@ def read1(self, size=-1):
         # only return buffered bytes.  Otherwise, we do one raw read.
         self._checkClosed("read of closed file")
         if size < 0:
-            size = self.buffer_size
+            size = self._buffer_size
         if size == 0:
             return b""
         with self._read_lock:
@@ -1175,7 +1239,8 @@ def _readinto(self, buf, read1):
 
                 # If remaining space in callers buffer is larger than
                 # internal buffer, read directly into callers buffer
-                if len(buf) - written > self.buffer_size:
+                if len(buf) - written > self._buffer_size:
+                    self._raw_reads += 1
                     n = self.raw.readinto(buf[written:])
                     if not n:
                         break # eof
@@ -1206,8 +1271,27 @@ def seek(self, pos, whence=0):
                 pos -= len(self._read_buf) - self._read_pos
             pos = _BufferedIOMixin.seek(self, pos, whence)
             self._reset_read_buf()
+            if self._adaptive:
+                self._adapt_on_seek()
             return pos
 
+    def pread(self, size, offset):
+        """Read at most size bytes at offset from the raw stream.
+
+        The current position is neither used nor changed.
+        """
+        self._checkClosed("read of closed file")
+        return self.raw.pread(size, offset)
+
+    def preadv(self, buffers, offset):
+        """Read from the raw stream at offset into a sequence of writable
+        buffers.
+
+        The current position is neither used nor changed.
+        """
+        self._checkClosed("read of closed file")
+        return self.raw.preadv(buffers, offset)
+
 class BufferedWriter(_BufferedIOMixin):
 
     """A buffer for a writeable sequential RawIO object.
@@ -1224,10 +1308,14 @@ def __init__(self, raw, buffer_size=DEFAULT_BUFFER_SIZE):
         _BufferedIOMixin.__init__(self, raw)
         if buffer_size <= 0:
             raise ValueError("invalid buffer size")
-        self.buffer_size = buffer_size
+        self._buffer_size = buffer_size
         self._write_buf = bytearray()
         self._write_lock = Lock()
 
+    @property
+    def buffer_size(self):
+        return self._buffer_size
+
     def writable(self):
         return self.raw.writable()
 
@@ -1239,23 +1327,23 @@ def write(self, b):
                 raise ValueError("write to closed file")
             # XXX we can implement some more tricks to try and avoid
             # partial writes
-            if len(self._write_buf) > self.buffer_size:
+            if len(self._write_buf) > self._buffer_size:
                 # We're full, so let's pre-flush the buffer.  (This may
                 # raise BlockingIOError with characters_written == 0.)
                 self._flush_unlocked()
             before = len(self._write_buf)
             self._write_buf.extend(b)
             written = len(self._write_buf) - before
-            if len(self._write_buf) > self.buffer_size:
+            if len(self._write_buf) > self._buffer_size:
                 try:
                     self._flush_unlocked()
                 except BlockingIOError as e:
-                    if len(self._write_buf) > self.buffer_size:
+                    if len(self._write_buf) > self._buffer_size:
                         # We've hit the buffer_size. We have to accept a partial
                         # write and cut back our buffer.
-                        overage = len(self._write_buf) - self.buffer_size
+                        overage = len(self._write_buf) - self._buffer_size
                         written -= overage
-                        self._write_buf = self._write_buf[:self.buffer_size]
+                        self._write_buf = self._write_buf[:self._buffer_size]
                         raise BlockingIOError(e.errno, e.strerror, written)
             return written
 
@@ -1266,6 +1354,26 @@ def truncate(self, pos=None):
                 pos = self.raw.tell()
             return self.raw.truncate(pos)
 
+    def pwrite(self, b, offset):
+        """Write b to the raw stream at offset, return number written.
+
+        Pending writes are flushed first.  The current position is not
+        changed.
+        """
+        with self._write_lock:
+            self._flush_unlocked()
+            return self.raw.pwrite(b, offset)
+
+    def pwritev(self, buffers, offset):
+        """Write a sequence of buffers to the raw stream at offset.
+
+        Pending writes are flushed first.  The current position is not
+        changed.
+        """
+        with self._write_lock:
+            self._flush_unlocked()
+            return self.raw.pwritev(buffers, offset)
+
     def flush(self):
         with self._write_lock:
             self._flush_unlocked()
@@ -1452,12 +1560,33 @@ def readinto1(self, b):
         return BufferedReader.readinto1(self, b)
 
     def write(self, b):
+        self._undo_readahead()
+        return BufferedWriter.write(self, b)
+
+    def pread(self, size, offset):
+        self.flush()
+        return BufferedReader.pread(self, size, offset)
+
+    def preadv(self, buffers, offset):
+        self.flush()
+        return BufferedReader.preadv(self, buffers, offset)
+
+    def pwrite(self, b, offset):
+        n = BufferedWriter.pwrite(self, b, offset)
+        # The read buffer may hold overwritten data
+        self._undo_readahead()
+        return n
+
+    def pwritev(self, buffers, offset):
+        n = BufferedWriter.pwritev(self, buffers, offset)
+        self._undo_readahead()
+        return n
+
+    def _undo_readahead(self):
         if self._read_buf:
-            # Undo readahead
             with self._read_lock:
                 self.raw.seek(self._read_pos - len(self._read_buf), 1)
                 self._reset_read_buf()
-        return BufferedWriter.write(self, b)
 
 
 def _new_buffersize(bytes_read):
@@ -1739,6 +1868,71 @@ def write(self, b):
         except BlockingIOError:
             return None
 
+    if hasattr(os, 'pread'):
+        def pread(self, size, offset):
+            """Read at most size bytes at offset, returned as bytes.
+
+            The current file position is neither used nor changed, so several
+            threads can read from the same file object at once.  Return an
+            empty bytes object at EOF, or None in non-blocking mode if no data
+            is available.
+            """
+            self._checkClosed()
+            self._checkReadable()
+            if size < 0:
+                raise ValueError("negative size")
+            try:
+                return os.pread(self._fd, size, offset)
+            except BlockingIOError:
+                return None
+
+    if hasattr(os, 'pwrite'):
+        def pwrite(self, b, offset):
+            """Write bytes b to the file at offset, return number written.
+
+            The current file position is neither used nor changed.  Only
+            makes one system call, so not all of the data may be written.  In
+            non-blocking mode, returns None if the write would block.
+            """
+            self._checkClosed()
+            self._checkWritable()
+            try:
+                return os.pwrite(self._fd, b, offset)
+            except BlockingIOError:
+                return None
+
+    if hasattr(os, 'preadv'):
+        def preadv(self, buffers, offset):
+            """Read from the file at offset into a sequence of writable
+            buffers.
+
+            The current file position is neither used nor changed.  Return
+            the total number of bytes read, or None in non-blocking mode if no
+            data is available.
+            """
+            self._checkClosed()
+            self._checkReadable()
+            try:
+                return os.preadv(self._fd, buffers, offset)
+            except BlockingIOError:
+                return None
+
+    if hasattr(os, 'pwritev'):
+        def pwritev(self, buffers, offset):
+            """Write the contents of a sequence of buffers to the file at
+            offset.
+
+            The current file position is neither used nor changed.  Return
+            the total number of bytes written, or None in non-blocking mode if
+            the write would block.
+            """
+            self._checkClosed()
+            self._checkWritable()
+            try:
+                return os.pwritev(self._fd, buffers, offset)
+            except BlockingIOError:
+                return None
+
     def seek(self, pos, whence=SEEK_SET):
         """Move to new file position.
 
@@ -9,6 +9,7 @@
 from .coroutines import *
 from .events import *
 from .exceptions import *
+from .files import *
 from .futures import *
 from .graph import *
 from .locks import *
@@ -27,6 +28,7 @@
            coroutines.__all__ +
            events.__all__ +
            exceptions.__all__ +
+           files.__all__ +
            futures.__all__ +
            graph.__all__ +
            locks.__all__ +
@@ -47,6 +49,9 @@
 else:
     from .unix_events import *  # pragma: no cover
     __all__ += unix_events.__all__
+    if sys.platform == 'linux':  # pragma: no cover
+        from .uring_events import *
+        __all__ += uring_events.__all__
 
 def __getattr__(name: str):
     import warnings
@@ -77,6 +77,81 @@ def _format_handle(handle):
         return str(handle)
 
 
+def _schedule_timer(scheduled, timer):
+    """Push a TimerHandle onto the heap of scheduled timers."""
+    heapq.heappush(scheduled, timer)
+    timer._scheduled = True
+
+
+def _pop_cancelled_timers(scheduled):
+    """Pop the cancelled timers at the head of the heap.
+
+    Returns the number of timers removed.
+    """
+    count = 0
+    while scheduled and scheduled[0]._cancelled:
+        handle = heapq.heappop(scheduled)
+        handle._scheduled = False
+        count += 1
+    return count
+
+
+def _remove_cancelled_timers(scheduled):
+    """Remove all cancelled timers from the heap of scheduled timers."""
+    new_scheduled = []
+    for handle in scheduled:
+        if handle._cancelled:
+            handle._scheduled = False
+        else:
+            new_scheduled.append(handle)
+
+    heapq.heapify(new_scheduled)
+    scheduled[:] = new_scheduled
+
+
+def _pop_due_timers(scheduled, ready, end_time):
+    """Move the timers due before end_time from the heap to the ready queue."""
+    while scheduled:
+        handle = scheduled[0]
+        if handle._when >= end_time:
+            break
+        handle = heapq.heappop(scheduled)
+        handle._scheduled = False
+        ready.append(handle)
+
+
+def _run_ready(ready, ntodo):
+    """Pop the first ntodo handles of the ready queue and run them.
+
+    Cancelled handles are skipped.
+    """
+    for i in range(ntodo):
+        handle = ready.popleft()
+        if handle._cancelled:
+            continue
+        handle._run()
+
+
+_py_schedule_timer = _schedule_timer
+_py_pop_cancelled_timers = _pop_cancelled_timers
+_py_remove_cancelled_timers = _remove_cancelled_timers
+_py_pop_due_timers = _pop_due_timers
+_py_run_ready = _run_ready
+
+try:
+    from _asyncio import (_schedule_timer, _pop_cancelled_timers,
+                          _remove_cancelled_timers, _pop_due_timers,
+                          _run_ready)
+except ImportError:
+    pass
+else:
+    _c_schedule_timer = _schedule_timer
+    _c_pop_cancelled_timers = _pop_cancelled_timers
+    _c_remove_cancelled_timers = _remove_cancelled_timers
+    _c_pop_due_timers = _pop_due_timers
+    _c_run_ready = _run_ready
+
+
 def _format_pipe(fd):
     if fd == subprocess.PIPE:
         return '<pipe>'
@@ -423,6 +498,7 @@ def __init__(self):
         self._ready = collections.deque()
         self._scheduled = []
         self._default_executor = None
+        self._file_executor = None
         self._internal_fds = 0
         # Identifier of the thread running the event loop, or None if the
         # event loop is not running
@@ -600,10 +676,17 @@ async def shutdown_default_executor(self, timeout=None):
         that the executor will be given an unlimited amount of time.
         """
         self._executor_shutdown_called = True
-        if self._default_executor is None:
+        # The executor of file operations is joined too, so that no file
+        # operation is still running when asyncio.run() returns.
+        executors = [executor
+                     for executor in (self._default_executor,
+                                      self._file_executor)
+                     if executor is not None]
+        if not executors:
             return
         future = self.create_future()
-        thread = threading.Thread(target=self._do_shutdown, args=(future,))
+        thread = threading.Thread(target=self._do_shutdown,
+                                  args=(future, executors))
         thread.start()
         try:
             async with timeouts.timeout(timeout):
@@ -612,13 +695,15 @@ async def shutdown_default_executor(self, timeout=None):
             warnings.warn("The executor did not finishing joining "
                           f"its threads within {timeout} seconds.",
                           RuntimeWarning, stacklevel=2)
-            self._default_executor.shutdown(wait=False)
+            for executor in executors:
+                executor.shutdown(wait=False)
         else:
             thread.join()
 
-    def _do_shutdown(self, future):
+    def _do_shutdown(self, future, executors):
         try:
-            self._default_executor.shutdown(wait=True)
+            for executor in executors:
+                executor.shutdown(wait=True)
             if not self.is_closed():
                 self.call_soon_threadsafe(futures._set_result_unless_cancelled,
                                           future, None)
@@ -748,6 +833,10 @@ def close(self):
         if executor is not None:
             self._default_executor = None
             executor.shutdown(wait=False)
+        executor = self._file_executor
+        if executor is not None:
+            self._file_executor = None
+            executor.shutdown(wait=False)
 
     def is_closed(self):
         """Returns True if the event loop was closed."""
@@ -810,8 +899,7 @@ def call_at(self, when, callback, *args, context=None):
         timer = events.TimerHandle(when, callback, args, self, context)
         if timer._source_traceback:
             del timer._source_traceback[-1]
-        heapq.heappush(self._scheduled, timer)
-        timer._scheduled = True
+        _schedule_timer(self._scheduled, timer)
         return timer
 
     def call_soon(self, callback, *args, context=None):
@@ -897,6 +985,31 @@ def run_in_executor(self, executor, func, *args):
         return futures.wrap_future(
             executor.submit(func, *args), loop=self)
 
+    def _run_file_op(self, func, *args):
+        # Blocking file operations run in a thread pool of their own, so
+        # that they do not queue behind run_in_executor() calls.
+        self._check_closed()
+        executor = self._file_executor
+        if executor is None:
+            self._check_default_executor()
+            executor = concurrent.futures.ThreadPoolExecutor(
+                thread_name_prefix='asyncio-file'
+            )
+            self._file_executor = executor
+        return futures.wrap_future(executor.submit(func, *args), loop=self)
+
+    # Read and write file, an io.FileIO, at its current position.  Event
+    # loops which can perform file I/O asynchronously override these.
+
+    def _file_read(self, file, n):
+        return self._run_file_op(file.read, n)
+
+    def _file_readinto(self, file, buf):
+        return self._run_file_op(file.readinto, buf)
+
+    def _file_write(self, file, data):
+        return self._run_file_op(file.write, data)
+
     def set_default_executor(self, executor):
         if not isinstance(executor, concurrent.futures.ThreadPoolExecutor):
             raise TypeError('executor must be ThreadPoolExecutor instance')
@@ -940,6 +1053,9 @@ async def getnameinfo(self, sockaddr, flags=0):
         return await self.run_in_executor(
             None, socket.getnameinfo, sockaddr, flags)
 
+    async def sock_sendall_zerocopy(self, sock, data):
+        return await self.sock_sendall(sock, data)
+
     async def sock_sendfile(self, sock, file, offset=0, count=None,
                             *, fallback=True):
         if self._debug and sock.gettimeout() != 0:
@@ -1969,22 +2085,12 @@ def _run_once(self):
                 _MIN_CANCELLED_TIMER_HANDLES_FRACTION):
             # Remove delayed calls that were cancelled if their number
             # is too high
-            new_scheduled = []
-            for handle in self._scheduled:
-                if handle._cancelled:
-                    handle._scheduled = False
-                else:
-                    new_scheduled.append(handle)
-
-            heapq.heapify(new_scheduled)
-            self._scheduled = new_scheduled
+            _remove_cancelled_timers(self._scheduled)
             self._timer_cancelled_count = 0
         else:
             # Remove delayed calls that were cancelled from head of queue.
-            while self._scheduled and self._scheduled[0]._cancelled:
-                self._timer_cancelled_count -= 1
-                handle = heapq.heappop(self._scheduled)
-                handle._scheduled = False
+            self._timer_cancelled_count -= (
+                _pop_cancelled_timers(self._scheduled))
 
         timeout = None
         if self._ready or self._stopping:
@@ -2004,13 +2110,7 @@ def _run_once(self):
 
         # Handle 'later' callbacks that are ready.
         end_time = self.time() + self._clock_resolution
-        while self._scheduled:
-            handle = self._scheduled[0]
-            if handle._when >= end_time:
-                break
-            handle = heapq.heappop(self._scheduled)
-            handle._scheduled = False
-            self._ready.append(handle)
+        _pop_due_timers(self._scheduled, self._ready, end_time)
 
         # This is the only place where callbacks are actually *called*.
         # All other places just add them to ready.
@@ -2019,23 +2119,23 @@ def _run_once(self):
         # they will be run the next time (after another I/O poll).
         # Use an idiom that is thread-safe without using locks.
         ntodo = len(self._ready)
+        if not self._debug:
+            _run_ready(self._ready, ntodo)
+            return
         for i in range(ntodo):
             handle = self._ready.popleft()
             if handle._cancelled:
                 continue
-            if self._debug:
-                try:
-                    self._current_handle = handle
-                    t0 = self.time()
-                    handle._run()
-                    dt = self.time() - t0
-                    if dt >= self.slow_callback_duration:
-                        logger.warning('Executing %s took %.3f seconds',
-                                       _format_handle(handle), dt)
-                finally:
-                    self._current_handle = None
-            else:
+            try:
+                self._current_handle = handle
+                t0 = self.time()
                 handle._run()
+                dt = self.time() - t0
+                if dt >= self.slow_callback_duration:
+                    logger.warning('Executing %s took %.3f seconds',
+                                   _format_handle(handle), dt)
+            finally:
+                self._current_handle = None
         handle = None  # Needed to break cycles when an exception occurs.
 
     def _set_coroutine_origin_tracking(self, enabled):
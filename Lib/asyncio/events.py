@@ -613,6 +613,9 @@ async def sock_recvfrom_into(self, sock, buf, nbytes=0):
     async def sock_sendall(self, sock, data):
         raise NotImplementedError
 
+    async def sock_sendall_zerocopy(self, sock, data):
+        raise NotImplementedError
+
     async def sock_sendto(self, sock, data, address):
         raise NotImplementedError
 
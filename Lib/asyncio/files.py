@@ -0,0 +1,146 @@
+"""Asynchronous file I/O."""
+
+__all__ = ('AsyncFileIO', 'open_file')
+
+import io
+import os
+
+from . import events
+
+
+# Largest read issued by AsyncFileIO.readall() when the size of the file
+# is not known.
+_MAX_READ_SIZE = 1024 * 1024
+
+
+async def open_file(file, mode='r', *, closefd=True, opener=None):
+    """Open a file for unbuffered binary I/O from coroutines.
+
+    The arguments are the same as for io.FileIO.  The file is opened in a
+    worker thread, and an AsyncFileIO object is returned.
+    """
+    loop = events.get_running_loop()
+    raw = await loop._run_file_op(io.FileIO, file, mode, closefd, opener)
+    return AsyncFileIO(raw)
+
+
+class AsyncFileIO:
+    """Wrapper for an io.FileIO object whose read and write methods are
+    coroutines.
+
+    With IoUringEventLoop, reads and writes are submitted to the kernel as
+    io_uring requests.  Other event loops run them in a pool of worker
+    threads dedicated to file I/O.  Reads and writes use and advance the
+    current file position, so only one of them should be in progress at a
+    time.
+    """
+
+    def __init__(self, raw):
+        if not isinstance(raw, io.FileIO):
+            raise TypeError(f'expected an io.FileIO object, '
+                            f'got {type(raw).__name__}')
+        self._raw = raw
+
+    def __repr__(self):
+        info = [self.__class__.__name__]
+        if self._raw.closed:
+            info.append('closed')
+        else:
+            info.append(f'name={self._raw.name!r}')
+            info.append(f'mode={self._raw.mode!r}')
+        return '<{}>'.format(' '.join(info))
+
+    @property
+    def raw(self):
+        return self._raw
+
+    @property
+    def name(self):
+        return self._raw.name
+
+    @property
+    def mode(self):
+        return self._raw.mode
+
+    @property
+    def closed(self):
+        return self._raw.closed
+
+    def fileno(self):
+        return self._raw.fileno()
+
+    def readable(self):
+        return self._raw.readable()
+
+    def writable(self):
+        return self._raw.writable()
+
+    def seekable(self):
+        return self._raw.seekable()
+
+    def seek(self, pos, whence=os.SEEK_SET):
+        return self._raw.seek(pos, whence)
+
+    def tell(self):
+        return self._raw.tell()
+
+    def close(self):
+        self._raw.close()
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, *exc_info):
+        self.close()
+
+    async def read(self, size=-1):
+        """Read at most size bytes, or until EOF if size is negative."""
+        if size is None or size < 0:
+            return await self.readall()
+        self._check_readable()
+        loop = events.get_running_loop()
+        return await loop._file_read(self._raw, size)
+
+    async def readall(self):
+        """Read until EOF."""
+        self._check_readable()
+        loop = events.get_running_loop()
+        bufsize = io.DEFAULT_BUFFER_SIZE
+        try:
+            pos = os.lseek(self._raw.fileno(), 0, os.SEEK_CUR)
+            end = os.fstat(self._raw.fileno()).st_size
+        except OSError:
+            pass
+        else:
+            if end > pos:
+                bufsize = end - pos
+        chunks = []
+        while True:
+            data = await loop._file_read(self._raw, bufsize)
+            if not data:
+                break
+            chunks.append(data)
+            bufsize = min(max(len(data), io.DEFAULT_BUFFER_SIZE) * 2,
+                          _MAX_READ_SIZE)
+        return b''.join(chunks)
+
+    async def readinto(self, buffer):
+        """Read bytes into a pre-allocated, writable bytes-like object.
+
+        Return the number of bytes read.
+        """
+        self._check_readable()
+        loop = events.get_running_loop()
+        return await loop._file_readinto(self._raw, buffer)
+
+    async def write(self, data):
+        """Write the bytes-like object data and return the number of bytes
+        written."""
+        if not self._raw.writable():
+            raise io.UnsupportedOperation('File not open for writing')
+        loop = events.get_running_loop()
+        return await loop._file_write(self._raw, data)
+
+    def _check_readable(self):
+        if not self._raw.readable():
+            raise io.UnsupportedOperation('File not open for reading')
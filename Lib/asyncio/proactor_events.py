@@ -1,7 +1,7 @@
 """Event loop using a proactor and related classes.
 
-A proactor is a "notify-on-completion" multiplexer.  Currently a
-proactor is only implemented on Windows with IOCP.
+A proactor is a "notify-on-completion" multiplexer.  Proactors are
+implemented on Windows with IOCP and on Linux with io_uring.
 """
 
 __all__ = 'BaseProactorEventLoop',
@@ -162,7 +162,12 @@ def _call_connection_lost(self, exc):
             # just close our end.  First calling shutdown() seems to
             # cure it, but maybe using DisconnectEx() would be better.
             if hasattr(self._sock, 'shutdown') and self._sock.fileno() != -1:
-                self._sock.shutdown(socket.SHUT_RDWR)
+                try:
+                    self._sock.shutdown(socket.SHUT_RDWR)
+                except OSError:
+                    # Not connected: an unconnected datagram socket, or a
+                    # connection already reset by the peer (Linux).
+                    pass
             self._sock.close()
             self._sock = None
             server = self._server
@@ -789,7 +794,7 @@ def _make_self_pipe(self):
     def _loop_self_reading(self, f=None):
         try:
             if f is not None:
-                f.result()  # may raise
+                self._process_self_data(f.result())  # may raise
             if self._self_reading_future is not f:
                 # When we scheduled this Future, we assigned it to
                 # _self_reading_future. If it's not there now, something has
@@ -814,6 +819,9 @@ def _loop_self_reading(self, f=None):
             self._self_reading_future = f
             f.add_done_callback(self._loop_self_reading)
 
+    def _process_self_data(self, data):
+        pass
+
     def _write_to_self(self):
         # This may be called from a different thread, possibly after
         # _close_self_pipe() has been called or even while it is
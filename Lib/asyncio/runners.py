@@ -1,9 +1,11 @@
-__all__ = ('Runner', 'run')
+__all__ = ('Runner', 'run', 'LoopGroup')
 
+import concurrent.futures
 import contextvars
 import enum
 import functools
 import inspect
+import os
 import threading
 import signal
 from . import coroutines
@@ -204,6 +206,167 @@ async def main():
         return runner.run(main)
 
 
+class LoopGroup:
+    """A context manager that runs event loops in a pool of threads.
+
+    Each thread runs its own event loop, with the life cycle of a Runner.
+    On the free-threaded build the loops run in parallel, so a single
+    process can use several CPU cores.
+
+    submit() starts a coroutine on the loop that has the fewest unfinished
+    coroutines submitted by the group.  submit_each() starts a coroutine on
+    every loop, for example to accept connections on a socket bound with
+    reuse_port=True in every loop, letting the kernel distribute them.
+
+    Tasks are never moved between loops: a task and the futures it awaits
+    belong to the loop that created them.
+
+    If size is None, the number of CPUs usable by the process is used.
+    The debug and loop_factory arguments are passed to the Runner of each
+    thread.
+
+    with asyncio.LoopGroup() as group:
+        results = [group.submit(fetch(url)) for url in urls]
+        for future in results:
+            print(future.result())
+    """
+
+    # Note: the class is final, it is not intended for inheritance.
+
+    def __init__(self, size=None, *, debug=None, loop_factory=None):
+        if size is None:
+            size = os.process_cpu_count() or 1
+        if size < 1:
+            raise ValueError('size must be at least 1')
+        self._size = size
+        self._debug = debug
+        self._loop_factory = loop_factory
+        self._state = _State.CREATED
+        self._lock = threading.Lock()
+        self._threads = []
+        self._loops = []
+        self._stoppers = []
+        # Number of unfinished submitted coroutines of each loop
+        self._load = []
+
+    def __enter__(self):
+        self._lazy_init()
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.close()
+
+    def close(self):
+        """Stop the event loops and wait for their threads to finish.
+
+        Like Runner.close(), the tasks still running are cancelled, and
+        asynchronous generators and the default executor of each loop are
+        finalized.
+        """
+        with self._lock:
+            if self._state is not _State.INITIALIZED:
+                return
+            if threading.current_thread() in self._threads:
+                raise RuntimeError(
+                    'LoopGroup.close() cannot be called from one of its '
+                    'event loops')
+            self._state = _State.CLOSED
+        self._stop_loops()
+
+    def _stop_loops(self):
+        for loop, stop in zip(self._loops, self._stoppers):
+            try:
+                loop.call_soon_threadsafe(_set_result_unless_done, stop)
+            except RuntimeError:
+                # The loop is already closed.
+                pass
+        for thread in self._threads:
+            thread.join()
+        self._loops.clear()
+
+    def get_loops(self):
+        """Return a tuple of the event loops of the group."""
+        self._lazy_init()
+        return tuple(self._loops)
+
+    def submit(self, coro):
+        """Run a coroutine in the least busy event loop of the group.
+
+        Return a concurrent.futures.Future to access the result.
+        """
+        try:
+            self._lazy_init()
+        except RuntimeError:
+            if coroutines.iscoroutine(coro):
+                coro.close()
+            raise
+        with self._lock:
+            index = min(range(self._size), key=self._load.__getitem__)
+            self._load[index] += 1
+        try:
+            future = tasks.run_coroutine_threadsafe(coro, self._loops[index])
+        except BaseException:
+            self._done(index, None)
+            raise
+        future.add_done_callback(functools.partial(self._done, index))
+        return future
+
+    def submit_each(self, coro_func, /, *args):
+        """Run coro_func(*args) in every event loop of the group.
+
+        Return a list of concurrent.futures.Future objects, one per loop.
+        """
+        self._lazy_init()
+        return [tasks.run_coroutine_threadsafe(coro_func(*args), loop)
+                for loop in self._loops]
+
+    def _done(self, index, future):
+        with self._lock:
+            self._load[index] -= 1
+
+    def _lazy_init(self):
+        with self._lock:
+            if self._state is _State.CLOSED:
+                raise RuntimeError("LoopGroup is closed")
+            if self._state is _State.INITIALIZED:
+                return
+            self._state = _State.INITIALIZED
+            try:
+                for i in range(self._size):
+                    started = concurrent.futures.Future()
+                    thread = threading.Thread(target=self._run_loop,
+                                              args=(started,),
+                                              name=f'asyncio-loop-{i}')
+                    thread.start()
+                    self._threads.append(thread)
+                    loop, stop = started.result()
+                    self._loops.append(loop)
+                    self._stoppers.append(stop)
+                    self._load.append(0)
+            except BaseException:
+                self._state = _State.CLOSED
+                self._stop_loops()
+                raise
+
+    def _run_loop(self, started):
+        try:
+            runner = Runner(debug=self._debug,
+                            loop_factory=self._loop_factory)
+            loop = runner.get_loop()
+            stop = loop.create_future()
+        except BaseException as exc:
+            started.set_exception(exc)
+            raise
+        started.set_result((loop, stop))
+        with runner:
+            runner.run(stop)
+
+
+def _set_result_unless_done(future):
+    if not future.done():
+        future.set_result(None)
+
+
 def _cancel_all_tasks(loop):
     to_cancel = tasks.all_tasks(loop)
     if not to_cancel:
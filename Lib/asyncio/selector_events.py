@@ -11,6 +11,7 @@
 import functools
 import itertools
 import os
+import select
 import selectors
 import socket
 import warnings
@@ -65,6 +66,8 @@ def __init__(self, selector=None):
         self._selector = selector
         self._make_self_pipe()
         self._transports = weakref.WeakValueDictionary()
+        self._zerocopy_epoll = None
+        self._zerocopy_waiters = {}
 
     def _make_socket_transport(self, sock, protocol, waiter=None, *,
                                extra=None, server=None):
@@ -102,6 +105,11 @@ def close(self):
         if self.is_closed():
             return
         self._close_self_pipe()
+        if self._zerocopy_epoll is not None:
+            self._remove_reader(self._zerocopy_epoll.fileno())
+            self._zerocopy_epoll.close()
+            self._zerocopy_epoll = None
+            self._internal_fds -= 1
         super().close()
         if self._selector is not None:
             self._selector.close()
@@ -558,13 +566,16 @@ async def sock_sendall(self, sock, data):
             functools.partial(self._sock_write_done, fd, handle=handle))
         return await fut
 
-    def _sock_sendall(self, fut, sock, view, pos):
+    def _sock_sendall(self, fut, sock, view, pos, zerocopy=False):
         if fut.done():
             # Future cancellation can be scheduled on previous loop iteration
             return
         start = pos[0]
         try:
-            n = sock.send(view[start:])
+            if zerocopy:
+                n = sock.send_zerocopy(view[start:])
+            else:
+                n = sock.send(view[start:])
         except (BlockingIOError, InterruptedError):
             return
         except (SystemExit, KeyboardInterrupt):
@@ -580,6 +591,98 @@ def _sock_sendall(self, fut, sock, view, pos):
         else:
             pos[0] = start
 
+    async def sock_sendall_zerocopy(self, sock, data):
+        """Send data to the socket without copying it.
+
+        Like sock_sendall(), but the kernel reads the data directly from
+        the buffer (MSG_ZEROCOPY).  Return once all data has been sent and
+        the kernel no longer uses the buffer, which must not be modified
+        until then.  Fall back to sock_sendall() if the socket does not
+        support zero-copy send.
+        """
+        base_events._check_ssl_socket(sock)
+        if self._debug and sock.gettimeout() != 0:
+            raise ValueError("the socket must be non-blocking")
+        if not hasattr(select, 'epoll') or not hasattr(sock, 'send_zerocopy'):
+            return await self.sock_sendall(sock, data)
+        view = memoryview(data).cast('B')
+        try:
+            n = sock.send_zerocopy(view)
+        except (BlockingIOError, InterruptedError):
+            n = 0
+        except OSError as exc:
+            if exc.errno not in (errno.EOPNOTSUPP, errno.ENOPROTOOPT):
+                raise
+            # SO_ZEROCOPY is not supported for this kind of socket.
+            return await self.sock_sendall(sock, data)
+
+        if n < len(view):
+            fut = self.create_future()
+            fd = sock.fileno()
+            self._ensure_fd_no_transport(fd)
+            handle = self._add_writer(fd, self._sock_sendall, fut, sock,
+                                      view, [n], True)
+            fut.add_done_callback(
+                functools.partial(self._sock_write_done, fd, handle=handle))
+            await fut
+        await self._sock_zerocopy_wait(sock)
+
+    async def _sock_zerocopy_wait(self, sock):
+        # Completions are queued on the socket error queue, which makes
+        # the socket report EPOLLERR.  Sockets waiting for completions are
+        # watched by a separate epoll object registered as a reader, so that
+        # other readers and writers of the socket are not affected.
+        sock.zerocopy_completions()
+        if not sock.zerocopy_pending:
+            return
+        if self._zerocopy_epoll is None:
+            self._zerocopy_epoll = select.epoll()
+            self._internal_fds += 1
+            self._add_reader(self._zerocopy_epoll.fileno(),
+                             self._process_zerocopy_completions)
+        fd = sock.fileno()
+        entry = self._zerocopy_waiters.get(fd)
+        if entry is None or entry[0] is not sock:
+            # Edge-triggered, so that a hung up socket is reported once.
+            try:
+                self._zerocopy_epoll.register(fd, select.EPOLLET)
+            except FileExistsError:
+                self._zerocopy_epoll.modify(fd, select.EPOLLET)
+            entry = self._zerocopy_waiters[fd] = (sock, [])
+        fut = self.create_future()
+        entry[1].append(fut)
+        try:
+            await fut
+        finally:
+            entry[1].remove(fut)
+
+    def _process_zerocopy_completions(self):
+        for fd, _ in self._zerocopy_epoll.poll(0):
+            entry = self._zerocopy_waiters.get(fd)
+            if entry is None:
+                continue
+            sock, waiters = entry
+            try:
+                sock.zerocopy_completions()
+            except OSError as exc:
+                error = exc
+            else:
+                error = None
+                if sock.zerocopy_pending and waiters:
+                    continue
+            del self._zerocopy_waiters[fd]
+            try:
+                self._zerocopy_epoll.unregister(fd)
+            except OSError:
+                pass
+            for fut in waiters:
+                if fut.done():
+                    continue
+                if error is None:
+                    fut.set_result(None)
+                else:
+                    fut.set_exception(error)
+
     async def sock_sendto(self, sock, data, address):
         """Send data to the socket.
 
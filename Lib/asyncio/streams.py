@@ -44,7 +44,7 @@ async def open_connection(host=None, port=None, *,
     """
     loop = events.get_running_loop()
     reader = StreamReader(limit=limit, loop=loop)
-    protocol = StreamReaderProtocol(reader, loop=loop)
+    protocol = _BufferedStreamReaderProtocol(reader, loop=loop)
     transport, _ = await loop.create_connection(
         lambda: protocol, host, port, **kwds)
     writer = StreamWriter(transport, protocol, reader, loop)
@@ -77,8 +77,8 @@ async def start_server(client_connected_cb, host=None, port=None, *,
 
     def factory():
         reader = StreamReader(limit=limit, loop=loop)
-        protocol = StreamReaderProtocol(reader, client_connected_cb,
-                                        loop=loop)
+        protocol = _BufferedStreamReaderProtocol(reader, client_connected_cb,
+                                                 loop=loop)
         return protocol
 
     return await loop.create_server(factory, host, port, **kwds)
@@ -93,7 +93,7 @@ async def open_unix_connection(path=None, *,
         loop = events.get_running_loop()
 
         reader = StreamReader(limit=limit, loop=loop)
-        protocol = StreamReaderProtocol(reader, loop=loop)
+        protocol = _BufferedStreamReaderProtocol(reader, loop=loop)
         transport, _ = await loop.create_unix_connection(
             lambda: protocol, path, **kwds)
         writer = StreamWriter(transport, protocol, reader, loop)
@@ -106,8 +106,9 @@ async def start_unix_server(client_connected_cb, path=None, *,
 
         def factory():
             reader = StreamReader(limit=limit, loop=loop)
-            protocol = StreamReaderProtocol(reader, client_connected_cb,
-                                            loop=loop)
+            protocol = _BufferedStreamReaderProtocol(reader,
+                                                     client_connected_cb,
+                                                     loop=loop)
             return protocol
 
         return await loop.create_unix_server(factory, path, **kwds)
@@ -306,6 +307,31 @@ def __del__(self):
                 closed.exception()
 
 
+class _BufferedStreamReaderProtocol(StreamReaderProtocol,
+                                   protocols.BufferedProtocol):
+    """StreamReaderProtocol which receives data into the reader's buffer.
+
+    The transport reads directly into the buffer of the StreamReader
+    instead of creating a bytes object for each chunk of data.
+    """
+
+    _discard_buffer = None
+
+    def get_buffer(self, sizehint):
+        reader = self._stream_reader
+        if reader is not None:
+            return reader._get_buffer(sizehint)
+        # The reader was garbage collected: discard the data.
+        if self._discard_buffer is None:
+            self._discard_buffer = bytearray(_DEFAULT_LIMIT)
+        return self._discard_buffer
+
+    def buffer_updated(self, nbytes):
+        reader = self._stream_reader
+        if reader is not None:
+            reader._buffer_updated(nbytes)
+
+
 class StreamWriter:
     """Wraps a Transport.
 
@@ -409,6 +435,55 @@ def __del__(self, warnings=warnings):
                 self.close()
                 warnings.warn(f"unclosed {self!r}", ResourceWarning)
 
+class _StreamBuffer(bytearray):
+    """Buffer of StreamReader.
+
+    The data is received with extend(), or with get_buffer() followed by
+    buffer_updated(), and consumed with take().
+    """
+
+    _scratch = None
+    _reserved = 0
+
+    def get_buffer(self, sizehint):
+        if sizehint <= 0:
+            sizehint = _DEFAULT_LIMIT
+        if self._scratch is None or len(self._scratch) < sizehint:
+            self._scratch = bytearray(sizehint)
+        self._reserved = len(self._scratch)
+        return self._scratch
+
+    def buffer_updated(self, nbytes):
+        if not 0 <= nbytes <= self._reserved:
+            raise ValueError('nbytes exceeds the size of the last '
+                             'get_buffer() result')
+        self._reserved = 0
+        self += memoryview(self._scratch)[:nbytes]
+
+    def clear(self):
+        self._reserved = 0
+        super().clear()
+
+    def take(self, n):
+        if n < 0:
+            raise ValueError('n must be non-negative')
+        data = bytes(memoryview(self)[:n])
+        del self[:n]
+        return data
+
+
+_PyStreamBuffer = _StreamBuffer
+
+
+try:
+    import _asyncio
+except ImportError:
+    pass
+else:
+    # _CStreamBuffer is needed for tests.
+    _StreamBuffer = _CStreamBuffer = _asyncio._StreamBuffer
+
+
 class StreamReader:
 
     _source_traceback = None
@@ -425,7 +500,7 @@ def __init__(self, limit=_DEFAULT_LIMIT, loop=None):
             self._loop = events.get_event_loop()
         else:
             self._loop = loop
-        self._buffer = bytearray()
+        self._buffer = _StreamBuffer()
         self._eof = False    # Whether we're done.
         self._waiter = None  # A future used by _wait_for_data()
         self._exception = None
@@ -497,6 +572,20 @@ def feed_data(self, data):
             return
 
         self._buffer.extend(data)
+        self._data_added()
+
+    def _get_buffer(self, sizehint):
+        return self._buffer.get_buffer(sizehint)
+
+    def _buffer_updated(self, nbytes):
+        if not nbytes:
+            return
+
+        assert not self._eof, 'buffer_updated after feed_eof'
+        self._buffer.buffer_updated(nbytes)
+        self._data_added()
+
+    def _data_added(self):
         self._wakeup_waiter()
 
         if (self._transport is not None and
@@ -564,7 +653,7 @@ async def readline(self):
             return e.partial
         except exceptions.LimitOverrunError as e:
             if self._buffer.startswith(sep, e.consumed):
-                del self._buffer[:e.consumed + seplen]
+                self._buffer.take(e.consumed + seplen)
             else:
                 self._buffer.clear()
             self._maybe_resume_transport()
@@ -669,8 +758,7 @@ async def readuntil(self, separator=b'\n'):
             # adds data which makes separator be found. That's why we check for
             # EOF *after* inspecting the buffer.
             if self._eof:
-                chunk = bytes(self._buffer)
-                self._buffer.clear()
+                chunk = self._buffer.take(len(self._buffer))
                 raise exceptions.IncompleteReadError(chunk, None)
 
             # _wait_for_data() will resume reading if stream was paused.
@@ -680,10 +768,9 @@ async def readuntil(self, separator=b'\n'):
             raise exceptions.LimitOverrunError(
                 'Separator is found, but chunk is longer than limit', match_start)
 
-        chunk = self._buffer[:match_end]
-        del self._buffer[:match_end]
+        chunk = self._buffer.take(match_end)
         self._maybe_resume_transport()
-        return bytes(chunk)
+        return chunk
 
     async def read(self, n=-1):
         """Read up to `n` bytes from the stream.
@@ -730,8 +817,7 @@ async def read(self, n=-1):
             await self._wait_for_data('read')
 
         # This will work right even if buffer is less than n bytes
-        data = bytes(memoryview(self._buffer)[:n])
-        del self._buffer[:n]
+        data = self._buffer.take(n)
 
         self._maybe_resume_transport()
         return data
@@ -762,18 +848,12 @@ async def readexactly(self, n):
 
         while len(self._buffer) < n:
             if self._eof:
-                incomplete = bytes(self._buffer)
-                self._buffer.clear()
+                incomplete = self._buffer.take(len(self._buffer))
                 raise exceptions.IncompleteReadError(incomplete, n)
 
             await self._wait_for_data('readexactly')
 
-        if len(self._buffer) == n:
-            data = bytes(self._buffer)
-            self._buffer.clear()
-        else:
-            data = bytes(memoryview(self._buffer)[:n])
-            del self._buffer[:n]
+        data = self._buffer.take(n)
         self._maybe_resume_transport()
         return data
 
@@ -52,20 +52,22 @@ def waitstatus_to_exitcode(status):
         return status
 
 
-class _UnixSelectorEventLoop(selector_events.BaseSelectorEventLoop):
-    """Unix event loop.
-
-    Adds signal handling and UNIX Domain Socket support to SelectorEventLoop.
+class _UnixEventLoopMixin:
+    """Signal handling, UNIX Domain Socket and subprocess support shared by
+    the Unix event loops.
     """
 
-    def __init__(self, selector=None):
-        super().__init__(selector)
+    def __init__(self, *args):
+        super().__init__(*args)
         self._signal_handlers = {}
         self._unix_server_sockets = {}
+        self._watcher = self._make_child_watcher()
+
+    def _make_child_watcher(self):
         if can_use_pidfd():
-            self._watcher = _PidfdChildWatcher()
+            return _PidfdChildWatcher()
         else:
-            self._watcher = _ThreadedChildWatcher()
+            return _ThreadedChildWatcher()
 
     def close(self):
         super().close()
@@ -187,14 +189,6 @@ def _check_signal(self, sig):
         if sig not in signal.valid_signals():
             raise ValueError(f'invalid signal number {sig}')
 
-    def _make_read_pipe_transport(self, pipe, protocol, waiter=None,
-                                  extra=None):
-        return _UnixReadPipeTransport(self, pipe, protocol, waiter, extra)
-
-    def _make_write_pipe_transport(self, pipe, protocol, waiter=None,
-                                   extra=None):
-        return _UnixWritePipeTransport(self, pipe, protocol, waiter, extra)
-
     async def _make_subprocess_transport(self, protocol, args, shell,
                                          stdin, stdout, stderr, bufsize,
                                          extra=None, **kwargs):
@@ -352,6 +346,46 @@ async def create_unix_server(
 
         return server
 
+    def _stop_serving(self, sock):
+        # Is this a unix socket that needs cleanup?
+        if sock in self._unix_server_sockets:
+            path = sock.getsockname()
+        else:
+            path = None
+
+        super()._stop_serving(sock)
+
+        if path is not None:
+            prev_ino = self._unix_server_sockets[sock]
+            del self._unix_server_sockets[sock]
+            try:
+                if os.stat(path).st_ino == prev_ino:
+                    os.unlink(path)
+            except FileNotFoundError:
+                pass
+            except OSError as err:
+                logger.error('Unable to clean up listening UNIX socket '
+                             '%r: %r', path, err)
+
+
+class _UnixSelectorEventLoop(_UnixEventLoopMixin,
+                             selector_events.BaseSelectorEventLoop):
+    """Unix event loop.
+
+    Adds signal handling and UNIX Domain Socket support to SelectorEventLoop.
+    """
+
+    def __init__(self, selector=None):
+        super().__init__(selector)
+
+    def _make_read_pipe_transport(self, pipe, protocol, waiter=None,
+                                  extra=None):
+        return _UnixReadPipeTransport(self, pipe, protocol, waiter, extra)
+
+    def _make_write_pipe_transport(self, pipe, protocol, waiter=None,
+                                   extra=None):
+        return _UnixWritePipeTransport(self, pipe, protocol, waiter, extra)
+
     async def _sock_sendfile_native(self, sock, file, offset, count):
         try:
             os.sendfile
@@ -460,27 +494,6 @@ def cb(fut):
                     self.remove_writer(fd)
         fut.add_done_callback(cb)
 
-    def _stop_serving(self, sock):
-        # Is this a unix socket that needs cleanup?
-        if sock in self._unix_server_sockets:
-            path = sock.getsockname()
-        else:
-            path = None
-
-        super()._stop_serving(sock)
-
-        if path is not None:
-            prev_ino = self._unix_server_sockets[sock]
-            del self._unix_server_sockets[sock]
-            try:
-                if os.stat(path).st_ino == prev_ino:
-                    os.unlink(path)
-            except FileNotFoundError:
-                pass
-            except OSError as err:
-                logger.error('Unable to clean up listening UNIX socket '
-                             '%r: %r', path, err)
-
 
 class _UnixReadPipeTransport(transports.ReadTransport):
 
@@ -0,0 +1,552 @@
+"""Proactor event loop for Linux using io_uring."""
+
+import errno
+import fcntl
+import functools
+import io
+import os
+import select
+import socket
+import time
+import weakref
+
+from . import base_events
+from . import events
+from . import exceptions
+from . import futures
+from . import proactor_events
+from . import tasks
+from . import unix_events
+from .log import logger
+
+try:
+    import _uring
+except ImportError:  # pragma: no cover
+    _uring = None
+
+
+__all__ = (
+    'IoUringProactor', 'IoUringEventLoop',
+)
+
+
+# Number of requests the submission queue holds.  A full queue is handed
+# to the kernel early, so this does not limit the operations in flight.
+DEFAULT_ENTRIES = 256
+
+# Capacity requested for the pipe sendfile() moves the data through
+SENDFILE_PIPE_SIZE = 1024 * 1024
+
+
+class _UringFuture(futures.Future):
+    """Subclass of Future which represents an io_uring operation.
+
+    Cancelling it will immediately cancel the operation.
+    """
+
+    def __init__(self, op, ring, *, loop=None):
+        super().__init__(loop=loop)
+        if self._source_traceback:
+            del self._source_traceback[-1]
+        self._op = op
+        self._ring = ring
+
+    def _repr_info(self):
+        info = super()._repr_info()
+        if self._op is not None:
+            info.insert(1, f'operation={self._op!r}')
+        return info
+
+    def _cancel_operation(self):
+        if self._op is None:
+            return
+        try:
+            if not self._ring.closed:
+                self._ring.cancel(self._op)
+        except OSError as exc:
+            context = {
+                'message': 'Cancelling an io_uring future failed',
+                'exception': exc,
+                'future': self,
+            }
+            if self._source_traceback:
+                context['source_traceback'] = self._source_traceback
+            self._loop.call_exception_handler(context)
+        self._op = None
+
+    def cancel(self, msg=None):
+        self._cancel_operation()
+        return super().cancel(msg=msg)
+
+    def set_exception(self, exception):
+        super().set_exception(exception)
+        self._cancel_operation()
+
+    def set_result(self, result):
+        super().set_result(result)
+        self._op = None
+
+
+class _IoUringWritePipeTransport(proactor_events._ProactorWritePipeTransport):
+
+    def __init__(self, *args, **kw):
+        # The write end of a pipe cannot be read to detect that the read
+        # end was closed, as _ProactorWritePipeTransport does on Windows.
+        proactor_events._ProactorBaseWritePipeTransport.__init__(
+            self, *args, **kw)
+        self._read_fut = self._loop._proactor.wait_pipe_closed(self._sock)
+        self._read_fut.add_done_callback(self._pipe_closed)
+
+
+class _PidfdChildWatcher:
+    """Child watcher implementation waiting for pid file descriptors with
+    io_uring poll requests.
+    """
+
+    def add_child_handler(self, pid, callback, *args):
+        loop = events.get_running_loop()
+        pidfd = os.pidfd_open(pid)
+        fut = loop._proactor.poll(pidfd, select.POLLIN)
+        fut.add_done_callback(
+            functools.partial(self._do_wait, pid, pidfd, callback, args))
+
+    def _do_wait(self, pid, pidfd, callback, args, fut):
+        if fut.cancelled():
+            # The event loop was closed before the child process exited.
+            os.close(pidfd)
+            return
+        try:
+            _, status = os.waitpid(pid, 0)
+        except ChildProcessError:
+            # The child process is already reaped
+            # (may happen if waitpid() is called elsewhere).
+            returncode = 255
+            logger.warning(
+                "child process pid %d exit status already read: "
+                " will report returncode 255",
+                pid)
+        else:
+            returncode = unix_events.waitstatus_to_exitcode(status)
+
+        os.close(pidfd)
+        callback(pid, returncode, *args)
+
+
+class IoUringEventLoop(unix_events._UnixEventLoopMixin,
+                       proactor_events.BaseProactorEventLoop):
+    """Unix event loop using io_uring.
+
+    Socket, pipe, file and sendfile I/O is submitted to the kernel as io_uring
+    requests, which perform the I/O and report its completion, rather than
+    waiting for readiness and then calling the system call.  Adds signal
+    handling, UNIX Domain Socket and subprocess support to the proactor
+    event loop.
+    """
+
+    def __init__(self, proactor=None):
+        if proactor is None:
+            proactor = IoUringProactor()
+        super().__init__(proactor)
+
+    def _make_child_watcher(self):
+        if unix_events.can_use_pidfd():
+            return _PidfdChildWatcher()
+        else:
+            return unix_events._ThreadedChildWatcher()
+
+    def _make_write_pipe_transport(self, sock, protocol, waiter=None,
+                                   extra=None):
+        return _IoUringWritePipeTransport(self, sock, protocol, waiter, extra)
+
+    def _run_forever_setup(self):
+        assert self._self_reading_future is None
+        self.call_soon(self._loop_self_reading)
+        super()._run_forever_setup()
+
+    def _run_forever_cleanup(self):
+        super()._run_forever_cleanup()
+        if self._self_reading_future is not None:
+            self._self_reading_future.cancel()
+            self._self_reading_future = None
+
+    async def sock_connect(self, sock, address):
+        if sock.family == socket.AF_INET or (
+                base_events._HAS_IPv6 and sock.family == socket.AF_INET6):
+            resolved = await self._ensure_resolved(
+                address, family=sock.family, type=sock.type, proto=sock.proto,
+                loop=self,
+            )
+            _, _, _, _, address = resolved[0]
+        return await super().sock_connect(sock, address)
+
+    async def _sock_sendfile_native(self, sock, file, offset, count):
+        # The proactor sends the whole range in one call and returns how
+        # much was actually sent, which is less if the file shrinks.
+        try:
+            fileno = file.fileno()
+        except (AttributeError, io.UnsupportedOperation):
+            raise exceptions.SendfileNotAvailableError("not a regular file")
+        try:
+            fsize = os.fstat(fileno).st_size
+        except OSError:
+            raise exceptions.SendfileNotAvailableError("not a regular file")
+        end_pos = min(offset + count, fsize) if count else fsize
+        if offset >= end_pos:
+            return 0
+        return await self._proactor.sendfile(sock, file, offset,
+                                             end_pos - offset)
+
+    def _file_read(self, file, n):
+        return self._proactor.read_file(file, n)
+
+    def _file_readinto(self, file, buf):
+        return self._proactor.readinto_file(file, buf)
+
+    def _file_write(self, file, data):
+        return self._proactor.write_file(file, data)
+
+
+class IoUringProactor:
+    """Proactor implementation using io_uring."""
+
+    def __init__(self, entries=DEFAULT_ENTRIES):
+        self._loop = None
+        self._results = []
+        self._ring = None
+        self._cache = {}
+        self._stopped_serving = weakref.WeakSet()
+        if _uring is None:
+            raise OSError(errno.ENOSYS, 'io_uring is not supported')
+        self._ring = _uring.Ring(entries)
+
+    def _check_closed(self):
+        if self._ring is None:
+            raise RuntimeError('IoUringProactor is closed')
+
+    def __repr__(self):
+        info = ['operation#=%s' % len(self._cache),
+                'result#=%s' % len(self._results)]
+        if self._ring is None:
+            info.append('closed')
+        return '<%s %s>' % (self.__class__.__name__, " ".join(info))
+
+    def set_loop(self, loop):
+        self._loop = loop
+
+    def select(self, timeout=None):
+        if not self._results:
+            self._poll(timeout)
+        tmp = self._results
+        self._results = []
+        try:
+            return tmp
+        finally:
+            # Needed to break cycles when an exception occurs.
+            tmp = None
+
+    @staticmethod
+    def finish_socket_func(op):
+        return op.getresult()
+
+    def recv(self, conn, nbytes, flags=0):
+        self._check_closed()
+        if isinstance(conn, socket.socket):
+            op = self._ring.recv(conn.fileno(), nbytes, flags)
+        else:
+            op = self._ring.read(conn.fileno(), nbytes)
+        return self._register(op, conn, self.finish_socket_func)
+
+    def recv_into(self, conn, buf, flags=0):
+        self._check_closed()
+        if isinstance(conn, socket.socket):
+            op = self._ring.recv_into(conn.fileno(), buf, flags)
+        else:
+            op = self._ring.read_into(conn.fileno(), buf)
+        return self._register(op, conn, self.finish_socket_func)
+
+    # io_uring cannot return the sender address of a datagram, nor take the
+    # address of connect() and sendto(), in the format of the socket module:
+    # these operations wait for readiness and call the socket method.
+
+    def recvfrom(self, conn, nbytes, flags=0):
+        return self._call_when_ready(
+            conn, select.POLLIN, lambda: conn.recvfrom(nbytes, flags))
+
+    def recvfrom_into(self, conn, buf, flags=0):
+        return self._call_when_ready(
+            conn, select.POLLIN, lambda: conn.recvfrom_into(buf, flags))
+
+    def sendto(self, conn, buf, flags=0, addr=None):
+        return self._call_when_ready(
+            conn, select.POLLOUT, lambda: conn.sendto(buf, flags, addr))
+
+    def send(self, conn, buf, flags=0):
+        self._check_closed()
+        if isinstance(conn, socket.socket):
+            op = self._ring.send(conn.fileno(), buf, flags)
+        else:
+            op = self._ring.write(conn.fileno(), buf)
+        # Start sending now, as the selector event loop does, rather than at
+        # the next iteration of the event loop.
+        self._ring.submit()
+        return self._register(op, conn, self.finish_socket_func)
+
+    # Regular files are read and written at their current position, like
+    # os.read() and os.write().  Unlike send(), the requests are not
+    # submitted right away, so that the operations started in the same
+    # iteration of the event loop are handed to the kernel together.
+
+    def read_file(self, file, nbytes):
+        self._check_closed()
+        op = self._ring.read(file.fileno(), nbytes)
+        return self._register(op, file, self.finish_socket_func)
+
+    def readinto_file(self, file, buf):
+        self._check_closed()
+        op = self._ring.read_into(file.fileno(), buf)
+        return self._register(op, file, self.finish_socket_func)
+
+    def write_file(self, file, data):
+        self._check_closed()
+        op = self._ring.write(file.fileno(), data)
+        return self._register(op, file, self.finish_socket_func)
+
+    def accept(self, listener):
+        self._check_closed()
+        op = self._ring.accept(listener.fileno())
+
+        def finish_accept(op):
+            conn = socket.socket(listener.family, listener.type,
+                                 listener.proto, op.getresult())
+            conn.settimeout(listener.gettimeout())
+            try:
+                addr = conn.getpeername()
+            except OSError:
+                # The peer already reset the connection: reading the
+                # socket reports it.
+                addr = None
+            return conn, addr
+
+        def discard_accept(op):
+            # The future was cancelled: close the accepted socket.
+            try:
+                os.close(op.getresult())
+            except OSError:
+                pass
+
+        return self._register(op, listener, finish_accept, discard_accept)
+
+    def connect(self, conn, address):
+        self._check_closed()
+        try:
+            conn.connect(address)
+        except (BlockingIOError, InterruptedError):
+            pass
+        else:
+            return self._done_future(None)
+
+        def finish_connect(op):
+            op.getresult()
+            err = conn.getsockopt(socket.SOL_SOCKET, socket.SO_ERROR)
+            if err != 0:
+                raise OSError(err, f'Connect call failed {address}')
+
+        op = self._ring.poll(conn.fileno(), select.POLLOUT)
+        return self._register(op, conn, finish_connect)
+
+    async def sendfile(self, sock, file, offset, count):
+        # There is no sendfile request: splice the data from the file into
+        # a pipe and from the pipe into the socket, which does not copy it
+        # to user space either.
+        self._check_closed()
+        fileno = file.fileno()
+        sent = 0
+        read_fd, write_fd = os.pipe()
+        try:
+            try:
+                fcntl.fcntl(write_fd, fcntl.F_SETPIPE_SZ, SENDFILE_PIPE_SIZE)
+            except OSError:
+                # Limited by /proc/sys/fs/pipe-max-size
+                pass
+            while sent < count:
+                n = await self._splice(fileno, offset + sent, write_fd, -1,
+                                       count - sent)
+                if n == 0:
+                    break
+                while n > 0:
+                    try:
+                        nsent = await self._splice(read_fd, -1,
+                                                   sock.fileno(), -1, n)
+                    except BlockingIOError:
+                        # splice() honors O_NONBLOCK on the socket.
+                        await self.poll(sock.fileno(), select.POLLOUT)
+                    else:
+                        n -= nsent
+                        sent += nsent
+        finally:
+            os.close(read_fd)
+            os.close(write_fd)
+            if sent:
+                # Like os.sendfile() in the selector event loop, leave the
+                # file position after the data sent, even on error.
+                file.seek(offset + sent)
+        return sent
+
+    def _splice(self, fd_in, offset_in, fd_out, offset_out, nbytes):
+        op = self._ring.splice(fd_in, offset_in, fd_out, offset_out,
+                               min(nbytes, 0x7fff_ffff), os.SPLICE_F_MOVE)
+        return self._register(op, None, self.finish_socket_func)
+
+    def poll(self, fd, events):
+        """Wait for events on the file descriptor fd.
+
+        Return a Future object. The result of the future is the mask of the
+        events which occurred.
+        """
+        self._check_closed()
+        op = self._ring.poll(fd, events)
+        return self._register(op, None, self.finish_socket_func)
+
+    def wait_pipe_closed(self, pipe):
+        """Wait until the read end of the pipe is closed.
+
+        Return a Future object. The result of the future is b'', like the
+        result of recv() at the end of the file.
+        """
+        def finish_pipe_closed(op):
+            op.getresult()
+            return b''
+
+        self._check_closed()
+        # POLLERR is reported on the write end once the read end is closed.
+        op = self._ring.poll(pipe.fileno(), 0)
+        return self._register(op, pipe, finish_pipe_closed)
+
+    def _call_when_ready(self, conn, events, func):
+        # Call func() now, and again each time conn is ready while it would
+        # block.
+        self._check_closed()
+        try:
+            return self._done_future(func())
+        except (BlockingIOError, InterruptedError):
+            pass
+
+        async def retry():
+            while True:
+                await self.poll(conn.fileno(), events)
+                try:
+                    return func()
+                except (BlockingIOError, InterruptedError):
+                    pass
+
+        return tasks.ensure_future(retry(), loop=self._loop)
+
+    def _done_future(self, value):
+        fut = self._loop.create_future()
+        fut.set_result(value)
+        return fut
+
+    def _register(self, op, obj, callback, discard=None):
+        # Return a future which will be set with the result of the
+        # operation when it completes.  The future's value is actually
+        # the value returned by callback().  If the future is done before
+        # the operation completes, discard() is called instead.
+        f = _UringFuture(op, self._ring, loop=self._loop)
+        if f._source_traceback:
+            del f._source_traceback[-1]
+        # Note that we only store obj to prevent it from being garbage
+        # collected too early.
+        self._cache[op] = (f, obj, callback, discard)
+        return f
+
+    def _poll(self, timeout=None):
+        if timeout is not None and timeout < 0:
+            raise ValueError("negative timeout")
+
+        for op in self._ring.wait(timeout):
+            f, obj, callback, discard = self._cache.pop(op)
+            if obj in self._stopped_serving and not f.done():
+                f.cancel()
+            if f.done():
+                # The future was cancelled
+                if discard is not None:
+                    discard(op)
+                continue
+            try:
+                value = callback(op)
+            except OSError as e:
+                f.set_exception(e)
+                self._results.append(f)
+            else:
+                f.set_result(value)
+                self._results.append(f)
+            finally:
+                f = None
+
+    def _stop_serving(self, obj):
+        # obj is a socket.  It will be closed in
+        # BaseProactorEventLoop._stop_serving() which will make any
+        # pending operations fail quickly.
+        self._stopped_serving.add(obj)
+
+    def close(self):
+        if self._ring is None:
+            # already closed
+            return
+
+        # Cancel remaining registered operations.
+        for fut, obj, callback, discard in list(self._cache.values()):
+            if fut.cancelled():
+                # Nothing to do with cancelled futures
+                pass
+            else:
+                try:
+                    fut.cancel()
+                except OSError as exc:
+                    if self._loop is not None:
+                        context = {
+                            'message': 'Cancelling a future failed',
+                            'exception': exc,
+                            'future': fut,
+                        }
+                        if fut._source_traceback:
+                            context['source_traceback'] = fut._source_traceback
+                        self._loop.call_exception_handler(context)
+
+        # Wait until all cancelled operations complete: the kernel may still
+        # write to their buffers. Display progress every second if the loop
+        # is still running.
+        msg_update = 1.0
+        start_time = time.monotonic()
+        next_msg = start_time + msg_update
+        while self._cache:
+            if next_msg <= time.monotonic():
+                logger.debug('%r is running after closing for %.1f seconds',
+                             self, time.monotonic() - start_time)
+                next_msg = time.monotonic() + msg_update
+
+            # handle a few events, or timeout
+            self._poll(msg_update)
+
+        self._results = []
+
+        self._ring.close()
+        self._ring = None
+
+    def __del__(self):
+        self.close()
+
+
+def new_event_loop():
+    """Return a new IoUringEventLoop, or a SelectorEventLoop if io_uring
+    cannot be used.
+
+    This can be passed as the loop_factory of asyncio.run() and
+    asyncio.Runner.
+    """
+    try:
+        proactor = IoUringProactor()
+    except OSError as exc:
+        logger.debug('io_uring cannot be used (%s), using selectors', exc)
+        return unix_events.SelectorEventLoop()
+    return IoUringEventLoop(proactor)
@@ -32,11 +32,13 @@
 from sys import maxsize
 from struct import pack, unpack
 import io
+import operator
 import codecs
 import _compat_pickle
 
 __all__ = ["PickleError", "PicklingError", "UnpicklingError", "Pickler",
-           "Unpickler", "dump", "dumps", "load", "loads"]
+           "Unpickler", "dump", "dumps", "load", "loads", "dumps_chunked",
+           "loads_chunked"]
 
 try:
     from _pickle import PickleBuffer
@@ -418,7 +420,8 @@ def _T(obj):
 class _Pickler:
 
     def __init__(self, file, protocol=None, *, fix_imports=True,
-                 buffer_callback=None):
+                 buffer_callback=None, buffer_threshold=None,
+                 memoize_strings=True):
         """This takes a binary file for writing a pickle data stream.
 
         The optional *protocol* argument tells the pickler to use the
@@ -451,6 +454,16 @@ def __init__(self, file, protocol=None, *, fix_imports=True,
 
         It is an error if *buffer_callback* is not None and *protocol*
         is None or smaller than 5.
+
+        If *buffer_threshold* is not None, bytes, bytearray and
+        array.array objects whose size in bytes is at least
+        *buffer_threshold* are pickled as if they were wrapped in a
+        PickleBuffer, so that *buffer_callback* can send them
+        out-of-band.  It requires a *buffer_callback*.
+
+        If *memoize_strings* is false, str and bytes objects are not
+        memoized: each reference to the same string is pickled again.
+        This makes pickling faster when most strings are unique.
         """
         if protocol is None:
             protocol = DEFAULT_PROTOCOL
@@ -460,7 +473,15 @@ def __init__(self, file, protocol=None, *, fix_imports=True,
             raise ValueError("pickle protocol must be <= %d" % HIGHEST_PROTOCOL)
         if buffer_callback is not None and protocol < 5:
             raise ValueError("buffer_callback needs protocol >= 5")
+        if buffer_threshold is not None:
+            if buffer_callback is None:
+                raise ValueError("buffer_threshold needs a buffer_callback")
+            buffer_threshold = operator.index(buffer_threshold)
+            if buffer_threshold < 0:
+                raise ValueError("buffer_threshold must be non-negative")
         self._buffer_callback = buffer_callback
+        self._buffer_threshold = buffer_threshold
+        self._memoize_strings = memoize_strings
         try:
             self._file_write = file.write
         except AttributeError:
@@ -564,9 +585,13 @@ def save(self, obj, save_persistent_id=True):
         if reduce is not _NoValue:
             rv = reduce(obj)
 
+        t = type(obj)
+        if (rv is NotImplemented and self._buffer_threshold is not None and
+            (t is bytes or t is bytearray)):
+            rv = self._reduce_large_buffer(obj)
+
         if rv is NotImplemented:
             # Check the type dispatch table
-            t = type(obj)
             f = self.dispatch.get(t)
             if f is not None:
                 f(self, obj)  # Call unbound method with explicit self
@@ -584,16 +609,23 @@ def save(self, obj, save_persistent_id=True):
                     self.save_global(obj)
                     return
 
-                # Check for a __reduce_ex__ method, fall back to __reduce__
-                reduce = getattr(obj, "__reduce_ex__", _NoValue)
-                if reduce is not _NoValue:
-                    rv = reduce(self.proto)
-                else:
-                    reduce = getattr(obj, "__reduce__", _NoValue)
+                # A large array is only written out-of-band if no reducer
+                # was registered for it.
+                if self._buffer_threshold is not None:
+                    rv = self._reduce_large_buffer(obj)
+
+                if rv is NotImplemented:
+                    # Check for a __reduce_ex__ method, fall back to
+                    # __reduce__
+                    reduce = getattr(obj, "__reduce_ex__", _NoValue)
                     if reduce is not _NoValue:
-                        rv = reduce()
+                        rv = reduce(self.proto)
                     else:
-                        raise PicklingError(f"Can't pickle {_T(t)} object")
+                        reduce = getattr(obj, "__reduce__", _NoValue)
+                        if reduce is not _NoValue:
+                            rv = reduce()
+                        else:
+                            raise PicklingError(f"Can't pickle {_T(t)} object")
 
         # Check for string returned by reduce(), meaning "save as global"
         if isinstance(rv, str):
@@ -617,6 +649,29 @@ def save(self, obj, save_persistent_id=True):
             exc.add_note(f'when serializing {_T(obj)} object')
             raise
 
+    def _reduce_large_buffer(self, obj):
+        # Reduce a large bytes, bytearray or array.array object to its
+        # constructor called with a PickleBuffer, so that its data goes
+        # through save_picklebuffer() and may be written out-of-band.
+        t = type(obj)
+        if t is bytes or t is bytearray:
+            if len(obj) < self._buffer_threshold:
+                return NotImplemented
+            return (t, (PickleBuffer(obj),))
+        array = sys.modules.get('array')
+        if array is None or t is not array.array:
+            return NotImplemented
+        if len(obj) * obj.itemsize < self._buffer_threshold:
+            return NotImplemented
+        # The empty array gives the reconstructor and the machine format
+        # code without copying the data.
+        rv = t(obj.typecode).__reduce_ex__(3)
+        if len(rv[1]) != 4:
+            # Unknown machine format, the array is pickled as a list.
+            return NotImplemented
+        func, (cls, typecode, mformat_code, _) = rv[:2]
+        return (func, (cls, typecode, mformat_code, PickleBuffer(obj)))
+
     def persistent_id(self, obj):
         # This exists so a subclass can override it
         return None
@@ -864,7 +919,8 @@ def save_bytes(self, obj):
                                  (str(obj, 'latin1'), 'latin1'), obj=obj)
             return
         self._save_bytes_no_memo(obj)
-        self.memoize(obj)
+        if self._memoize_strings:
+            self.memoize(obj)
     dispatch[bytes] = save_bytes
 
     def _save_bytearray_no_memo(self, obj):
@@ -943,7 +999,8 @@ def save_str(self, obj):
             tmp = tmp.replace("\r", "\\u000d")
             tmp = tmp.replace("\x1a", "\\u001a")  # EOF on DOS
             self.write(UNICODE + tmp.encode('raw-unicode-escape') + b'\n')
-        self.memoize(obj)
+        if self._memoize_strings:
+            self.memoize(obj)
     dispatch[str] = save_str
 
     def save_tuple(self, obj):
@@ -1864,14 +1921,20 @@ def load_stop(self):
 
 # Shorthands
 
-def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None,
+          buffer_threshold=None, memoize_strings=True):
     _Pickler(file, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback,
+             buffer_threshold=buffer_threshold,
+             memoize_strings=memoize_strings).dump(obj)
 
-def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None,
+           buffer_threshold=None, memoize_strings=True):
     f = io.BytesIO()
     _Pickler(f, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback,
+             buffer_threshold=buffer_threshold,
+             memoize_strings=memoize_strings).dump(obj)
     res = f.getvalue()
     assert isinstance(res, bytes_types)
     return res
@@ -1906,6 +1969,136 @@ def _loads(s, /, *, fix_imports=True, encoding="ASCII", errors="strict",
     Pickler, Unpickler = _Pickler, _Unpickler
     dump, dumps, load, loads = _dump, _dumps, _load, _loads
 
+# Independently decodable chunks
+
+def dumps_chunked(obj, protocol=None, *, chunk_size=10_000, fix_imports=True):
+    """Return the pickled representation of obj as independent chunks.
+
+    An exact list or dict is split into slices of at most *chunk_size*
+    items, and each slice is pickled on its own, without references to
+    the others.  Any other object is pickled as a single chunk.  The
+    result starts with a pickled header listing the chunk sizes,
+    followed by the chunks, and can only be read with loads_chunked(),
+    which may decode the chunks in parallel.
+
+    An object referenced from two slices is pickled once in each, so
+    the slices no longer share it after unpickling.
+    """
+    if chunk_size <= 0:
+        raise ValueError("chunk_size must be positive")
+    t = type(obj)
+    if t is list:
+        kind = 'list'
+        chunks = [dumps(obj[i:i + chunk_size], protocol,
+                        fix_imports=fix_imports)
+                  for i in range(0, len(obj), chunk_size)]
+    elif t is dict:
+        kind = 'dict'
+        chunks = [dumps(dict(items), protocol, fix_imports=fix_imports)
+                  for items in batched(obj.items(), chunk_size)]
+    else:
+        kind = 'object'
+        chunks = [dumps(obj, protocol, fix_imports=fix_imports)]
+    header = dumps((kind, [len(chunk) for chunk in chunks]), protocol,
+                   fix_imports=fix_imports)
+    return b''.join([header, *chunks])
+
+class _ViewReader:
+    """Minimal binary file reading from a memoryview.
+
+    Unlike io.BytesIO, it does not copy the whole buffer, only the bytes
+    actually read.  It has no peek() method, so that an Unpickler reads
+    no further than the end of the pickle and pos gives that end.
+    """
+
+    def __init__(self, view):
+        self.view = view
+        self.pos = 0
+
+    def read(self, size=-1):
+        start = self.pos
+        end = len(self.view) if size < 0 else min(start + size, len(self.view))
+        self.pos = end
+        return bytes(self.view[start:end])
+
+    def readinto(self, buf):
+        with memoryview(buf) as m, m.cast('B') as b:
+            n = min(len(b), len(self.view) - self.pos)
+            b[:n] = self.view[self.pos:self.pos + n]
+        self.pos += n
+        return n
+
+    def readline(self):
+        start = end = self.pos
+        while end < len(self.view):
+            i = bytes(self.view[end:end + 256]).find(b'\n')
+            if i >= 0:
+                end += i + 1
+                break
+            end += 256
+        return self.read(end - start)
+
+def loads_chunked(data, /, *, max_workers=None, fix_imports=True,
+                  encoding="ASCII", errors="strict"):
+    """Read an object produced by dumps_chunked() from a bytes-like object.
+
+    The chunks are decoded by up to *max_workers* threads.  By default,
+    this is the number of CPUs available to the process if the GIL is
+    disabled, and 1 otherwise.  The other arguments have the same
+    meaning as for loads().
+    """
+    if isinstance(data, str):
+        raise TypeError("Can't load pickle from unicode string")
+    if max_workers is not None and max_workers <= 0:
+        raise ValueError("max_workers must be greater than 0")
+    kwargs = dict(fix_imports=fix_imports, encoding=encoding, errors=errors)
+    view = memoryview(data).cast('B')
+    file = _ViewReader(view)
+    header = Unpickler(file, **kwargs).load()
+    start = file.pos
+    try:
+        kind, sizes = header
+        if (kind not in ('list', 'dict', 'object') or
+            not all(type(size) is int and size > 0 for size in sizes) or
+            (kind == 'object' and len(sizes) != 1)):
+            raise ValueError
+    except (TypeError, ValueError):
+        raise UnpicklingError("invalid chunked pickle header") from None
+    if start + sum(sizes) != len(view):
+        raise UnpicklingError("chunked pickle data has wrong length")
+    chunks = []
+    for size in sizes:
+        chunks.append(view[start:start + size])
+        start += size
+
+    def load_chunk(chunk):
+        return loads(chunk, **kwargs)
+
+    if max_workers is None:
+        if sys._is_gil_enabled():
+            max_workers = 1
+        else:
+            import os
+            max_workers = os.process_cpu_count() or 1
+    if max_workers > 1 and len(chunks) > 1:
+        from concurrent.futures import ThreadPoolExecutor
+        with ThreadPoolExecutor(min(max_workers, len(chunks))) as executor:
+            parts = list(executor.map(load_chunk, chunks))
+    else:
+        parts = list(map(load_chunk, chunks))
+
+    if kind == 'object':
+        return parts[0]
+    result = [] if kind == 'list' else {}
+    for part in parts:
+        if type(part) is not type(result):
+            raise UnpicklingError(f"chunk of a {kind} is a {_T(part)}")
+        if kind == 'list':
+            result.extend(part)
+        else:
+            result.update(part)
+    return result
+
 
 def _main(args=None):
     import argparse
@@ -94,6 +94,7 @@
     findall   Find all occurrences of a pattern in a string.
     finditer  Return an iterator yielding a Match object for each match.
     compile   Compile a pattern into a Pattern object.
+    compile_set Compile several patterns into a PatternSet object.
     purge     Clear the regular expression cache.
     escape    Backslash all non-alphanumerics in a string.
 
@@ -116,6 +117,10 @@
     X  VERBOSE     Ignore whitespace and comments for nicer looking RE's.
     U  UNICODE     For compatibility only. Ignored for string patterns (it
                    is the default), and forbidden for bytes patterns.
+       LINEAR      Use an engine whose matching time is linear in the
+                   length of the string.  Backreferences, lookaround
+                   assertions, atomic groups and possessive quantifiers
+                   are not supported.
 
 This module also defines exception 'PatternError', aliased to 'error' for
 backward compatibility.
@@ -131,10 +136,11 @@
 # public symbols
 __all__ = [
     "match", "fullmatch", "search", "sub", "subn", "split",
-    "findall", "finditer", "compile", "purge", "escape",
-    "error", "Pattern", "Match", "A", "I", "L", "M", "S", "X", "U",
+    "findall", "finditer", "compile", "compile_set", "purge", "escape",
+    "error", "Pattern", "Match", "PatternSet",
+    "A", "I", "L", "M", "S", "X", "U",
     "ASCII", "IGNORECASE", "LOCALE", "MULTILINE", "DOTALL", "VERBOSE",
-    "UNICODE", "NOFLAG", "RegexFlag", "PatternError"
+    "UNICODE", "LINEAR", "NOFLAG", "RegexFlag", "PatternError"
 ]
 
 __version__ = "2.2.1"
@@ -150,6 +156,7 @@ class RegexFlag:
     MULTILINE = M = _compiler.SRE_FLAG_MULTILINE # make anchors look for newline
     DOTALL = S = _compiler.SRE_FLAG_DOTALL # make dot match newline
     VERBOSE = X = _compiler.SRE_FLAG_VERBOSE # ignore whitespace and comments
+    LINEAR = _compiler.SRE_FLAG_LINEAR # match in time linear in the string
     # sre extensions (experimental, don't rely on these)
     DEBUG = _compiler.SRE_FLAG_DEBUG # dump pattern after compilation
     __str__ = object.__str__
@@ -288,6 +295,13 @@ def compile(pattern, flags=0):
     "Compile a regular expression pattern, returning a Pattern object."
     return _compile(pattern, flags)
 
+def compile_set(patterns, flags=0):
+    """Compile an iterable of regular expression patterns, returning a
+    PatternSet object.  Its matches() method returns the indices of the
+    patterns which match a string, scanning the string only once for
+    the literals they require."""
+    return _sre.compile_set(tuple(_compile(p, flags) for p in patterns))
+
 def purge():
     "Clear the regular expression caches"
     _cache.clear()
@@ -314,6 +328,7 @@ def escape(pattern):
 
 Pattern = type(_compiler.compile('', 0))
 Match = type(_compiler.compile('', 0).match(''))
+PatternSet = type(_sre.compile_set(()))
 
 # --------------------------------------------------------------------
 # internals
@@ -385,6 +400,11 @@ def _pickle(p):
 
 copyreg.pickle(Pattern, _pickle, _compile)
 
+def _pickle_set(s):
+    return compile_set, (s.patterns,)
+
+copyreg.pickle(PatternSet, _pickle_set)
+
 # --------------------------------------------------------------------
 # experimental stuff (see python-dev discussions for details)
 
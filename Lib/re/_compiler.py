@@ -418,6 +418,29 @@ def _simple(p):
         return av[0] is None and _simple(av[-1])
     return op in _UNIT_CODES
 
+_LINEAR_UNSUPPORTED = {
+    GROUPREF: "group references",
+    GROUPREF_EXISTS: "group references",
+    ASSERT: "lookaround assertions",
+    ASSERT_NOT: "lookaround assertions",
+    ATOMIC_GROUP: "atomic groups",
+    POSSESSIVE_REPEAT: "possessive quantifiers",
+}
+
+def _check_linear(p):
+    # check that the linear-time engine can run this subpattern
+    for op, av in p:
+        if op in _LINEAR_UNSUPPORTED:
+            raise PatternError("%s are not supported with the LINEAR flag"
+                               % _LINEAR_UNSUPPORTED[op])
+        if op is SUBPATTERN:
+            _check_linear(av[-1])
+        elif op in _REPEATING_CODES:
+            _check_linear(av[2])
+        elif op is BRANCH:
+            for item in av[1]:
+                _check_linear(item)
+
 def _generate_overlap_table(prefix):
     """
     Generate an overlap table for the following prefix.
@@ -522,6 +545,64 @@ def _get_charset_prefix(pattern, flags):
         return charset
     return None
 
+def _get_literal_runs(pattern, flags, lo, hi, runs):
+    # internal: collect the runs of literal characters which every match
+    # of pattern must contain, together with the range of their offsets
+    # from the start of the match.  lo and hi are the offsets of the
+    # start of pattern; returns the offsets of its end, or None if the
+    # end cannot be reached (SUCCESS)
+    iscased = _get_iscased(flags)
+    run = None
+    for op, av in pattern.data:
+        if op is LITERAL and not (iscased and iscased(av)):
+            if run is None:
+                run = [], lo, hi
+                runs.append(run)
+            run[0].append(av)
+            lo += 1
+            hi += 1
+            continue
+        run = None
+        if op is SUBPATTERN:
+            group, add_flags, del_flags, p = av
+            flags1 = _combine_flags(flags, add_flags, del_flags)
+            if not (flags1 & SRE_FLAG_IGNORECASE and
+                    flags1 & SRE_FLAG_LOCALE):
+                end = _get_literal_runs(p, flags1, lo, hi, runs)
+                if end is None:
+                    return None
+                lo, hi = end
+                continue
+        elif op is ATOMIC_GROUP:
+            end = _get_literal_runs(av, flags, lo, hi, runs)
+            if end is None:
+                return None
+            lo, hi = end
+            continue
+        elif op in _REPEATING_CODES and av[0] >= 1:
+            # the first iteration starts here
+            _get_literal_runs(av[2], flags, lo, hi, runs)
+        elif op is SUCCESS:
+            return None
+        i, j = _parser.SubPattern(pattern.state, [(op, av)]).getwidth()
+        lo += i
+        hi += j
+    return lo, hi
+
+def _get_required_literal(pattern, flags, prefix):
+    # look for the longest literal which must occur in every match.  a
+    # literal at the start of the pattern is not useful if the search
+    # already skips to the literal prefix
+    runs = []
+    _get_literal_runs(pattern, flags, 0, 0, runs)
+    required = None
+    for run in runs:
+        if prefix and run[2] == 0:
+            continue
+        if required is None or len(run[0]) > len(required[0]):
+            required = run
+    return required
+
 def _compile_info(code, pattern, flags):
     # internal: compile an info block.  in the current version,
     # this contains min/max pattern width, and an optional literal
@@ -551,6 +632,11 @@ def _compile_info(code, pattern, flags):
 ##         print("*** PREFIX", prefix, prefix_skip)
 ##     if charset:
 ##         print("*** CHARSET", charset)
+    # look for a literal required somewhere in the pattern
+    required = None
+    if not (flags & SRE_FLAG_IGNORECASE and flags & SRE_FLAG_LOCALE):
+        if not (prefix and prefix_skip is None and got_all):
+            required = _get_required_literal(pattern, flags, prefix)
     # add an info block
     emit = code.append
     emit(INFO)
@@ -563,6 +649,8 @@ def _compile_info(code, pattern, flags):
             mask = mask | SRE_INFO_LITERAL
     elif charset:
         mask = mask | SRE_INFO_CHARSET
+    if required:
+        mask = mask | SRE_INFO_REQUIRED
     emit(mask)
     # pattern length
     if lo < MAXCODE:
@@ -571,6 +659,14 @@ def _compile_info(code, pattern, flags):
         emit(MAXCODE)
         prefix = prefix[:MAXCODE]
     emit(hi)
+    # add required literal
+    if required:
+        literal, required_lo, required_hi = required
+        literal = literal[:MAXCODE]
+        emit(len(literal)) # length
+        emit(min(required_lo, MAXCODE)) # offsets from the match start
+        emit(min(required_hi, MAXCODE))
+        code.extend(literal)
     # add literal prefix
     if prefix:
         emit(len(prefix)) # length
@@ -729,10 +825,21 @@ def print_2(*args):
                     max = 'MAXREPEAT'
                 print_(op, skip, bin(flags), min, max, to=i+skip)
                 start = i+4
+                if flags & SRE_INFO_REQUIRED:
+                    required_len, required_lo, required_hi = code[start: start+3]
+                    if required_hi == MAXCODE:
+                        required_hi = 'MAXCODE'
+                    print_2('  required_offset', required_lo, required_hi)
+                    start += 3
+                    required = code[start: start+required_len]
+                    print_2('  required',
+                            '[%s]' % ', '.join('%#02x' % x for x in required),
+                            '(%r)' % ''.join(map(chr, required)))
+                    start += required_len
                 if flags & SRE_INFO_PREFIX:
-                    prefix_len, prefix_skip = code[i+4: i+6]
+                    prefix_len, prefix_skip = code[start: start+2]
                     print_2('  prefix_skip', prefix_skip)
-                    start = i + 6
+                    start += 2
                     prefix = code[start: start+prefix_len]
                     print_2('  prefix',
                             '[%s]' % ', '.join('%#02x' % x for x in prefix),
@@ -763,6 +870,9 @@ def compile(p, flags=0):
     else:
         pattern = None
 
+    if flags & SRE_FLAG_LINEAR:
+        _check_linear(p)
+
     code = _code(p, flags)
 
     if flags & SRE_FLAG_DEBUG:
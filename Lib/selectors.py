@@ -449,17 +449,15 @@ def select(self, timeout=None):
 
             ready = []
             try:
-                fd_event_list = self._selector.poll(timeout, max_ev)
+                key_event_list = self._selector.poll_mapped(
+                    self._fd_to_key, timeout, max_ev)
             except InterruptedError:
                 return ready
 
-            fd_to_key = self._fd_to_key
-            for fd, event in fd_event_list:
-                key = fd_to_key.get(fd)
-                if key:
-                    events = ((event & _NOT_EPOLLIN and EVENT_WRITE)
-                              | (event & _NOT_EPOLLOUT and EVENT_READ))
-                    ready.append((key, events & key.events))
+            for key, event in key_event_list:
+                events = ((event & _NOT_EPOLLIN and EVENT_WRITE)
+                          | (event & _NOT_EPOLLOUT and EVENT_READ))
+                ready.append((key, events & key.events))
             return ready
 
         def close(self):
@@ -3,6 +3,7 @@
 import copyreg
 import dbm
 import io
+import itertools
 import functools
 import os
 import math
@@ -4024,6 +4025,113 @@ def test_oob_buffers_writable_to_readonly(self):
             self.assertIs(type(new), type(obj))
             self.assertEqual(new, obj)
 
+    def test_buffer_threshold(self):
+        import array
+        objs = [b"abcdefgh", bytearray(b"abcdefgh"),
+                array.array('i', range(8)), array.array('d', [0.5] * 8)]
+        for obj in objs:
+            for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+                with self.subTest(obj=obj, proto=proto):
+                    buffers = []
+                    data = self.dumps(obj, proto,
+                                      buffer_callback=buffers.append,
+                                      buffer_threshold=8)
+                    self.assertEqual(count_opcode(pickle.NEXT_BUFFER, data), 1)
+                    self.assertEqual(len(buffers), 1)
+                    self.assertEqual(buffers[0].raw(), memoryview(obj).cast('B'))
+                    # Need buffers argument to unpickle properly
+                    with self.assertRaises(pickle.UnpicklingError):
+                        self.loads(data)
+                    new = self.loads(data, buffers=buffers)
+                    self.assertIs(type(new), type(obj))
+                    self.assertEqual(new, obj)
+                    if type(obj) is bytes:
+                        # Zero-copy achieved when the buffer is a bytes object
+                        self.assertIs(self.loads(data, buffers=[obj]), obj)
+
+                    # A true value from buffer_callback keeps it in-band
+                    data = self.dumps(obj, proto,
+                                      buffer_callback=lambda pb: True,
+                                      buffer_threshold=8)
+                    self.assertEqual(count_opcode(pickle.NEXT_BUFFER, data), 0)
+                    new = self.loads(data)
+                    self.assertIs(type(new), type(obj))
+                    self.assertEqual(new, obj)
+
+                    # Smaller objects are pickled as usual
+                    buffers = []
+                    data = self.dumps(obj, proto,
+                                      buffer_callback=buffers.append,
+                                      buffer_threshold=1000)
+                    self.assertEqual(buffers, [])
+                    self.assertEqual(data, self.dumps(obj, proto))
+
+    def test_buffer_threshold_shared(self):
+        b = b"x" * 100
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            buffers = []
+            data = self.dumps([b, b, b"y"], proto,
+                              buffer_callback=buffers.append,
+                              buffer_threshold=10)
+            self.assertEqual(len(buffers), 1)
+            new = self.loads(data, buffers=buffers)
+            self.assertEqual(new, [b, b, b"y"])
+            self.assertIs(new[0], new[1])
+
+    def test_buffer_threshold_registered_reducer(self):
+        # A reducer registered for array.array takes precedence
+        import array
+        import copyreg
+        def reduce_array(a):
+            return array.array, (a.typecode, a.tolist())
+        obj = array.array('i', range(8))
+        self.assertNotIn(array.array, copyreg.dispatch_table)
+        copyreg.pickle(array.array, reduce_array)
+        try:
+            for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+                with self.subTest(proto=proto):
+                    buffers = []
+                    data = self.dumps(obj, proto,
+                                      buffer_callback=buffers.append,
+                                      buffer_threshold=8)
+                    self.assertEqual(buffers, [])
+                    self.assertEqual(data, self.dumps(obj, proto))
+                    self.assertEqual(self.loads(data), obj)
+        finally:
+            del copyreg.dispatch_table[array.array]
+
+    def test_buffer_threshold_error(self):
+        for proto in range(0, 5):
+            with self.assertRaises(ValueError):
+                self.dumps(b"foo", proto, buffer_callback=[].append,
+                           buffer_threshold=0)
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            with self.assertRaises(ValueError):
+                self.dumps(b"foo", proto, buffer_threshold=0)
+            with self.assertRaises(ValueError):
+                self.dumps(b"foo", proto, buffer_callback=[].append,
+                           buffer_threshold=-1)
+            with self.assertRaises(TypeError):
+                self.dumps(b"foo", proto, buffer_callback=[].append,
+                           buffer_threshold=1.0)
+
+    def test_memoize_strings(self):
+        s = 'spam' * 10
+        b = b'eggs' * 10
+        for proto in protocols:
+            objs = [[s, s]]
+            if proto >= 3:
+                objs.append([b, b])
+            for obj in objs:
+                with self.subTest(proto=proto, obj=obj):
+                    memoized = self.dumps(obj, proto)
+                    data = self.dumps(obj, proto, memoize_strings=False)
+                    self.assertEqual(self.loads(data), obj)
+                    self.assertGreater(len(data), len(memoized))
+                    for opcode in (pickle.GET, pickle.BINGET,
+                                   pickle.LONG_BINGET):
+                        self.assertFalse(opcode_in_pickle(opcode, data))
+
     def test_buffers_error(self):
         pb = pickle.PickleBuffer(b"foobar")
         for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
@@ -4426,6 +4534,40 @@ class ComplexNewObjEx(SimpleNewObj):
     def __getnewargs_ex__(self):
         return ('%X' % self,), {'base': 16}
 
+class SlotsObj:
+    __slots__ = ('a', 'b')
+    def __init__(self, a, b=None):
+        self.a = a
+        if b is not None:
+            self.b = b
+    def __eq__(self, other):
+        return (type(self) is type(other) and
+                getattr(self, 'a', None) == getattr(other, 'a', None) and
+                getattr(self, 'b', None) == getattr(other, 'b', None))
+
+class GetstateObj:
+    def __init__(self, value):
+        self.value = value
+        self.cache = object()
+    def __getstate__(self):
+        return {'value': self.value}
+    def __eq__(self, other):
+        return type(self) is type(other) and self.value == other.value
+
+PointNT = collections.namedtuple('PointNT', 'x y')
+
+class GetattributeReducer:
+    reduce_to = None
+    def __init__(self, reduce_to=None):
+        self.reduce_to = reduce_to
+    def __getattribute__(self, name):
+        reduce_to = object.__getattribute__(self, 'reduce_to')
+        if name == '__reduce_ex__' and reduce_to is not None:
+            return lambda proto: (int, (reduce_to,))
+        return object.__getattribute__(self, name)
+    def __eq__(self, other):
+        return type(self) is type(other) and self.reduce_to == other.reduce_to
+
 class BadGetattr:
     def __getattr__(self, key):
         self.foo
@@ -4875,6 +5017,111 @@ class MyPickler(self.pickler_class):
         with self.assertRaises(TypeError):
             pickler.dump(obj)
 
+    def test_many_instances_of_one_class(self):
+        # The pickler may skip the reduction of an object whose class
+        # reduces the default way, but the pickle must not change.
+        def make_c(i):
+            c = C()
+            c.i = i
+            c.name = 'c%d' % (i % 3)
+            return c
+        seqs = [
+            [make_c(i) for i in range(5)],
+            [C() for i in range(3)],
+            [PointNT(i, -i) for i in range(5)],
+            [SlotsObj(i, None if i % 2 else -i) for i in range(5)],
+            [SlotsObj.__new__(SlotsObj) for i in range(3)],
+            [GetstateObj(i) for i in range(5)],
+            [SimpleNewObj.__new__(SimpleNewObj, i) for i in range(5)],
+            [ComplexNewObj.__new__(ComplexNewObj, i) for i in range(5)],
+            [ComplexNewObjEx.__new__(ComplexNewObjEx, i) for i in range(5)],
+        ]
+        recursive = [C() for i in range(3)]
+        for c in recursive:
+            c.me = c
+            c.all = recursive
+        seqs.append(recursive)
+        for proto in protocols[2:]:
+            class SlowPickler(self.pickler_class):
+                def reducer_override(self, obj):
+                    if type(obj) in types:
+                        return obj.__reduce_ex__(proto)
+                    return NotImplemented
+            for objs in seqs:
+                types = {type(obj) for obj in objs}
+                with self.subTest(proto=proto, type=type(objs[0])):
+                    f = io.BytesIO()
+                    self.pickler_class(f, proto).dump(objs)
+                    data = f.getvalue()
+                    f = io.BytesIO()
+                    SlowPickler(f, proto).dump(objs)
+                    self.assertEqual(data, f.getvalue())
+                    new = self.unpickler_class(io.BytesIO(data)).load()
+                    if objs is recursive:
+                        self.assertIs(new[0].me, new[0])
+                        self.assertIs(new[1].all, new)
+                    else:
+                        self.assertEqual(new, objs)
+
+    def test_instance_reducer_after_cached_instance(self):
+        # A reducer found on the instance is used even if another instance
+        # of the same class was saved before.
+        a1, a2 = C(), C()
+        a2.__reduce_ex__ = lambda proto: (int, (5,))
+        g1, g2 = GetattributeReducer(), GetattributeReducer(7)
+        def dumps(obj, proto):
+            f = io.BytesIO()
+            self.pickler_class(f, proto).dump(obj)
+            return f.getvalue()
+        def loads(data):
+            return self.unpickler_class(io.BytesIO(data)).load()
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                new = loads(dumps([a1, a2, a1, g1, g2, g1], proto))
+                self.assertEqual(new[:3], [a1, 5, a1])
+                self.assertIs(new[2], new[0])
+                self.assertEqual(new[3:], [g1, 7, g1])
+                self.assertEqual(loads(dumps(a2, proto)), 5)
+
+    def test_many_instances_without_state(self):
+        # The default __getstate__() refuses to save the C-level state of
+        # every instance, not only of the first one.
+        class Count(itertools.count):
+            __slots__ = ('x',)
+        for proto in protocols[2:]:
+            with self.subTest(proto=proto):
+                pickler = self.pickler_class(io.BytesIO(), proto)
+                with self.assertRaisesRegex(TypeError, 'cannot pickle'):
+                    pickler.dump([Count(), Count()])
+                objs = [SlotsObj.__new__(SlotsObj), SlotsObj(1)]
+                f = io.BytesIO()
+                self.pickler_class(f, proto).dump(objs)
+                new = self.unpickler_class(io.BytesIO(f.getvalue())).load()
+                self.assertEqual(new[1], objs[1])
+                self.assertFalse(hasattr(new[0], 'a'))
+
+    def test_class_changed_between_dumps(self):
+        objs = [C(), C()]
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                f = io.BytesIO()
+                pickler = self.pickler_class(f, proto)
+                pickler.dump(objs)
+                first = f.getvalue()
+                C.__reduce__ = lambda self: (K, (42,))
+                try:
+                    f.seek(0)
+                    f.truncate()
+                    pickler.clear_memo()
+                    pickler.dump(objs)
+                finally:
+                    del C.__reduce__
+                second = f.getvalue()
+                new = self.unpickler_class(io.BytesIO(first)).load()
+                self.assertEqual(new, objs)
+                new = self.unpickler_class(io.BytesIO(second)).load()
+                self.assertEqual([type(obj) for obj in new], [K, K])
+
 # Tests for dispatch_table attribute
 
 REDUCE_A = 'reduce_A'
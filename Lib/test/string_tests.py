@@ -349,6 +349,37 @@ def check_pattern(rr):
         # Test that empty string always work:
         check_pattern(lambda *args: 0)
 
+    def test_find_short_needles(self):
+        """Cover the word-at-a-time filter for needles up to 24 characters."""
+        def reference_count(p, s):
+            count = i = 0
+            while (i := s.find(p, i)) >= 0:
+                count += 1
+                i += len(p)
+            return count
+
+        rr = random.randrange
+        choices = random.choices
+        for _ in range(1000):
+            p = ''.join(choices('abc', k=rr(2, 25)))
+            text = ''.join(choices('abc', k=rr(100)))
+            with self.subTest(p=p, text=text):
+                expected = -1
+                for i in range(len(text)):
+                    if text.startswith(p, i):
+                        expected = i
+                        break
+                self.checkequal(expected, text, 'find', p)
+                self.checkequal(reference_count(p, text), text, 'count', p)
+
+        # Frequent false positives switch to the two-way algorithm.
+        for p in 'a' * 10 + 'c' + 'a' * 10, 'ab' * 12:
+            text = ('a' * 20 + 'bb') * 500
+            self.checkequal(-1, text, 'find', p)
+            self.checkequal(0, text, 'count', p)
+            self.checkequal(len(text), text + p, 'find', p)
+            self.checkequal(1, text + p + 'a', 'count', p)
+
     def test_find_many_lengths(self):
         haystack_repeats = [a * 10**e for e in range(6) for a in (1,2,5)]
         haystacks = [(n, self.fixtype("abcab"*n + "da")) for n in haystack_repeats]
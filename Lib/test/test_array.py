@@ -187,6 +187,23 @@ def test_numbers(self):
                     array.array, typecode, mformat_code, arraystr)
                 self.assertEqual(a, b,
                     msg="{0!r} != {1!r}; testcase={2!r}".format(a, b, testcase))
+                b = array_reconstructor(
+                    array.array, typecode, mformat_code, bytearray(arraystr))
+                self.assertEqual(a, b)
+
+    def test_buffer(self):
+        a = array.array('i', range(10))
+        mformat_code = a.__reduce_ex__(3)[1][2]
+        for items in (bytearray(a), memoryview(a), memoryview(bytes(a))[::1],
+                      pickle.PickleBuffer(a)):
+            with self.subTest(items=items):
+                b = array_reconstructor(array.array, 'i', mformat_code, items)
+                self.assertEqual(a, b)
+                self.assertIsNot(a, b)
+        self.assertRaises(ValueError, array_reconstructor,
+                          array.array, 'i', mformat_code, bytearray(b'abc'))
+        self.assertRaises(BufferError, array_reconstructor,
+                          array.array, 'i', mformat_code, memoryview(a)[::2])
 
     def test_unicode(self):
         teststr = "Bonne Journ\xe9e \U0002030a\U00020347"
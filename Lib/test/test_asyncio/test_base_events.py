@@ -1,9 +1,11 @@
 """Tests for base_events.py"""
 
+import collections
 import concurrent.futures
 import errno
 import math
 import platform
+import random
 import socket
 import sys
 import threading
@@ -1050,6 +1052,137 @@ def test_asyncgen_finalization_by_gc_in_other_thread(self):
             self.assertTrue(status['finalized'])
 
 
+class BaseTimerHeapTests:
+
+    def setUp(self):
+        super().setUp()
+        self.loop = base_events.BaseEventLoop()
+        self.set_event_loop(self.loop)
+
+    def timer(self, when, callback=None):
+        return asyncio.TimerHandle(when, callback or (lambda: None), (),
+                                   self.loop, None)
+
+    def assertHeap(self, heap):
+        for i in range(1, len(heap)):
+            self.assertLessEqual(heap[(i - 1) // 2]._when, heap[i]._when)
+
+    def test_schedule_and_pop_due(self):
+        rnd = random.Random(42)
+        scheduled = []
+        timers = [self.timer(rnd.random() * 100) for _ in range(500)]
+        for timer in timers:
+            self.schedule_timer(scheduled, timer)
+            self.assertTrue(timer._scheduled)
+        self.assertHeap(scheduled)
+
+        ready = collections.deque()
+        self.pop_due_timers(scheduled, ready, 50.0)
+        self.assertEqual(list(ready),
+                         sorted((t for t in timers if t._when < 50.0),
+                                key=lambda t: t._when))
+        self.assertTrue(all(not t._scheduled for t in ready))
+        self.assertTrue(all(t._when >= 50.0 for t in scheduled))
+        self.assertHeap(scheduled)
+
+        self.pop_due_timers(scheduled, ready, 1000.0)
+        self.assertEqual(scheduled, [])
+        self.assertEqual(list(ready), sorted(timers, key=lambda t: t._when))
+
+    def test_mixed_when_types(self):
+        scheduled = []
+        for when in (3, 1.5, 2, 0.5):
+            self.schedule_timer(scheduled, self.timer(when))
+        ready = collections.deque()
+        self.pop_due_timers(scheduled, ready, 2)
+        self.assertEqual([t._when for t in ready], [0.5, 1.5])
+        self.assertEqual(sorted(t._when for t in scheduled), [2, 3])
+
+    def test_pop_cancelled_timers(self):
+        scheduled = []
+        timers = [self.timer(when) for when in range(10)]
+        for timer in timers:
+            self.schedule_timer(scheduled, timer)
+        for timer in timers[:3] + timers[5:7]:
+            timer.cancel()
+        self.assertEqual(self.pop_cancelled_timers(scheduled), 3)
+        self.assertEqual(len(scheduled), 7)
+        self.assertIs(scheduled[0], timers[3])
+        self.assertFalse(timers[0]._scheduled)
+        self.assertTrue(timers[5]._scheduled)
+        self.assertEqual(self.pop_cancelled_timers(scheduled), 0)
+
+    def test_remove_cancelled_timers(self):
+        rnd = random.Random(7)
+        scheduled = []
+        timers = [self.timer(rnd.random()) for _ in range(300)]
+        for timer in timers:
+            self.schedule_timer(scheduled, timer)
+        cancelled = timers[::3]
+        for timer in cancelled:
+            timer.cancel()
+        self.remove_cancelled_timers(scheduled)
+        self.assertEqual(len(scheduled), len(timers) - len(cancelled))
+        self.assertTrue(all(not t._cancelled for t in scheduled))
+        self.assertTrue(all(not t._scheduled for t in cancelled))
+        self.assertHeap(scheduled)
+
+    def test_run_ready(self):
+        calls = []
+        handles = [self.loop.call_soon(calls.append, i) for i in range(5)]
+        handles[1].cancel()
+        ready = self.loop._ready
+        self.run_ready(ready, 3)
+        self.assertEqual(calls, [0, 2])
+        self.assertEqual(list(ready), handles[3:])
+
+    def test_run_ready_propagates_base_exception(self):
+        def cb():
+            raise KeyboardInterrupt
+        calls = []
+        self.loop.call_soon(cb)
+        self.loop.call_soon(calls.append, 1)
+        ready = self.loop._ready
+        with self.assertRaises(KeyboardInterrupt):
+            self.run_ready(ready, 2)
+        self.assertEqual(calls, [])
+        self.assertEqual(len(ready), 1)
+
+
+class PyTimerHeapTests(BaseTimerHeapTests, test_utils.TestCase):
+    schedule_timer = staticmethod(base_events._py_schedule_timer)
+    pop_cancelled_timers = staticmethod(base_events._py_pop_cancelled_timers)
+    remove_cancelled_timers = staticmethod(
+        base_events._py_remove_cancelled_timers)
+    pop_due_timers = staticmethod(base_events._py_pop_due_timers)
+    run_ready = staticmethod(base_events._py_run_ready)
+
+
+@unittest.skipUnless(hasattr(base_events, '_c_run_ready'),
+                     'requires the C _asyncio module')
+class CTimerHeapTests(BaseTimerHeapTests, test_utils.TestCase):
+    if hasattr(base_events, '_c_run_ready'):
+        schedule_timer = staticmethod(base_events._c_schedule_timer)
+        pop_cancelled_timers = staticmethod(
+            base_events._c_pop_cancelled_timers)
+        remove_cancelled_timers = staticmethod(
+            base_events._c_remove_cancelled_timers)
+        pop_due_timers = staticmethod(base_events._c_pop_due_timers)
+        run_ready = staticmethod(base_events._c_run_ready)
+
+    def test_list_mutated_during_comparison(self):
+        scheduled = []
+
+        class When(float):
+            def __lt__(self, other):
+                scheduled.clear()
+                return NotImplemented
+
+        self.schedule_timer(scheduled, self.timer(1.0))
+        with self.assertRaises(RuntimeError):
+            self.schedule_timer(scheduled, self.timer(When(0.5)))
+
+
 class MyProto(asyncio.Protocol):
     done = None
 
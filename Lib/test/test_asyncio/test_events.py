@@ -2366,6 +2366,44 @@ class PollEventLoopTests(EventLoopTestsMixin,
             def create_event_loop(self):
                 return asyncio.SelectorEventLoop(selectors.PollSelector())
 
+    @unittest.skipUnless(test_utils.has_io_uring(), 'requires io_uring')
+    class IoUringEventLoopTests(EventLoopTestsMixin,
+                                SubprocessTestsMixin,
+                                test_utils.TestCase):
+
+        def create_event_loop(self):
+            return asyncio.IoUringEventLoop()
+
+        def test_reader_callback(self):
+            raise unittest.SkipTest("IoUringEventLoop does not have add_reader()")
+
+        def test_reader_callback_cancel(self):
+            raise unittest.SkipTest("IoUringEventLoop does not have add_reader()")
+
+        def test_writer_callback(self):
+            raise unittest.SkipTest("IoUringEventLoop does not have add_writer()")
+
+        def test_writer_callback_cancel(self):
+            raise unittest.SkipTest("IoUringEventLoop does not have add_writer()")
+
+        def test_remove_fds_after_closing(self):
+            raise unittest.SkipTest("IoUringEventLoop does not have add_reader()")
+
+        def test_unclosed_pipe_transport(self):
+            raise unittest.SkipTest("Specific to selector pipe transports")
+
+        # Writes issued while the previous one has not been reported
+        # complete by the event loop are buffered by the transport.
+
+        def test_write_pipe(self):
+            raise unittest.SkipTest("IoUringEventLoop buffers pending writes")
+
+        def test_bidirectional_pty(self):
+            raise unittest.SkipTest("IoUringEventLoop buffers pending writes")
+
+        def test_write_pty(self):
+            raise unittest.SkipTest("IoUringEventLoop buffers pending writes")
+
     # Should always exist.
     class SelectEventLoopTests(EventLoopTestsMixin,
                                SubprocessTestsMixin,
@@ -2806,6 +2844,8 @@ async def inner():
                 await loop.sock_recv_into(f, 10)
             with self.assertRaises(NotImplementedError):
                 await loop.sock_sendall(f, 10)
+            with self.assertRaises(NotImplementedError):
+                await loop.sock_sendall_zerocopy(f, 10)
             with self.assertRaises(NotImplementedError):
                 await loop.sock_connect(f, f)
             with self.assertRaises(NotImplementedError):
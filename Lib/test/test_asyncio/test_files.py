@@ -0,0 +1,214 @@
+import io
+import os
+import threading
+import time
+import unittest
+
+from test import support
+from test.support import os_helper
+from test.test_asyncio import utils as test_utils
+
+import asyncio
+
+
+def tearDownModule():
+    asyncio._set_event_loop_policy(None)
+
+
+class FileTestsMixin:
+
+    def new_loop(self):
+        raise NotImplementedError
+
+    def setUp(self):
+        super().setUp()
+        self.loop = self.new_loop()
+        self.set_event_loop(self.loop)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+
+    def run_loop(self, coro):
+        return self.loop.run_until_complete(coro)
+
+    def test_write_read(self):
+        async def main():
+            async with await asyncio.open_file(os_helper.TESTFN, 'w') as f:
+                self.assertEqual(await f.write(b'hello '), 6)
+                self.assertEqual(await f.write(memoryview(b'world')), 5)
+                self.assertEqual(f.tell(), 11)
+            self.assertTrue(f.closed)
+
+            async with await asyncio.open_file(os_helper.TESTFN) as f:
+                self.assertEqual(await f.read(5), b'hello')
+                self.assertEqual(f.tell(), 5)
+                self.assertEqual(await f.read(), b' world')
+                self.assertEqual(await f.read(5), b'')
+                f.seek(6)
+                buf = bytearray(10)
+                self.assertEqual(await f.readinto(memoryview(buf)[2:]), 5)
+                self.assertEqual(buf, b'\0\0world\0\0\0')
+
+        self.run_loop(main())
+
+    def test_readall(self):
+        data = os.urandom(3 * 1024 * 1024 + 1)
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(data)
+
+        async def main():
+            async with await asyncio.open_file(os_helper.TESTFN) as f:
+                self.assertEqual(await f.readall(), data)
+                f.seek(1000)
+                self.assertEqual(await f.read(-1), data[1000:])
+                self.assertEqual(await f.readall(), b'')
+
+        self.run_loop(main())
+
+    def test_readall_pipe(self):
+        r, w = os.pipe()
+
+        def writer():
+            with open(w, 'wb') as f:
+                for i in range(10):
+                    f.write(b'x' * 10000)
+
+        async def main():
+            thread = threading.Thread(target=writer)
+            thread.start()
+            try:
+                async with asyncio.AsyncFileIO(io.FileIO(r)) as f:
+                    self.assertEqual(await f.read(), b'x' * 100000)
+            finally:
+                thread.join()
+
+        self.run_loop(main())
+
+    def test_append(self):
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(b'abc')
+
+        async def main():
+            async with await asyncio.open_file(os_helper.TESTFN, 'a+') as f:
+                await f.write(b'def')
+                f.seek(0)
+                self.assertEqual(await f.read(), b'abcdef')
+
+        self.run_loop(main())
+
+    def test_concurrent_files(self):
+        async def copy(i):
+            name = f'{os_helper.TESTFN}_{i}'
+            self.addCleanup(os_helper.unlink, name)
+            data = str(i).encode() * 1000
+            async with await asyncio.open_file(name, 'w+') as f:
+                await f.write(data)
+                f.seek(0)
+                return await f.read() == data
+
+        async def main():
+            return await asyncio.gather(*[copy(i) for i in range(10)])
+
+        self.assertEqual(self.run_loop(main()), [True] * 10)
+
+    def test_errors(self):
+        async def main():
+            with self.assertRaises(FileNotFoundError):
+                await asyncio.open_file(os_helper.TESTFN)
+            async with await asyncio.open_file(os_helper.TESTFN, 'w') as f:
+                with self.assertRaises(io.UnsupportedOperation):
+                    await f.read(1)
+                with self.assertRaises(io.UnsupportedOperation):
+                    await f.readinto(bytearray(1))
+            with self.assertRaises(ValueError):
+                await f.write(b'x')
+            async with await asyncio.open_file(os_helper.TESTFN) as f:
+                with self.assertRaises(io.UnsupportedOperation):
+                    await f.write(b'x')
+            with self.assertRaises(ValueError):
+                await f.read()
+            with self.assertRaises(ValueError):
+                await asyncio.open_file(os_helper.TESTFN, 'rt')
+
+        self.run_loop(main())
+        with self.assertRaises(TypeError):
+            asyncio.AsyncFileIO(io.BytesIO())
+
+    def test_attributes(self):
+        async def main():
+            f = await asyncio.open_file(os_helper.TESTFN, 'w')
+            try:
+                self.assertIsInstance(f.raw, io.FileIO)
+                self.assertEqual(f.name, os_helper.TESTFN)
+                self.assertEqual(f.mode, 'wb')
+                self.assertEqual(f.fileno(), f.raw.fileno())
+                self.assertFalse(f.readable())
+                self.assertTrue(f.writable())
+                self.assertTrue(f.seekable())
+                self.assertIn('mode=', repr(f))
+            finally:
+                f.close()
+            self.assertIn('closed', repr(f))
+
+        self.run_loop(main())
+
+
+class SelectorFileTests(FileTestsMixin, test_utils.TestCase):
+
+    def new_loop(self):
+        return asyncio.SelectorEventLoop()
+
+    def test_file_executor(self):
+        async def main():
+            async with await asyncio.open_file(os_helper.TESTFN, 'w') as f:
+                await f.write(b'x')
+            return self.loop._file_executor
+
+        executor = self.run_loop(main())
+        self.assertIsNotNone(executor)
+        self.assertIsNone(self.loop._default_executor)
+        self.loop.close()
+        self.assertIsNone(self.loop._file_executor)
+
+    def test_shutdown_default_executor(self):
+        # asyncio.run() waits for the file operations still running.
+        started = threading.Event()
+        done = threading.Event()
+        def slow_op():
+            started.set()
+            time.sleep(0.1)
+            done.set()
+
+        async def main():
+            self.loop._run_file_op(slow_op)
+            started.wait(support.SHORT_TIMEOUT)
+            await self.loop.shutdown_default_executor()
+            self.assertTrue(done.is_set())
+            with self.assertRaises(RuntimeError):
+                await asyncio.open_file(os_helper.TESTFN, 'w')
+
+        self.run_loop(main())
+
+
+@unittest.skipUnless(test_utils.has_io_uring(), 'io_uring is not available')
+class IoUringFileTests(FileTestsMixin, test_utils.TestCase):
+
+    def new_loop(self):
+        return asyncio.IoUringEventLoop()
+
+    def test_no_thread(self):
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(b'data')
+
+        async def main():
+            f = asyncio.AsyncFileIO(io.FileIO(os_helper.TESTFN, 'r+'))
+            async with f:
+                self.assertEqual(await f.read(), b'data')
+                await f.write(b'more')
+                f.seek(0)
+                self.assertEqual(await f.read(), b'datamore')
+
+        self.run_loop(main())
+        self.assertIsNone(self.loop._file_executor)
+
+
+if __name__ == '__main__':
+    unittest.main()
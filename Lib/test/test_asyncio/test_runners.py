@@ -1,11 +1,16 @@
 import _thread
 import asyncio
 import contextvars
+import os
 import re
 import signal
+import socket
 import sys
 import threading
 import unittest
+from test import support
+from test.support import socket_helper
+from test.support import threading_helper
 from test.test_asyncio import utils as test_utils
 from unittest import mock
 from unittest.mock import patch
@@ -523,5 +528,169 @@ async def coro():
         self.assertEqual(0, result.repr_count)
 
 
+class LoopGroupTests(unittest.TestCase):
+
+    def new_group(self, size=2):
+        group = asyncio.LoopGroup(size, loop_factory=asyncio.EventLoop)
+        self.addCleanup(group.close)
+        return group
+
+    def test_invalid_size(self):
+        with self.assertRaises(ValueError):
+            asyncio.LoopGroup(0)
+
+    def test_default_size(self):
+        group = asyncio.LoopGroup()
+        self.assertEqual(group._size, os.process_cpu_count() or 1)
+        # The threads are only started when the group is used.
+        self.assertEqual(group._threads, [])
+        group.close()
+
+    def test_get_loops(self):
+        with asyncio.LoopGroup(3, loop_factory=asyncio.EventLoop) as group:
+            loops = group.get_loops()
+            self.assertEqual(len(set(loops)), 3)
+            for loop in loops:
+                self.assertTrue(loop.is_running())
+        for loop in loops:
+            self.assertTrue(loop.is_closed())
+
+    def test_submit(self):
+        async def get_loop(x):
+            await asyncio.sleep(0)
+            return x, asyncio.get_running_loop()
+
+        group = self.new_group()
+        future = group.submit(get_loop(42))
+        x, loop = future.result(support.SHORT_TIMEOUT)
+        self.assertEqual(x, 42)
+        self.assertIn(loop, group.get_loops())
+
+    def test_submit_least_busy(self):
+        group = self.new_group(3)
+        release = threading.Event()
+
+        async def wait():
+            await asyncio.to_thread(release.wait)
+            return asyncio.get_running_loop()
+
+        futures = [group.submit(wait()) for _ in range(3)]
+        release.set()
+        loops = [f.result(support.SHORT_TIMEOUT) for f in futures]
+        self.assertEqual(set(loops), set(group.get_loops()))
+        self.assertEqual(group._load, [0, 0, 0])
+
+    def test_submit_exception(self):
+        async def fail():
+            raise ZeroDivisionError
+
+        group = self.new_group()
+        with self.assertRaises(ZeroDivisionError):
+            group.submit(fail()).result(support.SHORT_TIMEOUT)
+        with self.assertRaises(TypeError):
+            group.submit(fail)
+        self.assertEqual(group._load, [0, 0])
+
+    def test_submit_each(self):
+        async def get_loop(x):
+            return x, asyncio.get_running_loop()
+
+        group = self.new_group(3)
+        futures = group.submit_each(get_loop, 'x')
+        results = [f.result(support.SHORT_TIMEOUT) for f in futures]
+        self.assertEqual([x for x, _ in results], ['x'] * 3)
+        self.assertEqual(tuple(loop for _, loop in results), group.get_loops())
+
+    @unittest.skipUnless(hasattr(socket, 'SO_REUSEPORT'), 'needs SO_REUSEPORT')
+    def test_reuse_port_servers(self):
+        async def handle(reader, writer):
+            writer.write(await reader.readline())
+            await writer.drain()
+            writer.close()
+
+        group = self.new_group()
+        sock = socket.create_server((socket_helper.HOST, 0), reuse_port=True)
+        port = sock.getsockname()[1]
+        sock.close()
+
+        async def serve():
+            server = await asyncio.start_server(
+                handle, socket_helper.HOST, port, reuse_port=True)
+            await server.start_serving()
+            return server
+
+        servers = [f.result(support.SHORT_TIMEOUT)
+                   for f in group.submit_each(serve)]
+
+        async def client(i):
+            reader, writer = await asyncio.open_connection(
+                socket_helper.HOST, port)
+            writer.write(b'%d\n' % i)
+            line = await reader.readline()
+            writer.close()
+            await writer.wait_closed()
+            return line
+
+        async def main():
+            return await asyncio.gather(*(client(i) for i in range(10)))
+
+        lines = asyncio.run(main(), loop_factory=asyncio.EventLoop)
+        self.assertEqual(lines, [b'%d\n' % i for i in range(10)])
+        for server, loop in zip(servers, group.get_loops()):
+            asyncio.run_coroutine_threadsafe(
+                _close_server(server), loop).result(support.SHORT_TIMEOUT)
+
+    def test_close_cancels_tasks(self):
+        started = threading.Event()
+        cancelled = threading.Event()
+
+        async def forever():
+            started.set()
+            try:
+                await asyncio.Future()
+            except asyncio.CancelledError:
+                cancelled.set()
+                raise
+
+        group = self.new_group()
+        future = group.submit(forever())
+        self.assertTrue(started.wait(support.SHORT_TIMEOUT))
+        group.close()
+        self.assertTrue(cancelled.is_set())
+        self.assertTrue(future.cancelled())
+        for thread in group._threads:
+            self.assertFalse(thread.is_alive())
+        with self.assertRaisesRegex(RuntimeError, 'is closed'):
+            group.submit(forever())
+        # Closing twice is allowed.
+        group.close()
+
+    def test_close_from_loop(self):
+        group = self.new_group()
+
+        async def close():
+            group.close()
+
+        with self.assertRaisesRegex(RuntimeError, 'cannot be called'):
+            group.submit(close()).result(support.SHORT_TIMEOUT)
+
+    def test_loop_factory_error(self):
+        def loop_factory():
+            raise ZeroDivisionError
+
+        group = asyncio.LoopGroup(2, loop_factory=loop_factory)
+        with threading_helper.catch_threading_exception() as cm:
+            with self.assertRaises(ZeroDivisionError):
+                group.get_loops()
+            self.assertIs(cm.exc_type, ZeroDivisionError)
+        with self.assertRaisesRegex(RuntimeError, 'is closed'):
+            group.get_loops()
+
+
+async def _close_server(server):
+    server.close()
+    await server.wait_closed()
+
+
 if __name__ == '__main__':
     unittest.main()
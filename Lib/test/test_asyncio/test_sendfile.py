@@ -573,6 +573,13 @@ class PollEventLoopTests(SendfileTestsBase,
             def create_event_loop(self):
                 return asyncio.SelectorEventLoop(selectors.PollSelector())
 
+    @unittest.skipUnless(test_utils.has_io_uring(), 'requires io_uring')
+    class IoUringEventLoopTests(SendfileTestsBase,
+                                test_utils.TestCase):
+
+        def create_event_loop(self):
+            return asyncio.IoUringEventLoop()
+
     # Should always exist.
     class SelectEventLoopTests(SendfileTestsBase,
                                test_utils.TestCase):
@@ -1,5 +1,6 @@
 import socket
 import asyncio
+import os
 import sys
 import unittest
 
@@ -384,6 +385,39 @@ def test_huge_content_recvinto(self):
             self.loop.run_until_complete(
                 self._basetest_huge_content_recvinto(httpd.address))
 
+    async def _basetest_sock_sendall_zerocopy(self, wsock, rsock):
+        data = bytearray(os.urandom(1024 * 1024))
+        task = asyncio.create_task(
+            self.loop.sock_sendall_zerocopy(wsock, data))
+        received = bytearray()
+        while len(received) < len(data):
+            received += await self.loop.sock_recv(rsock, 1024 * 1024)
+        await task
+        self.assertEqual(received, data)
+        # The buffer is no longer used by the kernel.
+        self.assertEqual(getattr(wsock, 'zerocopy_pending', 0), 0)
+        data.clear()
+
+    def test_sock_sendall_zerocopy(self):
+        with socket.create_server(('127.0.0.1', 0)) as listener:
+            wsock = socket.create_connection(listener.getsockname())
+            rsock, _ = listener.accept()
+        with wsock, rsock:
+            wsock.setblocking(False)
+            rsock.setblocking(False)
+            self.loop.run_until_complete(
+                self._basetest_sock_sendall_zerocopy(wsock, rsock))
+
+    def test_sock_sendall_zerocopy_unsupported(self):
+        # Falls back to sock_sendall() for sockets which do not support
+        # zero-copy send.
+        wsock, rsock = socket.socketpair()
+        with wsock, rsock:
+            wsock.setblocking(False)
+            rsock.setblocking(False)
+            self.loop.run_until_complete(
+                self._basetest_sock_sendall_zerocopy(wsock, rsock))
+
     async def _basetest_datagram_recvfrom(self, server_address):
         # Happy path, sock.sendto() returns immediately
         data = b'\x01' * 4096
@@ -667,6 +701,13 @@ class PollEventLoopTests(BaseSockTestsMixin,
             def create_event_loop(self):
                 return asyncio.SelectorEventLoop(selectors.PollSelector())
 
+    @unittest.skipUnless(test_utils.has_io_uring(), 'requires io_uring')
+    class IoUringEventLoopTests(BaseSockTestsMixin,
+                                test_utils.TestCase):
+
+        def create_event_loop(self):
+            return asyncio.IoUringEventLoop()
+
     # Should always exist.
     class SelectEventLoopTests(BaseSockTestsMixin,
                                test_utils.TestCase):
@@ -13,6 +13,7 @@
     ssl = None
 
 import asyncio
+from asyncio import streams
 from test.test_asyncio import utils as test_utils
 from test.support import socket_helper
 
@@ -133,6 +134,26 @@ def test_feed_nonempty_data(self):
         stream.feed_data(self.DATA)
         self.assertEqual(self.DATA, stream._buffer)
 
+    def test_feed_data_with_get_buffer(self):
+        stream = asyncio.StreamReader(limit=5, loop=self.loop)
+        transport = mock.Mock()
+        stream.set_transport(transport)
+        read_task = self.loop.create_task(stream.readline())
+        test_utils.run_briefly(self.loop)
+
+        buf = stream._get_buffer(-1)
+        buf[:6] = b'line1\n'
+        stream._buffer_updated(6)
+        self.assertEqual(self.loop.run_until_complete(read_task), b'line1\n')
+        self.assertFalse(transport.pause_reading.called)
+
+        buf = stream._get_buffer(100)
+        self.assertGreaterEqual(len(buf), 100)
+        buf[:11] = b'line2\nxyzab'
+        stream._buffer_updated(11)
+        self.assertEqual(b'line2\nxyzab', stream._buffer)
+        self.assertTrue(transport.pause_reading.called)
+
     def test_read_zero(self):
         # Read zero bytes.
         stream = asyncio.StreamReader(loop=self.loop)
@@ -1215,6 +1236,172 @@ async def main():
         main_coro = main()
         asyncio.run(main_coro)
 
+    def test_open_connection_buffered_protocol(self):
+        async def handle(reader, writer):
+            self.assertIsInstance(writer._protocol,
+                                  asyncio.BufferedProtocol)
+            writer.write(await reader.readexactly(200_000))
+            writer.close()
+
+        async def main():
+            server = await asyncio.start_server(handle, socket_helper.HOST, 0)
+            async with server:
+                addr = server.sockets[0].getsockname()
+                reader, writer = await asyncio.open_connection(*addr)
+                self.assertIsInstance(writer._protocol,
+                                      asyncio.BufferedProtocol)
+                data = bytes(range(256)) * 1000
+                writer.write(data)
+                self.assertEqual(await reader.readexactly(200_000),
+                                 data[:200_000])
+                writer.close()
+                await writer.wait_closed()
+
+        self.loop.run_until_complete(main())
+
+
+class BaseStreamBufferTests:
+
+    def test_extend_take(self):
+        buf = self.cls()
+        self.assertEqual(len(buf), 0)
+        self.assertFalse(buf)
+        buf.extend(b'abc')
+        buf.extend(bytearray(b'def'))
+        buf.extend(memoryview(b'ghi'))
+        self.assertEqual(len(buf), 9)
+        self.assertEqual(buf, b'abcdefghi')
+        self.assertNotEqual(buf, b'abc')
+        self.assertEqual(buf.take(2), b'ab')
+        self.assertEqual(buf.take(0), b'')
+        self.assertEqual(bytes(buf), b'cdefghi')
+        self.assertEqual(buf.take(100), b'cdefghi')
+        self.assertEqual(buf, b'')
+        self.assertEqual(buf.take(1), b'')
+        self.assertRaises(ValueError, buf.take, -1)
+        self.assertRaises(TypeError, buf.extend, 'abc')
+
+    def test_find_startswith(self):
+        buf = self.cls()
+        buf.extend(b'xxab\r\ncd\r\n')
+        buf.take(2)
+        self.assertEqual(buf.find(b'\r\n'), 2)
+        self.assertEqual(buf.find(b'\r\n', 3), 6)
+        self.assertEqual(buf.find(b'\r\n', -2), 6)
+        self.assertEqual(buf.find(b'xx'), -1)
+        self.assertEqual(buf.find(b'', 8), 8)
+        self.assertEqual(buf.find(b'', 9), -1)
+        self.assertTrue(buf.startswith(b'ab'))
+        self.assertTrue(buf.startswith(b'\r\n', 2))
+        self.assertTrue(buf.startswith(b''))
+        self.assertFalse(buf.startswith(b'xx'))
+        self.assertFalse(buf.startswith(b'\r\n\r', 6))
+
+    def test_find_empty(self):
+        buf = self.cls()
+        self.assertEqual(buf.find(b'a'), -1)
+        self.assertEqual(buf.find(b'a', -1), -1)
+        self.assertEqual(buf.find(b''), 0)
+        self.assertFalse(buf.startswith(b'a'))
+        buf.extend(b'abc')
+        self.assertEqual(buf.find(b'abcd'), -1)
+        buf.take(3)
+        self.assertEqual(buf.find(b'a'), -1)
+        self.assertEqual(buf.find(b''), 0)
+        self.assertFalse(buf.startswith(b'a'))
+
+    def test_get_buffer(self):
+        buf = self.cls()
+        view = buf.get_buffer(-1)
+        self.assertGreaterEqual(len(view), 65536)
+        view[:5] = b'hello'
+        buf.buffer_updated(5)
+        self.assertEqual(buf, b'hello')
+        # The size of the last get_buffer() result is a hard limit.
+        self.assertRaises(ValueError, buf.buffer_updated, 1)
+        view = buf.get_buffer(10)
+        self.assertRaises(ValueError, buf.buffer_updated, len(view) + 1)
+        buf.buffer_updated(0)
+        self.assertEqual(buf, b'hello')
+
+    def test_get_buffer_large(self):
+        buf = self.cls()
+        buf.extend(b'abc')
+        data = bytes(range(256)) * 4096
+        view = buf.get_buffer(len(data))
+        self.assertGreaterEqual(len(view), len(data))
+        view[:len(data)] = data
+        buf.buffer_updated(len(data))
+        self.assertEqual(buf.take(3), b'abc')
+        self.assertEqual(buf.take(len(data)), data)
+
+    def test_get_buffer_while_exported(self):
+        # Data stays intact when the storage must grow or move while an
+        # earlier get_buffer() result is still alive.
+        buf = self.cls()
+        view1 = buf.get_buffer(10)
+        view1[:3] = b'abc'
+        buf.buffer_updated(3)
+        buf.extend(b'd' * 200_000)
+        view2 = buf.get_buffer(300_000)
+        view2[:2] = b'ef'
+        buf.buffer_updated(2)
+        self.assertEqual(buf.take(4), b'abcd')
+        self.assertEqual(buf.take(200_001), b'd' * 199_999 + b'ef')
+        del view1, view2
+
+    def test_interleaved(self):
+        buf = self.cls()
+        expected = bytearray()
+        for i in range(200):
+            chunk = bytes([i]) * (i * 37 % 1500)
+            view = buf.get_buffer(-1)
+            view[:len(chunk)] = chunk
+            buf.buffer_updated(len(chunk))
+            expected += chunk
+            n = i * 53 % 2000
+            self.assertEqual(buf.take(n), expected[:n])
+            del expected[:n]
+            self.assertEqual(buf, expected)
+
+    def test_clear(self):
+        buf = self.cls()
+        buf.extend(b'abc')
+        view = buf.get_buffer(-1)
+        buf.clear()
+        self.assertEqual(buf, b'')
+        self.assertRaises(ValueError, buf.buffer_updated, 1)
+        buf.extend(b'def')
+        self.assertEqual(buf, b'def')
+
+    def test_repr(self):
+        buf = self.cls()
+        buf.extend(b'ab\0')
+        self.assertEqual(repr(buf), "_StreamBuffer(b'ab\\x00')")
+
+
+class PyStreamBufferTests(BaseStreamBufferTests, unittest.TestCase):
+    cls = streams._PyStreamBuffer
+
+
+@unittest.skipUnless(hasattr(streams, '_CStreamBuffer'),
+                     'requires the C _asyncio module')
+class CStreamBufferTests(BaseStreamBufferTests, unittest.TestCase):
+    cls = getattr(streams, '_CStreamBuffer', None)
+
+    def test_sizeof(self):
+        buf = self.cls()
+        empty = buf.__sizeof__()
+        buf.extend(b'x' * 1000)
+        self.assertGreaterEqual(buf.__sizeof__(), empty + 1000)
+        # Large storage is released once the data has been consumed.
+        buf.extend(b'x' * 1_000_000)
+        buf.take(len(buf))
+        self.assertEqual(buf.__sizeof__(), empty)
+
+    def test_unhashable(self):
+        self.assertRaises(TypeError, hash, self.cls())
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -919,6 +919,14 @@ class SubprocessPidfdWatcherTests(SubprocessWatcherMixin,
 
         pass
 
+    @unittest.skipUnless(test_utils.has_io_uring(), 'requires io_uring')
+    class SubprocessIoUringTests(SubprocessMixin, test_utils.TestCase):
+
+        def setUp(self):
+            super().setUp()
+            self.loop = asyncio.IoUringEventLoop()
+            self.set_event_loop(self.loop)
+
 else:
     # Windows
     class SubprocessProactorTests(SubprocessMixin, test_utils.TestCase):
@@ -0,0 +1,340 @@
+import errno
+import os
+import select
+import signal
+import socket
+import tempfile
+import unittest
+from unittest import mock
+
+from test import support
+from test.support import import_helper
+from test.support import socket_helper
+from test.test_asyncio import utils as test_utils
+
+_uring = import_helper.import_module('_uring')
+
+import asyncio
+from asyncio import uring_events
+
+if not test_utils.has_io_uring():
+    raise unittest.SkipTest('io_uring is not available')
+
+
+def tearDownModule():
+    asyncio._set_event_loop_policy(None)
+
+
+class RingTests(unittest.TestCase):
+
+    def setUp(self):
+        self.ring = _uring.Ring()
+        self.addCleanup(self.ring.close)
+
+    def wait_for(self, op):
+        while op.pending:
+            self.ring.wait(support.SHORT_TIMEOUT)
+        return op.getresult()
+
+    def socketpair(self):
+        a, b = socket.socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+        return a, b
+
+    def test_send_recv(self):
+        a, b = self.socketpair()
+        recv = self.ring.recv(b.fileno(), 100)
+        send = self.ring.send(a.fileno(), b'data')
+        self.assertEqual(self.ring.pending, 2)
+        self.assertEqual(self.wait_for(send), 4)
+        self.assertEqual(self.wait_for(recv), b'data')
+        self.assertEqual(self.ring.pending, 0)
+        self.assertFalse(recv.pending)
+        self.assertEqual(recv.fd, b.fileno())
+
+    def test_recv_into(self):
+        a, b = self.socketpair()
+        buf = bytearray(10)
+        op = self.ring.recv_into(b.fileno(), memoryview(buf)[2:])
+        a.send(b'abc')
+        self.assertEqual(self.wait_for(op), 3)
+        self.assertEqual(buf, b'\0\0abc\0\0\0\0\0')
+
+    def test_partial_send(self):
+        # A send which only partially completes is resubmitted for the
+        # remaining data.
+        a, b = self.socketpair()
+        a.setsockopt(socket.SOL_SOCKET, socket.SO_SNDBUF, 4096)
+        a.setblocking(False)
+        data = os.urandom(4 * 1024 * 1024)
+        send = self.ring.send(a.fileno(), data)
+        received = bytearray()
+        while len(received) < len(data):
+            self.ring.wait(0)
+            received += b.recv(1024 * 1024)
+        self.assertEqual(self.wait_for(send), len(data))
+        self.assertEqual(received, data)
+
+    def test_read_write_offset(self):
+        with tempfile.TemporaryFile() as f:
+            fd = f.fileno()
+            self.assertEqual(self.wait_for(self.ring.write(fd, b'abcdef')), 6)
+            self.assertEqual(self.wait_for(self.ring.write(fd, b'XY', 2)), 2)
+            self.assertEqual(self.wait_for(self.ring.read(fd, 3, 1)), b'bXY')
+            buf = bytearray(4)
+            self.assertEqual(self.wait_for(self.ring.read_into(fd, buf, 0)), 4)
+            self.assertEqual(buf, b'abXY')
+            # Without an offset, the file position is used and updated.
+            self.assertEqual(os.lseek(fd, 0, os.SEEK_CUR), 6)
+
+    def test_read_pipe(self):
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        self.addCleanup(os.close, w)
+        os.set_blocking(r, False)
+        op = self.ring.read(r, 10)
+        self.assertEqual(self.ring.wait(0), [])
+        os.write(w, b'xyz')
+        self.assertEqual(self.wait_for(op), b'xyz')
+
+    def test_accept(self):
+        with socket.create_server((socket_helper.HOST, 0)) as listener:
+            op = self.ring.accept(listener.fileno())
+            with socket.create_connection(listener.getsockname()) as client:
+                fd = self.wait_for(op)
+                with socket.socket(fileno=fd) as conn:
+                    self.assertFalse(conn.get_inheritable())
+                    self.assertEqual(conn.getpeername(), client.getsockname())
+
+    def test_poll(self):
+        a, b = self.socketpair()
+        op = self.ring.poll(b.fileno(), select.POLLIN)
+        self.assertEqual(self.ring.wait(0), [])
+        a.send(b'x')
+        self.assertEqual(self.wait_for(op) & select.POLLIN, select.POLLIN)
+
+    def test_splice(self):
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        self.addCleanup(os.close, w)
+        with tempfile.TemporaryFile() as f:
+            f.write(b'0123456789')
+            f.flush()
+            op = self.ring.splice(f.fileno(), 3, w, -1, 4)
+            self.assertEqual(self.wait_for(op), 4)
+        self.assertEqual(os.read(r, 10), b'3456')
+
+    def test_cancel(self):
+        a, b = self.socketpair()
+        op = self.ring.recv(b.fileno(), 100)
+        self.ring.cancel(op)
+        with self.assertRaises(OSError) as cm:
+            self.wait_for(op)
+        self.assertEqual(cm.exception.errno, errno.ECANCELED)
+        # Cancelling a completed operation does nothing.
+        self.ring.cancel(op)
+
+    def test_error(self):
+        r, w = os.pipe()
+        os.close(r)
+        os.close(w)
+        with self.assertRaises(OSError) as cm:
+            self.wait_for(self.ring.read(r, 10))
+        self.assertEqual(cm.exception.errno, errno.EBADF)
+
+    def test_wait_timeout(self):
+        self.assertEqual(self.ring.wait(0), [])
+        self.assertEqual(self.ring.wait(0.01), [])
+        with self.assertRaises(TypeError):
+            self.ring.wait('1')
+
+    def test_submit(self):
+        a, b = self.socketpair()
+        self.ring.send(a.fileno(), b'data')
+        self.assertEqual(self.ring.submit(), 1)
+        self.assertEqual(b.recv(10), b'data')
+        self.assertEqual(self.ring.submit(), 0)
+
+    def test_close(self):
+        a, b = self.socketpair()
+        op = self.ring.recv(b.fileno(), 100)
+        self.ring.close()
+        self.assertTrue(self.ring.closed)
+        self.assertFalse(op.pending)
+        with self.assertRaises(OSError):
+            op.getresult()
+        self.ring.close()
+        with self.assertRaises(ValueError):
+            self.ring.recv(b.fileno(), 100)
+        with self.assertRaises(ValueError):
+            self.ring.wait(0)
+        with self.assertRaises(ValueError):
+            self.ring.fileno()
+
+    def test_operation_not_instantiable(self):
+        with self.assertRaises(TypeError):
+            type(self.ring.poll(0, 0))()
+
+
+class IoUringEventLoopTests(test_utils.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.loop = asyncio.IoUringEventLoop()
+        self.set_event_loop(self.loop)
+
+    def test_echo_server(self):
+        async def handle(reader, writer):
+            while data := await reader.read(65536):
+                writer.write(data)
+                await writer.drain()
+            writer.close()
+
+        async def main():
+            server = await asyncio.start_server(handle, socket_helper.HOST, 0)
+            async with server:
+                addr = server.sockets[0].getsockname()
+                reader, writer = await asyncio.open_connection(*addr)
+                data = os.urandom(1024 * 1024)
+                writer.write(data)
+                self.assertEqual(await reader.readexactly(len(data)), data)
+                writer.close()
+                await writer.wait_closed()
+
+        self.loop.run_until_complete(main())
+
+    @socket_helper.skip_unless_bind_unix_socket
+    def test_unix_server(self):
+        async def handle(reader, writer):
+            writer.write((await reader.readline()).upper())
+            writer.close()
+
+        async def main():
+            with test_utils.unix_socket_path() as path:
+                server = await asyncio.start_unix_server(handle, path)
+                async with server:
+                    reader, writer = await asyncio.open_unix_connection(path)
+                    writer.write(b'hello\n')
+                    self.assertEqual(await reader.read(), b'HELLO\n')
+                    writer.close()
+                    await writer.wait_closed()
+
+        self.loop.run_until_complete(main())
+
+    def test_signal_handler(self):
+        caught = []
+        self.loop.add_signal_handler(signal.SIGUSR1, caught.append, 1)
+        self.loop.call_soon(os.kill, os.getpid(), signal.SIGUSR1)
+        test_utils.run_until(self.loop, lambda: caught)
+        self.assertEqual(caught, [1])
+        self.assertTrue(self.loop.remove_signal_handler(signal.SIGUSR1))
+
+    def test_sock_recv_cancel(self):
+        a, b = socket.socketpair()
+        with a, b:
+            b.setblocking(False)
+
+            async def main():
+                task = asyncio.create_task(self.loop.sock_recv(b, 10))
+                await asyncio.sleep(0)
+                task.cancel()
+                with self.assertRaises(asyncio.CancelledError):
+                    await task
+                a.send(b'after')
+                self.assertEqual(await self.loop.sock_recv(b, 10), b'after')
+
+            self.loop.run_until_complete(main())
+
+    def test_close_with_pending_operations(self):
+        a, b = socket.socketpair()
+        with a, b:
+            b.setblocking(False)
+            proactor = self.loop._proactor
+            fut = proactor.recv(b, 10)
+            self.loop.close()
+            self.assertTrue(fut.cancelled())
+            self.assertIn('closed', repr(proactor))
+
+    def test_sendfile_updates_position(self):
+        with tempfile.TemporaryFile() as f:
+            data = os.urandom(256 * 1024)
+            f.write(data)
+            a, b = socket.socketpair()
+            with a, b:
+                a.setblocking(False)
+                b.setblocking(False)
+
+                async def recv_all():
+                    received = bytearray()
+                    while len(received) < len(data) - 1000:
+                        received += await self.loop.sock_recv(b, 65536)
+                    return received
+
+                async def main():
+                    task = asyncio.create_task(recv_all())
+                    sent = await self.loop.sock_sendfile(a, f, 1000)
+                    return sent, await task
+
+                sent, received = self.loop.run_until_complete(main())
+            self.assertEqual(sent, len(data) - 1000)
+            self.assertEqual(received, data[1000:])
+            self.assertEqual(f.tell(), len(data))
+
+    def test_sendfile_past_end(self):
+        # The file may shrink after its size was checked: what was actually
+        # sent is reported.
+        with tempfile.TemporaryFile() as f:
+            data = os.urandom(64 * 1024)
+            f.write(data)
+            f.flush()
+            a, b = socket.socketpair()
+            with a, b:
+                a.setblocking(False)
+                b.setblocking(False)
+
+                async def recv_all():
+                    received = bytearray()
+                    while len(received) < len(data) - 1000:
+                        received += await self.loop.sock_recv(b, 65536)
+                    return received
+
+                async def main():
+                    task = asyncio.create_task(recv_all())
+                    sent = await self.loop._proactor.sendfile(
+                        a, f, 1000, len(data))
+                    return sent, await task
+
+                sent, received = self.loop.run_until_complete(main())
+            self.assertEqual(sent, len(data) - 1000)
+            self.assertEqual(received, data[1000:])
+            self.assertEqual(f.tell(), len(data))
+
+
+class NewEventLoopTests(unittest.TestCase):
+
+    def test_io_uring(self):
+        loop = uring_events.new_event_loop()
+        self.addCleanup(loop.close)
+        self.assertIsInstance(loop, asyncio.IoUringEventLoop)
+
+    def test_fallback(self):
+        with mock.patch.object(uring_events, '_uring', None):
+            with self.assertRaises(OSError):
+                uring_events.IoUringProactor()
+            loop = uring_events.new_event_loop()
+        self.addCleanup(loop.close)
+        self.assertIsInstance(loop, asyncio.SelectorEventLoop)
+
+    def test_run(self):
+        async def main():
+            await asyncio.sleep(0)
+            return type(asyncio.get_running_loop())
+
+        self.assertIs(
+            asyncio.run(main(), loop_factory=uring_events.new_event_loop),
+            asyncio.IoUringEventLoop)
+
+
+if __name__ == '__main__':
+    unittest.main()
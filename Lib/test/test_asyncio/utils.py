@@ -563,6 +563,18 @@ def tearDown(self):
         support.reap_children()
 
 
+def has_io_uring():
+    """Return True if asyncio.IoUringEventLoop can be used."""
+    if sys.platform != 'linux':
+        return False
+    from asyncio import uring_events
+    try:
+        uring_events.IoUringProactor().close()
+    except OSError:
+        return False
+    return True
+
+
 @contextlib.contextmanager
 def disable_logger():
     """Context manager to disable asyncio logger.
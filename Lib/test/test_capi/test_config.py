@@ -103,6 +103,7 @@ def test_config_get(self):
         if support.Py_GIL_DISABLED:
             options.append(("enable_gil", int, None))
             options.append(("tlbc_enabled", int, None))
+            options.append(("numa_heaps", bool, None))
         if support.MS_WINDOWS:
             options.extend((
                 ("legacy_windows_stdio", bool, None),
@@ -179,5 +179,57 @@ class PyMemDefaultTests(PyMemDebugTests):
     PYTHONMALLOC = ''
 
 
+@requires_subprocess()
+@unittest.skipUnless(support.Py_GIL_DISABLED, 'need free-threaded build')
+class NumaHeapsTests(unittest.TestCase):
+    def test_numa_heap_stats(self):
+        code = textwrap.dedent("""
+            import _testinternalcapi, threading
+            def work():
+                data = [bytearray(1 << 20) for _ in range(40)]
+            t = threading.Thread(target=work)
+            t.start()
+            t.join()
+            stats = _testinternalcapi.get_numa_heap_stats()
+            assert stats, stats
+            for node, item in stats.items():
+                assert 0 <= item['segments'] <= item['total_segments'], item
+                assert item['bytes'] >= 0, item
+            print(sum(item['total_segments'] for item in stats.values()))
+        """)
+        out = assert_python_ok('-c', code, PYTHON_NUMA_HEAPS='1')
+        self.assertGreater(int(out.out), 0)
+
+        # Without the option, segments are not accounted per node
+        code = ("import _testinternalcapi; "
+                "print(len(_testinternalcapi.get_numa_heap_stats()))")
+        out = assert_python_ok('-c', code, PYTHON_NUMA_HEAPS='0')
+        self.assertEqual(out.out.strip(), b'0')
+
+    def test_numa_heaps_option(self):
+        code = ("import _testinternalcapi; "
+                "print(len(_testinternalcapi.get_numa_heap_stats()) > 0)")
+        out = assert_python_ok('-X', 'numa_heaps', '-c', code)
+        self.assertEqual(out.out.strip(), b'True')
+        out = assert_python_ok('-X', 'numa_heaps=1', '-c', code)
+        self.assertEqual(out.out.strip(), b'True')
+
+        # -X numa_heaps takes precedence over the environment variable
+        out = assert_python_ok('-X', 'numa_heaps=0', '-c', code,
+                               PYTHON_NUMA_HEAPS='1')
+        self.assertEqual(out.out.strip(), b'False')
+
+        # -E and -I ignore the environment variable
+        for opt in ('-E', '-I'):
+            out = assert_python_ok(opt, '-c', code, PYTHON_NUMA_HEAPS='1')
+            self.assertEqual(out.out.strip(), b'False')
+
+        out = assert_python_failure('-X', 'numa_heaps=2', '-c', 'pass')
+        self.assertIn(b'invalid -X numa_heaps option value', out.err)
+        out = assert_python_failure('-c', 'pass', PYTHON_NUMA_HEAPS='yes')
+        self.assertIn(b'invalid PYTHON_NUMA_HEAPS environment variable value',
+                      out.err)
+
+
 if __name__ == "__main__":
     unittest.main()
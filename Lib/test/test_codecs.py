@@ -859,6 +859,31 @@ def test_decoder_state(self):
         self.check_state_handling_decode(self.encoding,
                                          u, u.encode(self.encoding))
 
+    def test_decode_widening_kinds(self):
+        # The kind of the result is computed over the whole input, not from
+        # its first non-ASCII character: put wider characters later, across
+        # word boundaries, after ASCII prefixes of various lengths.
+        pieces = ['a', 'abcdefghij', '\xe9', '\xff\xe0', '\u0100', '\u20ac',
+                  '\uffff', '\U0001f600', '\U0010ffff']
+        for prefix in range(20):
+            for i, first in enumerate(pieces):
+                for second in pieces[i:]:
+                    for third in pieces[i:]:
+                        text = ('x' * prefix + first + 'y' * 7 + second +
+                                third * 3 + 'z')
+                        with self.subTest(text=text):
+                            result = text.encode('utf-8').decode('utf-8')
+                            self.assertEqual(result, text)
+                            self.assertEqual(sys.getsizeof(result),
+                                             sys.getsizeof(text))
+        # Long runs of each kind
+        text = ('a' * 100 + '\xe9' * 100 + '\u20ac' * 100 +
+                '\U0001f600' * 100 + 'a' * 100)
+        for size in range(1, len(text), 37):
+            with self.subTest(size=size):
+                self.assertEqual(text[:size].encode().decode(), text[:size])
+                self.assertEqual(text[-size:].encode().decode(), text[-size:])
+
     def test_decode_error(self):
         for data, error_handler, expected in (
             (b'[\x80\xff]', 'ignore', '[]'),
@@ -549,6 +549,8 @@ class InitConfigTests(EmbeddingTestsMixin, unittest.TestCase):
         PRE_CONFIG_COMPAT.update({
             'legacy_windows_fs_encoding': False,
         })
+    if support.Py_GIL_DISABLED:
+        PRE_CONFIG_COMPAT['numa_heaps'] = False
     PRE_CONFIG_PYTHON = dict(PRE_CONFIG_COMPAT,
         _config_init=API_PYTHON,
         parse_argv=True,
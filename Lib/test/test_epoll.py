@@ -213,6 +213,47 @@ def test_control_and_wait(self):
         expected = [(server.fileno(), select.EPOLLOUT)]
         self.assertEqual(events, expected)
 
+    def test_poll_mapped(self):
+        client, server = self._connected_pair()
+        ep = select.epoll(16)
+        self.addCleanup(ep.close)
+        ep.register(server.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        ep.register(client.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        client.sendall(b"Hello!")
+
+        mapping = {server.fileno(): 'server', client.fileno(): 'client'}
+        readable = (server.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        for _ in support.busy_retry(support.SHORT_TIMEOUT):
+            if readable in ep.poll(0.1):
+                break
+        events = ep.poll_mapped(mapping, timeout=1.0, maxevents=4)
+        expected = [('client', select.EPOLLOUT),
+                    ('server', select.EPOLLIN | select.EPOLLOUT)]
+        self.assertEqual(sorted(events), expected)
+
+        # Descriptors which are not in the mapping are skipped.
+        events = ep.poll_mapped({server.fileno(): 'server'}, 0)
+        self.assertEqual(events,
+                         [('server', select.EPOLLIN | select.EPOLLOUT)])
+        self.assertEqual(ep.poll_mapped({}, 0), [])
+
+        # Any mapping can be used, and its errors are propagated.
+        class Mapping:
+            def __getitem__(self, fd):
+                if fd == server.fileno():
+                    raise KeyError(fd)
+                return fd * 10
+        self.assertEqual(ep.poll_mapped(Mapping(), 0, 100),
+                         [(client.fileno() * 10, select.EPOLLOUT)])
+        class BadMapping:
+            def __getitem__(self, fd):
+                raise ZeroDivisionError
+        self.assertRaises(ZeroDivisionError, ep.poll_mapped, BadMapping(), 0)
+
+        self.assertRaises(ValueError, ep.poll_mapped, mapping, 0, 0)
+        ep.close()
+        self.assertRaises(ValueError, ep.poll_mapped, mapping, 0)
+
     def test_errors(self):
         self.assertRaises(ValueError, select.epoll, -2)
         self.assertRaises(ValueError, select.epoll().register, -1,
@@ -4,6 +4,7 @@
 import os
 import io
 import errno
+import threading
 import unittest
 from array import array
 from weakref import proxy
@@ -16,6 +17,7 @@
 from test.support.os_helper import (
     TESTFN, TESTFN_ASCII, TESTFN_UNICODE, make_bad_fd,
     )
+from test.support import threading_helper
 from test.support.warnings_helper import check_warnings
 from test.support.import_helper import import_module
 from collections import UserList
@@ -84,6 +86,70 @@ def testBlksize(self):
             blksize = getattr(fst, 'st_blksize', blksize)
         self.assertEqual(self.f._blksize, blksize)
 
+    @unittest.skipUnless(hasattr(os, 'pread'), 'requires pread()')
+    def testPositionalIO(self):
+        self.f.close()
+        with self.FileIO(TESTFN, 'w+') as f:
+            f.write(b'0123456789')
+            f.seek(3)
+            self.assertEqual(f.pwrite(b'ab', 2), 2)
+            self.assertEqual(f.pwrite(memoryview(b'XYZ')[1:], 10), 2)
+            self.assertEqual(f.pread(4, 0), b'01ab')
+            self.assertEqual(f.pread(100, 8), b'89YZ')
+            self.assertEqual(f.pread(5, 100), b'')
+            self.assertEqual(f.pread(0, 0), b'')
+            # The file position is untouched
+            self.assertEqual(f.tell(), 3)
+            self.assertRaises(ValueError, f.pread, -1, 0)
+            self.assertRaises(OSError, f.pread, 1, -1)
+            self.assertRaises(TypeError, f.pwrite, 'str', 0)
+
+            if hasattr(os, 'preadv'):
+                a, b = bytearray(3), memoryview(bytearray(4))
+                self.assertEqual(f.preadv([a, b], 1), 7)
+                self.assertEqual(a, b'1ab')
+                self.assertEqual(b, b'4567')
+                self.assertEqual(f.preadv([bytearray(10)], 12), 0)
+                self.assertRaises(BufferError, f.preadv, [b'ro'], 0)
+                self.assertRaises(TypeError, f.preadv, bytearray(1), 0)
+            if hasattr(os, 'pwritev'):
+                self.assertEqual(f.pwritev([b'p', bytearray(b'qr')], 0), 3)
+                self.assertEqual(f.pwritev([], 0), 0)
+                self.assertEqual(f.pread(12, 0), b'pqrb456789YZ')
+            self.assertEqual(f.tell(), 3)
+
+        with self.FileIO(TESTFN, 'r') as f:
+            self.assertRaises(ValueError, f.pwrite, b'x', 0)
+            if hasattr(os, 'pwritev'):
+                self.assertRaises(ValueError, f.pwritev, [b'x'], 0)
+        with self.FileIO(TESTFN, 'a') as f:
+            self.assertRaises(ValueError, f.pread, 1, 0)
+            if hasattr(os, 'preadv'):
+                self.assertRaises(ValueError, f.preadv, [bytearray(1)], 0)
+        self.assertRaises(ValueError, f.pread, 1, 0)
+        self.assertRaises(ValueError, f.pwrite, b'x', 0)
+
+    @unittest.skipUnless(hasattr(os, 'pread'), 'requires pread()')
+    @threading_helper.requires_working_threading()
+    def testPreadThreads(self):
+        data = bytes(range(256)) * 256
+        self.f.write(data)
+        self.f.close()
+        errors = []
+
+        def reader(f, start):
+            for offset in range(start, len(data), 4096):
+                if f.pread(1000, offset) != data[offset:offset + 1000]:
+                    errors.append(offset)
+
+        with self.FileIO(TESTFN, 'r') as f:
+            threads = [threading.Thread(target=reader, args=(f, i * 100))
+                       for i in range(4)]
+            with threading_helper.start_threads(threads):
+                pass
+            self.assertEqual(f.tell(), 0)
+        self.assertEqual(errors, [])
+
     # verify readinto
     def testReadintoByteArray(self):
         self.f.write(bytes([1, 2, 0, 255]))
@@ -4288,7 +4288,8 @@ class D(C): pass
                      "Signature information for builtins requires docstrings")
     def test_signature_on_builtin_class(self):
         expected = ('(file, protocol=None, fix_imports=True, '
-                    'buffer_callback=None)')
+                    'buffer_callback=None, buffer_threshold=None, '
+                    'memoize_strings=True)')
         self.assertEqual(str(inspect.signature(_pickle.Pickler)), expected)
 
         class P(_pickle.Pickler): pass
@@ -5903,7 +5904,8 @@ def test_stat_module_has_signatures(self):
 
     def test_string_module_has_signatures(self):
         import string
-        self._test_module_has_signatures(string)
+        unsupported_signature = {'TranslationTable'}
+        self._test_module_has_signatures(string, unsupported_signature=unsupported_signature)
 
     def test_symtable_module_has_signatures(self):
         import symtable
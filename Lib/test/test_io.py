@@ -1783,6 +1783,56 @@ def test_seek_character_device_file(self):
         self.assertEqual(buf.tell(), 0)
         self.assertEqual(buf.seek(0, io.SEEK_CUR), 0)
 
+    def test_read_stats(self):
+        rawio = self.MockRawIO((b"abc", b"d", b"efg"))
+        bufio = self.tp(rawio)
+        self.assertEqual(bufio.raw_reads, 0)
+        self.assertEqual(bufio.bytes_copied, 0)
+        self.assertEqual(bufio.read(2), b"ab")
+        self.assertEqual(bufio.raw_reads, 1)
+        self.assertEqual(bufio.bytes_copied, 3)
+        self.assertEqual(bufio.read(1), b"c")
+        self.assertEqual(bufio.raw_reads, 1)
+        self.assertEqual(bufio.read(2), b"de")
+        self.assertEqual(bufio.raw_reads, 3)
+        self.assertEqual(bufio.bytes_copied, 7)
+
+    def test_read_stats_read_only(self):
+        bufio = self.tp(self.MockRawIO())
+        for name in ('buffer_size', 'raw_reads', 'bytes_copied'):
+            with self.subTest(name=name):
+                with self.assertRaises(AttributeError):
+                    setattr(bufio, name, 1)
+
+    def test_adaptive(self):
+        data = bytes(range(256)) * (16 * 1024)
+        with self.open(os_helper.TESTFN, "wb") as f:
+            f.write(data)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with self.BufferedReader(self.FileIO(os_helper.TESTFN), 8192,
+                                 adaptive=True) as bufio:
+            self.assertEqual(bufio.buffer_size, 8192)
+            chunks = []
+            while chunk := bufio.read(1000):
+                chunks.append(chunk)
+            self.assertEqual(b"".join(chunks), data)
+            # Sequential reads grow the buffer, up to 1 MiB.
+            self.assertEqual(bufio.buffer_size, 1024 * 1024)
+            self.assertLess(bufio.raw_reads, len(data) // 8192)
+            # Random access shrinks it back.
+            for i in range(10):
+                bufio.seek(-100 * i - 10, io.SEEK_END)
+                self.assertEqual(bufio.read(10),
+                                 data[-100 * i - 10:][:10])
+            self.assertEqual(bufio.buffer_size, 8192)
+
+        with self.BufferedReader(self.FileIO(os_helper.TESTFN),
+                                 8192) as bufio:
+            while bufio.read(1000):
+                pass
+            self.assertEqual(bufio.buffer_size, 8192)
+            self.assertGreater(bufio.raw_reads, len(data) // 8192)
+
 
 class CBufferedReaderTest(BufferedReaderTest, SizeofTest):
     tp = io.BufferedReader
@@ -1838,6 +1888,19 @@ def test_bad_readinto_type(self):
             bufio.readline()
         self.assertIsInstance(cm.exception.__cause__, TypeError)
 
+    def test_read_stats_eintr(self):
+        # A raw read retried after EINTR is counted once
+        class EINTRRawIO(self.MockRawIO):
+            interrupted = False
+            def readinto(self, buf):
+                if not self.interrupted:
+                    self.interrupted = True
+                    raise InterruptedError(errno.EINTR, "interrupted")
+                return super().readinto(buf)
+        bufio = self.tp(EINTRRawIO((b"abc",)))
+        self.assertEqual(bufio.read(2), b"ab")
+        self.assertEqual(bufio.raw_reads, 1)
+
 
 class PyBufferedReaderTest(BufferedReaderTest):
     tp = pyio.BufferedReader
@@ -2416,6 +2479,34 @@ def test_read_and_write(self):
         self.assertEqual(b"ghjk", rw.read())
         self.assertEqual(b"dddeee", raw._write_stack[0])
 
+    @unittest.skipUnless(hasattr(os, 'pread'), 'requires pread()')
+    def test_positional_io(self):
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with self.FileIO(os_helper.TESTFN, "w+") as raw:
+            raw.write(b"0123456789")
+            raw.seek(0)
+            rw = self.tp(raw, 4)
+            self.assertEqual(rw.read(2), b"01")
+            # Pending writes are flushed before positional I/O
+            rw.write(b"ab")
+            self.assertEqual(rw.pread(6, 0), b"01ab45")
+            self.assertEqual(rw.tell(), 4)
+            # Writes over buffered data are seen by later reads
+            self.assertEqual(rw.read(1), b"4")
+            self.assertEqual(rw.pwrite(b"XY", 5), 2)
+            self.assertEqual(rw.read(3), b"XY7")
+            self.assertEqual(rw.tell(), 8)
+            if hasattr(os, 'preadv'):
+                a, b = bytearray(2), bytearray(3)
+                self.assertEqual(rw.preadv([a, b], 3), 5)
+                self.assertEqual((a, b), (b"b4", b"XY7"))
+            if hasattr(os, 'pwritev'):
+                self.assertEqual(rw.pwritev([b"p", b"q"], 8), 2)
+                self.assertEqual(rw.read(), b"pq")
+            rw.close()
+            self.assertRaises(ValueError, rw.pread, 1, 0)
+            self.assertRaises(ValueError, rw.pwrite, b"x", 0)
+
     def test_seek_and_tell(self):
         raw = self.BytesIO(b"asdfghjkl")
         rw = self.tp(raw)
@@ -3321,6 +3412,27 @@ def test_multibyte_seek_and_tell(self):
         self.assertEqual(f.tell(), p1)
         f.close()
 
+    def test_utf8_seek_and_tell_across_chunks(self):
+        # Multibyte characters and "\r\n" straddle chunk boundaries.
+        lines = ["a\u20ac" * i + "\r\n" for i in range(1, 20)]
+        data = "".join(lines).encode("utf-8")
+        for chunk_size in (1, 2, 3, 5, 7):
+            with self.subTest(chunk_size=chunk_size):
+                txt = self.TextIOWrapper(self.BytesIO(data), encoding="utf-8")
+                txt._CHUNK_SIZE = chunk_size
+                positions = []
+                while True:
+                    positions.append(txt.tell())
+                    if not txt.readline():
+                        break
+                for i, line in enumerate(lines):
+                    txt.seek(positions[i])
+                    self.assertEqual(txt.read(1), line[0])
+                    self.assertEqual(txt.readline(), line[1:-2] + "\n")
+                    self.assertEqual(txt.tell(), positions[i + 1])
+                txt.seek(0)
+                self.assertEqual(txt.read(), "".join(lines).replace("\r\n", "\n"))
+
     def test_seek_with_encoder_state(self):
         f = self.open(os_helper.TESTFN, "w", encoding="euc_jis_2004")
         f.write("\u00e6\u0300")
@@ -527,6 +527,40 @@ def test_read_all(self):
         m.seek(9)
         self.assertEqual(m.read(-42), bytes(range(9, 16)))
 
+    def test_iterlines(self):
+        data = b'abc\ndef\n\nxyz'
+        m = mmap.mmap(-1, len(data))
+        self.addCleanup(m.close)
+        m.write(data)
+        lines = list(m.iterlines())
+        self.assertEqual([bytes(line) for line in lines], data.splitlines(True))
+        self.assertIsInstance(lines[0], memoryview)
+        self.assertFalse(lines[0].readonly)
+        # Lines are views into the mapping.
+        m[0] = ord('A')
+        self.assertEqual(bytes(lines[0]), b'Abc\n')
+        self.assertEqual(m.tell(), len(data))
+
+        self.assertEqual([bytes(x) for x in m.iterlines(5)],
+                         [b'ef\n', b'\n', b'xyz'])
+        self.assertEqual([bytes(x) for x in m.iterlines(2, 6)],
+                         [b'c\n', b'de'])
+        self.assertEqual([bytes(x) for x in m.iterlines(-3)], [b'xyz'])
+        self.assertEqual([bytes(x) for x in m.iterlines(0, -3)],
+                         [b'Abc\n', b'def\n', b'\n'])
+        self.assertEqual(list(m.iterlines(6, 2)), [])
+        self.assertEqual(list(m.iterlines(100)), [])
+
+        # The mapping can't be closed while lines are alive.
+        it = m.iterlines()
+        self.assertRaises(BufferError, m.close)
+        self.assertEqual(len(list(it)), 4)
+        self.assertRaises(BufferError, m.close)
+        for line in lines:
+            line.release()
+        m.close()
+        self.assertRaises(ValueError, m.iterlines)
+
     def test_read_invalid_arg(self):
         m = mmap.mmap(-1, 16)
         self.addCleanup(m.close)
@@ -461,10 +461,10 @@ class SizeofTests(unittest.TestCase):
         check_sizeof = support.check_sizeof
 
         def test_pickler(self):
-            basesize = support.calcobjsize('7P2n3i2n3i2P')
+            basesize = support.calcobjsize('7P2n3i2n3i2PniP')
             p = _pickle.Pickler(io.BytesIO())
             self.assertEqual(object.__sizeof__(p), basesize)
-            MT_size = struct.calcsize('3nP0n')
+            MT_size = struct.calcsize('3n2P0n')
             ME_size = struct.calcsize('Pn0P')
             check = self.check_sizeof
             check(p, basesize +
@@ -709,6 +709,83 @@ def test_multiprocessing_exceptions(self):
                                  ('multiprocessing.context', name))
 
 
+class ChunkedPickleTests(unittest.TestCase):
+
+    def check(self, obj, nchunks, **kwargs):
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            data = pickle.dumps_chunked(obj, proto, **kwargs)
+            kind, sizes = pickle.loads(data)
+            self.assertEqual(len(sizes), nchunks)
+            for max_workers in (1, 3, None):
+                with self.subTest(proto=proto, max_workers=max_workers):
+                    new = pickle.loads_chunked(data, max_workers=max_workers)
+                    self.assertIs(type(new), type(obj))
+                    self.assertEqual(new, obj)
+
+    def test_list(self):
+        self.check(list(range(100)), 1)
+        self.check(list(range(100)), 10, chunk_size=10)
+        self.check(list(range(101)), 11, chunk_size=10)
+        self.check([], 0, chunk_size=10)
+
+    def test_dict(self):
+        self.check({str(i): [i] for i in range(100)}, 1)
+        self.check({str(i): [i] for i in range(100)}, 7, chunk_size=15)
+        self.check({}, 0)
+
+    def test_other_objects(self):
+        self.check((1, 2, 3), 1, chunk_size=1)
+        self.check({1, 2, 3}, 1, chunk_size=1)
+        self.check(collections.OrderedDict(a=1, b=2), 1, chunk_size=1)
+        self.check(None, 1)
+
+    def test_independent_chunks(self):
+        shared = ['shared']
+        data = pickle.dumps_chunked([shared, shared, shared], chunk_size=2)
+        new = pickle.loads_chunked(data)
+        self.assertEqual(new, [shared] * 3)
+        self.assertIs(new[0], new[1])
+        self.assertIsNot(new[1], new[2])
+
+    def test_bytes_like(self):
+        data = pickle.dumps_chunked(list(range(10)), chunk_size=3)
+        for buf in (bytearray(data), memoryview(data)):
+            self.assertEqual(pickle.loads_chunked(buf), list(range(10)))
+        self.assertRaises(TypeError, pickle.loads_chunked, data.decode('latin1'))
+
+    def test_errors(self):
+        self.assertRaises(ValueError, pickle.dumps_chunked, [], chunk_size=0)
+        data = pickle.dumps_chunked(list(range(10)), chunk_size=3)
+        with self.assertRaises(pickle.UnpicklingError):
+            pickle.loads_chunked(pickle.dumps([1, 2]))
+        with self.assertRaises(pickle.UnpicklingError):
+            pickle.loads_chunked(pickle.dumps(('set', [3])) + b'x' * 3)
+        with self.assertRaises(pickle.UnpicklingError):
+            pickle.loads_chunked(pickle.dumps(('list', [1000])) + data)
+        header = pickle.dumps(('list', [len(pickle.dumps({}))]))
+        with self.assertRaises(pickle.UnpicklingError):
+            pickle.loads_chunked(header + pickle.dumps({}))
+        header_size = len(pickle.dumps(pickle.loads(data)))
+        with self.assertRaises((pickle.UnpicklingError, EOFError)):
+            pickle.loads_chunked(data[:header_size - 1])
+        for max_workers in (0, -1):
+            with self.assertRaises(ValueError):
+                pickle.loads_chunked(data, max_workers=max_workers)
+
+    def test_wrong_length(self):
+        data = pickle.dumps_chunked(list(range(10)), chunk_size=3)
+        header_size = len(pickle.dumps(pickle.loads(data)))
+        for bad in (data[:-1], data[:header_size], data + b'\0' * 5,
+                    data + b'.', data + data):
+            with self.subTest(size=len(bad)):
+                with self.assertRaisesRegex(pickle.UnpicklingError,
+                                            'wrong length'):
+                    pickle.loads_chunked(bad)
+                with self.assertRaisesRegex(pickle.UnpicklingError,
+                                            'wrong length'):
+                    pickle.loads_chunked(memoryview(bytearray(bad)))
+
+
 class CommandLineTest(unittest.TestCase):
     def setUp(self):
         self.filename = tempfile.mktemp()
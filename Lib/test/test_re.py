@@ -1705,6 +1705,67 @@ def test_finditer(self):
         self.assertEqual([item.group(0) for item in iter],
                          ["::", "::"])
 
+    def test_findspans_into(self):
+        import array
+
+        def findspans(p, string, capacity, *args, groups=False, typecode='q'):
+            size = 2 * (p.groups + 1) if groups else 2
+            buf = array.array(typecode, [0]) * (capacity * size + 1)
+            result = []
+            pos = args[0] if args else 0
+            while pos is not None:
+                n, pos = p.findspans_into(buf, string, pos, *args[1:],
+                                          groups=groups)
+                self.assertLessEqual(n, capacity)
+                if pos is not None:
+                    self.assertGreater(n, 0)
+                result.extend(buf[:n * size])
+            return result
+
+        def expected(p, string, *args, groups=False):
+            result = []
+            for m in p.finditer(string, *args):
+                for g in range(p.groups + 1 if groups else 1):
+                    result.extend(m.span(g))
+            return result
+
+        for pattern, string in [(r':+', 'a:b::c:::d'),
+                                (r'', 'abc'),
+                                (r'|a', 'aaba'),
+                                (r'a*', 'baac'),
+                                (r'\b', 'ab cd'),
+                                (r'(\w)(\d)?|(-)', 'ab1-c'),
+                                (rb'(x)|y', b'xyzx'),
+                                (r'\w+', 'x' * 100)]:
+            p = re.compile(pattern)
+            for args in [(), (1,), (1, 4), (3, 2)]:
+                for groups in (False, True):
+                    exp = expected(p, string, *args, groups=groups)
+                    for capacity in (2, 3, 5, 100):
+                        with self.subTest(pattern=pattern, args=args,
+                                          groups=groups, capacity=capacity):
+                            self.assertEqual(findspans(p, string, capacity, *args,
+                                                       groups=groups), exp)
+        for typecode in 'ilq':
+            with self.subTest(typecode=typecode):
+                self.assertEqual(findspans(re.compile('b'), 'abcb', 2,
+                                           typecode=typecode), [1, 2, 3, 4])
+        buf = array.array('q', [0] * 4)
+        p = re.compile('a')
+        self.assertEqual(p.findspans_into(buf, 'xax'), (1, None))
+        self.assertEqual(p.findspans_into(buffer=buf, string='aaa', pos=1,
+                                          endpos=2, groups=True), (1, None))
+        self.assertEqual(buf.tolist(), [1, 2, 0, 0])
+        with self.assertRaises(ValueError):
+            p.findspans_into(array.array('q', [0] * 3), 'a')
+        for buf in (b'x' * 16, array.array('d', [0] * 4),
+                    array.array('B', [0] * 32), array.array('Q', [0] * 4),
+                    memoryview(bytearray(64)).cast('q')[::2]):
+            with self.assertRaises((TypeError, BufferError)):
+                p.findspans_into(buf, 'a')
+        with self.assertRaises(TypeError):
+            p.findspans_into(array.array('q', [0] * 4), b'a')
+
     def test_bug_926075(self):
         self.assertIsNot(re.compile('bug_926075'),
                          re.compile(b'bug_926075'))
@@ -2005,6 +2066,44 @@ def test_search_dot_unicode(self):
         self.assertTrue(re.search("123.*-", '123\U0010ffff-'))
         self.assertTrue(re.search("123.*-", '123\xe9\u20ac\U0010ffff-'))
 
+    def test_search_required_literal(self):
+        # The search skips to the windows containing a literal which
+        # is required by the pattern.
+        for s in ('', 'x', '12 ERROR', '12 ERROR ', 'x 1 WARN timeout\n',
+                  '1 ERROR x timeout', 'ab 12 ERROR  timeout',
+                  '\xe9 12 ERROR timeout \u20ac',
+                  '\U0010ffff 12 ERROR timeout'):
+            with self.subTest(s=s):
+                for p in (r'\d+ ERROR .*timeout', r'[0-9]+ ERROR', r'\d\d ERR',
+                          r'(?:\w|\s)+?(ERROR)', r'(?:\w\d|1)(?: ERROR)+'):
+                    p = re.compile(p)
+                    expected = next(filter(None, (p.match(s, i)
+                                                  for i in range(len(s) + 1))),
+                                    None)
+                    m = p.search(s)
+                    self.assertEqual(m and m.span(), expected and expected.span())
+                    self.assertEqual(m and m.groups(),
+                                     expected and expected.groups())
+        # Misaligned occurrences of the literal in wide strings.
+        self.assertIsNone(re.search('\u0100\u0200',
+                                    '\u0001\u0002\u0001\u0100'))
+        self.assertEqual(re.search('.\u0201\u0403',
+                                   '\u0100\u0302\u0104x\u0201\u0403').span(),
+                         (3, 6))
+        self.assertEqual(re.search('.\U00010002\U00020001',
+                                   '\U00020001\U00010002\U00020001').span(),
+                         (0, 3))
+        # The literal may be shorter than the pattern's other parts.
+        s = 'x' * 1000 + '1 ERROR' + 'x' * 1000
+        self.assertEqual(re.search(r'\d ERROR', s).span(), (1000, 1007))
+        self.assertEqual(re.findall(r'\d ERROR|y', s), ['1 ERROR'])
+        self.assertEqual(re.search(r'x{1000}\d ERROR', s).span(), (0, 1007))
+        self.assertIsNone(re.search(r'x{1001}\d ERROR', s))
+        self.assertEqual(re.search(r'(?i)\d ERROR', s).span(), (1000, 1007))
+        self.assertEqual(re.search(r'(?i)\d error', s).span(), (1000, 1007))
+        self.assertEqual(re.search(rb'\d ERROR', s.encode()).span(),
+                         (1000, 1007))
+
     def test_compile(self):
         # Test return value when given string and pattern as parameter
         pattern = re.compile('random pattern')
@@ -2707,6 +2806,182 @@ def test_memory_leaks(self):
         self.check_interrupt(r'([^:]){2,4}+:', 'abc:', 100)
 
 
+class LinearTests(unittest.TestCase):
+
+    def check_same(self, pattern, string, flags=0):
+        p1 = re.compile(pattern, flags)
+        p2 = re.compile(pattern, flags | re.LINEAR)
+        for meth in 'match', 'search', 'fullmatch':
+            with self.subTest(pattern=pattern, string=string, meth=meth):
+                m1 = getattr(p1, meth)(string)
+                m2 = getattr(p2, meth)(string)
+                if m1 is None:
+                    self.assertIsNone(m2)
+                    continue
+                self.assertIsNotNone(m2)
+                self.assertEqual(m2.regs, m1.regs)
+                self.assertEqual(m2.lastindex, m1.lastindex)
+        with self.subTest(pattern=pattern, string=string):
+            self.assertEqual(p2.findall(string), p1.findall(string))
+            self.assertEqual(p2.split(string), p1.split(string))
+            repl = string[:0]
+            self.assertEqual(p2.sub(repl, string), p1.sub(repl, string))
+
+    def test_re_tests(self):
+        from test.re_tests import tests, SYNTAX_ERROR
+        for t in tests:
+            pattern, s, outcome = t[:3]
+            if outcome == SYNTAX_ERROR:
+                continue
+            try:
+                re.compile(pattern, re.LINEAR)
+            except re.PatternError:
+                continue
+            self.check_same(pattern, s)
+
+    def test_semantics(self):
+        self.check_same(r'a|ab|abc', 'xabc')
+        self.check_same(r'(a+)(a*?)(b?)', 'aaab')
+        self.check_same(r'(?:(a)|b)+', 'ab')
+        self.check_same(r'(a|b)*?c', 'abbc')
+        self.check_same(r'(a{2,3}){2}', 'aaaaaaa')
+        self.check_same(r'(a{2,3}?){2,}?b', 'aaaaaaab')
+        self.check_same(r'\b\w+\b', 'foo bar')
+        self.check_same(r'^\w+$', 'foo\nbar', re.M)
+        self.check_same(r'.+', 'foo\nbar', re.S)
+        self.check_same(r'[a-z]+', 'FooBAR', re.I)
+        self.check_same(r'\d+', '12٣\U0001d7ce')
+        self.check_same(r'\U0001f600+|€', 'x€\U0001f600\U0001f600')
+        self.check_same(rb'\w+', b'foo bar')
+        # An empty iteration ends a repeat, as in the default engine.
+        self.check_same(r'(a|)*', 'aa')
+        self.check_same(r'(a|)*?b', 'aab')
+        self.check_same(r'(?:(a)|)*', 'aa')
+        self.check_same(r'(a*)+', 'ab')
+        self.check_same(r'(a*)*b', 'aab')
+        self.check_same(r'x*', 'axxb')
+
+    def test_pos_endpos(self):
+        p = re.compile(r'\w+', re.LINEAR)
+        self.assertEqual(p.search('ab cd', 1).span(), (1, 2))
+        self.assertEqual(p.search('ab cd', 2, 4).span(), (3, 4))
+        self.assertIsNone(p.match('ab cd', 2))
+        self.assertEqual(p.fullmatch('ab cd', 3).span(), (3, 5))
+        self.assertEqual([m.span() for m in p.finditer('ab cd')],
+                         [(0, 2), (3, 5)])
+        s = p.scanner('ab cd')
+        self.assertEqual(s.search().span(), (0, 2))
+        self.assertEqual(s.match(), None)
+
+    def test_catastrophic_patterns(self):
+        # These take exponential time with the backtracking engine.
+        n = 100_000
+        self.assertIsNone(re.search(r'(a*)*b', 'a' * n, re.LINEAR))
+        self.assertIsNone(re.search(r'(x+x+)+y', 'x' * n, re.LINEAR))
+        self.assertIsNone(re.fullmatch(r'(\w|\d)+\.', '1' * n, re.LINEAR))
+        self.assertEqual(re.search(r'(a|aa)+$', 'a' * n, re.LINEAR).span(),
+                         (0, n))
+
+    def test_unsupported(self):
+        for pattern in [r'(a)\1', r'(?P<x>a)(?P=x)', r'(a)?(?(1)b|c)',
+                        r'a(?=b)', r'a(?!b)', r'(?<=a)b', r'(?<!a)b',
+                        r'(?>a+)', r'a*+', r'(?:ab)++', r'(?:a|(?=b))*']:
+            with self.subTest(pattern=pattern):
+                with self.assertRaisesRegex(re.PatternError,
+                                            'not supported with the LINEAR '
+                                            'flag'):
+                    re.compile(pattern, re.LINEAR)
+
+    def test_too_large(self):
+        with self.assertRaises(OverflowError):
+            re.compile(r'(?:a|b){1000000}', re.LINEAR)
+
+    def test_flag(self):
+        import pickle
+        p = re.compile('a', re.LINEAR)
+        self.assertEqual(p.flags, re.LINEAR | re.UNICODE)
+        self.assertEqual(repr(p), "re.compile('a', re.LINEAR)")
+        self.assertNotEqual(p, re.compile('a'))
+        self.assertEqual(pickle.loads(pickle.dumps(p)), p)
+
+
+class PatternSetTests(unittest.TestCase):
+
+    def check_matches(self, patterns, string, *args):
+        s = re.compile_set(patterns)
+        expected = [i for i, p in enumerate(s.patterns)
+                    if p.search(string, *args)]
+        self.assertEqual(s.matches(string, *args), expected)
+
+    def test_matches(self):
+        patterns = [r'\d+ ERROR', 'timeout', r'\w+', 'abc|xyz', 'out',
+                    'he', 'she', 'his', 'hers', 'ERROR', r'(?i)error',
+                    r'^ERROR', r'\bERR', 'x*', r'(?<=1 )ERROR', 'a{3}',
+                    '\u20ac', '\U0001f600+', '\xe9t\xe9', r'(?i)\d\d:']
+        for string in ('', 'x', '12 ERROR timeout', 'ushers',
+                       'shis', 'aaa', 'Error at 12:', 'ERRORS',
+                       '\xe9t\xe9 \u20ac', '\U0001f600\U0001f600 he',
+                       'a' * 100 + 'timeout'):
+            with self.subTest(string=string):
+                self.check_matches(patterns, string)
+                for pos in range(len(string) + 1):
+                    self.check_matches(patterns, string, pos)
+                    self.check_matches(patterns, string, 0, pos)
+                self.check_matches(patterns, string, -5, 100)
+                self.check_matches(patterns, string, 3, 1)
+
+    def test_bytes(self):
+        patterns = [rb'\d+ ERROR', b'timeout', b'\xe9', rb'\w+']
+        for string in (b'', b'12 ERROR', b'\xe9t\xe9', bytearray(b'timeout'),
+                       memoryview(b'a timeout')):
+            with self.subTest(string=string):
+                self.check_matches(patterns, string)
+
+    def test_compile_set(self):
+        s = re.compile_set([])
+        self.assertEqual(len(s), 0)
+        self.assertEqual(s.patterns, ())
+        self.assertEqual(s.matches('abc'), [])
+        self.assertEqual(s.matches(b'abc'), [])
+        p = re.compile('b')
+        s = re.compile_set(iter(['a', p]), flags=0)
+        self.assertEqual(len(s), 2)
+        self.assertEqual(s.patterns, (re.compile('a'), p))
+        self.assertIs(s.patterns[1], p)
+        self.assertEqual(s.matches('cba'), [0, 1])
+        s = re.compile_set(['A', 'b'], re.IGNORECASE)
+        self.assertEqual(s.matches('aB'), [0, 1])
+        with self.assertRaises(ValueError):
+            re.compile_set([p], re.IGNORECASE)
+        with self.assertRaises(re.PatternError):
+            re.compile_set(['a', '('])
+        with self.assertRaises(TypeError):
+            re.compile_set(['a', b'b'])
+        s = re.compile_set(['a'])
+        with self.assertRaises(TypeError):
+            s.matches(b'a')
+        with self.assertRaises(TypeError):
+            re.compile_set([b'a']).matches('a')
+        with self.assertRaises(TypeError):
+            s.matches(1)
+
+    def test_pickle(self):
+        import pickle
+        s = re.compile_set(['a', r'\d+'], re.IGNORECASE)
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                s2 = pickle.loads(pickle.dumps(s, proto))
+                self.assertEqual(s2.patterns, s.patterns)
+                self.assertEqual(s2.matches('A1'), [0, 1])
+
+    def test_many_patterns(self):
+        words = ['w%dx' % i for i in range(500)]
+        s = re.compile_set([r'\b%s\b' % w for w in words] + [r'\d+ ERROR'])
+        self.assertEqual(s.matches('w17x w170x w5x'), [5, 17, 170])
+        self.assertEqual(s.matches('w17 w1x0'), [])
+        self.assertEqual(s.matches('w499x 12 ERROR'), [499, 500])
+
+
 def get_debug_out(pat):
     with captured_stdout() as out:
         re.compile(pat, re.DEBUG)
@@ -2772,14 +3047,16 @@ def test_atomic_group(self):
   MAX_REPEAT 0 1
     LITERAL 98
 
- 0. INFO 4 0b0 1 2 (to 5)
- 5: ATOMIC_GROUP 11 (to 17)
- 7.   LITERAL 0x61 ('a')
- 9.   REPEAT_ONE 6 0 1 (to 16)
-13.     LITERAL 0x62 ('b')
-15.     SUCCESS
-16:   SUCCESS
-17: SUCCESS
+ 0. INFO 8 0b1000 1 2 (to 9)
+      required_offset 0 0
+      required [0x61] ('a')
+ 9: ATOMIC_GROUP 11 (to 21)
+11.   LITERAL 0x61 ('a')
+13.   REPEAT_ONE 6 0 1 (to 20)
+17.     LITERAL 0x62 ('b')
+19.     SUCCESS
+20:   SUCCESS
+21: SUCCESS
 ''')
 
     def test_possesive_repeat_one(self):
@@ -2882,11 +3159,11 @@ def test_flags_repr(self):
                          "re.IGNORECASE|re.DOTALL|re.VERBOSE|0x100000")
         self.assertEqual(
                 repr(~re.I),
-                "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.DOTALL|re.VERBOSE|re.DEBUG|0x1")
+                "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.DOTALL|re.VERBOSE|re.LINEAR|re.DEBUG|0x1")
         self.assertEqual(repr(~(re.I|re.S|re.X)),
-                         "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.DEBUG|0x1")
+                         "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.LINEAR|re.DEBUG|0x1")
         self.assertEqual(repr(~(re.I|re.S|re.X|(1<<20))),
-                         "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.DEBUG|0xffe01")
+                         "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.LINEAR|re.DEBUG|0xffc01")
 
 
 class ImplementationTest(unittest.TestCase):
@@ -2924,6 +3201,7 @@ def test_disallow_instantiation(self):
         # Ensure that the type disallows instantiation (bpo-43916)
         check_disallow_instantiation(self, re.Match)
         check_disallow_instantiation(self, re.Pattern)
+        check_disallow_instantiation(self, re.PatternSet)
         pat = re.compile("")
         check_disallow_instantiation(self, type(pat.scanner("")))
 
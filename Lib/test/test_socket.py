@@ -6077,6 +6077,232 @@ def testTimeoutZero(self):
         if not ok:
             self.fail("recv() returned success when we did not expect it")
 
+@requireAttrs(socket.socket, "sendmmsg", "recvmmsg_into")
+class SendrecvmmsgUDPTest(SocketUDPTest):
+
+    def setUp(self):
+        super().setUp()
+        self.serv.settimeout(support.SHORT_TIMEOUT)
+        self.cli = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.addCleanup(self.cli.close)
+        self.cli.bind((HOST, 0))
+        self.addr = self.serv.getsockname()
+
+    def testSendmmsgRecvmmsgInto(self):
+        msgs = [b'spam', b'eggs', b'', b'ham']
+        self.assertEqual(self.cli.sendmmsg(msgs, 0, [self.addr] * len(msgs)),
+                         len(msgs))
+        bufs = [bytearray(10) for _ in range(len(msgs) + 2)]
+        result = self.serv.recvmmsg_into(bufs)
+        self.assertEqual(len(result), len(msgs))
+        for (nbytes, ancdata, msg_flags, addr), buf, msg in zip(result, bufs,
+                                                                 msgs):
+            self.assertEqual(nbytes, len(msg))
+            self.assertEqual(buf[:nbytes], msg)
+            self.assertEqual(ancdata, [])
+            self.assertEqual(msg_flags, 0)
+            self.assertEqual(addr, self.cli.getsockname())
+
+    def testSendmmsgConnected(self):
+        self.cli.connect(self.addr)
+        self.assertEqual(self.cli.sendmmsg([b'a', bytearray(b'bc')]), 2)
+        self.assertEqual(self.cli.sendmmsg(iter([memoryview(b'def')]), 0,
+                                           None), 1)
+        bufs = [bytearray(3) for _ in range(3)]
+        result = self.serv.recvmmsg_into(bufs)
+        self.assertEqual([r[0] for r in result], [1, 2, 3])
+        self.assertEqual(bufs, [b'a\0\0', b'bc\0', b'def'])
+
+    def testRecvmmsgIntoWaitsForOne(self):
+        # Only the first message is waited for; the call returns as soon
+        # as the queued messages have been received.
+        self.cli.sendto(b'x', self.addr)
+        result = self.serv.recvmmsg_into([bytearray(1) for _ in range(10)])
+        self.assertEqual(len(result), 1)
+
+    def testRecvmmsgIntoTruncated(self):
+        self.cli.sendto(b'0123456789', self.addr)
+        buf = bytearray(4)
+        [(nbytes, _, msg_flags, _)] = self.serv.recvmmsg_into([buf])
+        self.assertEqual(nbytes, 4)
+        self.assertEqual(buf, b'0123')
+        self.assertTrue(msg_flags & socket.MSG_TRUNC)
+
+    def testRecvmmsgIntoTimeout(self):
+        self.serv.settimeout(0.01)
+        with self.assertRaises(TimeoutError):
+            self.serv.recvmmsg_into([bytearray(10)])
+
+    def testRecvmmsgIntoNonBlocking(self):
+        self.serv.setblocking(False)
+        with self.assertRaises(BlockingIOError):
+            self.serv.recvmmsg_into([bytearray(10)])
+
+    def testRecvmmsgIntoAncillary(self):
+        if not hasattr(socket, 'IP_RECVTOS'):
+            self.skipTest('IP_RECVTOS is required')
+        self.serv.setsockopt(socket.IPPROTO_IP, socket.IP_RECVTOS, 1)
+        self.cli.setsockopt(socket.IPPROTO_IP, socket.IP_TOS, 0x20)
+        self.cli.sendmmsg([b'a', b'b'], 0, [self.addr] * 2)
+        bufs = [bytearray(1), bytearray(1)]
+        result = self.serv.recvmmsg_into(bufs, socket.CMSG_SPACE(1))
+        self.assertEqual(len(result), 2)
+        for nbytes, ancdata, msg_flags, addr in result:
+            self.assertEqual(len(ancdata), 1)
+            level, type, data = ancdata[0]
+            self.assertEqual((level, type), (socket.IPPROTO_IP,
+                                             socket.IP_TOS))
+            self.assertEqual(data, b'\x20')
+
+    @requireAttrs(socket, "UDP_SEGMENT", "UDP_GRO", "SOL_UDP")
+    def testSegmentationOffload(self):
+        try:
+            self.cli.setsockopt(socket.SOL_UDP, socket.UDP_SEGMENT, 100)
+            self.serv.setsockopt(socket.SOL_UDP, socket.UDP_GRO, 1)
+        except OSError as e:
+            self.skipTest(f'UDP segmentation offload is not supported: {e}')
+        data = bytes(range(250))
+        self.assertEqual(self.cli.sendmmsg([data], 0, [self.addr]), 1)
+        bufs = [bytearray(1000) for _ in range(3)]
+        received = b''
+        while len(received) < len(data):
+            for nbytes, ancdata, _, _ in self.serv.recvmmsg_into(
+                    bufs, socket.CMSG_SPACE(4)):
+                for level, type, segsize in ancdata:
+                    self.assertEqual((level, type),
+                                     (socket.SOL_UDP, socket.UDP_GRO))
+                    self.assertEqual(int.from_bytes(segsize,
+                                                    sys.byteorder), 100)
+                received += bufs[0][:nbytes]
+                bufs.pop(0)
+        self.assertEqual(received, data)
+
+    def testEmpty(self):
+        self.assertEqual(self.cli.sendmmsg([], 0, []), 0)
+        self.assertEqual(self.cli.sendmmsg([]), 0)
+        self.assertEqual(self.serv.recvmmsg_into([]), [])
+
+    def testBadArguments(self):
+        with self.assertRaises(TypeError):
+            self.cli.sendmmsg(b'data')
+        with self.assertRaises(TypeError):
+            self.cli.sendmmsg(['data'], 0, [self.addr])
+        with self.assertRaises(TypeError):
+            self.cli.sendmmsg([b'data'], 0, [('localhost',)])
+        with self.assertRaises(ValueError):
+            self.cli.sendmmsg([b'a', b'b'], 0, [self.addr])
+        with self.assertRaises(TypeError):
+            self.serv.recvmmsg_into([b'immutable'])
+        with self.assertRaises(TypeError):
+            self.serv.recvmmsg_into(bytearray(10))
+        with self.assertRaises(ValueError):
+            self.serv.recvmmsg_into([bytearray(10)], -1)
+
+
+@requireAttrs(socket.socket, "send_zerocopy")
+class SendZerocopyTest(unittest.TestCase):
+
+    def setUp(self):
+        with socket.create_server((HOST, 0)) as listener:
+            self.cli = socket.create_connection(listener.getsockname())
+            self.addCleanup(self.cli.close)
+            self.serv, _ = listener.accept()
+            self.addCleanup(self.serv.close)
+        self.serv.settimeout(support.SHORT_TIMEOUT)
+
+    def recv_exactly(self, size):
+        data = bytearray()
+        while len(data) < size:
+            data += self.serv.recv(size - len(data))
+        return data
+
+    def wait_for_completions(self, count):
+        completed = 0
+        for _ in support.sleeping_retry(support.SHORT_TIMEOUT):
+            completed += self.cli.zerocopy_completions()
+            if completed >= count:
+                return completed
+
+    def testSendZerocopy(self):
+        data = bytearray(os.urandom(256 * 1024))
+        self.assertEqual(self.cli.zerocopy_pending, 0)
+        sent = self.cli.send_zerocopy(data)
+        self.assertGreater(sent, 0)
+        self.assertEqual(self.cli.zerocopy_pending, 1)
+        # The buffer stays exported until the send completes.
+        with self.assertRaises(BufferError):
+            data.append(0)
+        self.assertEqual(self.recv_exactly(sent), data[:sent])
+        self.assertEqual(self.wait_for_completions(1), 1)
+        self.assertEqual(self.cli.zerocopy_pending, 0)
+        data.append(0)
+
+    def testSeveralSends(self):
+        bufs = [bytearray(b'%d' % i * 1000) for i in range(5)]
+        for buf in bufs:
+            self.assertEqual(self.cli.send_zerocopy(buf, 0), len(buf))
+        self.assertEqual(self.cli.zerocopy_pending, 5)
+        self.assertEqual(self.recv_exactly(5000), b''.join(bufs))
+        self.assertEqual(self.wait_for_completions(5), 5)
+        self.assertEqual(self.cli.zerocopy_pending, 0)
+
+    @threading_helper.requires_working_threading()
+    def testThreads(self):
+        # Every send is matched with its own completion report.
+        bufs = [[bytearray(b'%d.%d,' % (i, j) * 100) for j in range(10)]
+                for i in range(4)]
+        def sender(bufs):
+            for buf in bufs:
+                self.cli.send_zerocopy(buf)
+        threads = [threading.Thread(target=sender, args=(b,)) for b in bufs]
+        with threading_helper.start_threads(threads):
+            pass
+        total = sum(len(buf) for b in bufs for buf in b)
+        self.assertEqual(len(self.recv_exactly(total)), total)
+        self.assertEqual(self.wait_for_completions(40), 40)
+        self.assertEqual(self.cli.zerocopy_pending, 0)
+        for b in bufs:
+            for buf in b:
+                buf.append(0)
+
+    def testEmpty(self):
+        self.assertEqual(self.cli.send_zerocopy(b''), 0)
+        self.assertEqual(self.cli.zerocopy_pending, 0)
+
+    def testClose(self):
+        data = bytearray(b'x' * 1000)
+        self.cli.send_zerocopy(data)
+        self.assertEqual(self.recv_exactly(1000), data)
+        self.cli.close()
+        # Closing the socket releases the buffers.
+        self.assertEqual(self.cli.zerocopy_pending, 0)
+        data.append(0)
+        with self.assertRaises(OSError):
+            self.cli.zerocopy_completions()
+
+    @requireAttrs(socket, "IP_RECVERR")
+    def testOtherErrors(self):
+        # Errors queued with IP_RECVERR are reported, not discarded.
+        with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock:
+            sock.setsockopt(socket.SOL_IP, socket.IP_RECVERR, 1)
+            port = socket_helper.find_unused_port(socket.AF_INET,
+                                                  socket.SOCK_DGRAM)
+            sock.sendto(b'data', (HOST, port))
+            for _ in support.sleeping_retry(support.SHORT_TIMEOUT):
+                try:
+                    sock.zerocopy_completions()
+                except ConnectionRefusedError:
+                    break
+            self.assertEqual(sock.zerocopy_completions(), 0)
+
+    def testNotSupported(self):
+        a, b = socket.socketpair()
+        with a, b:
+            with self.assertRaises(OSError):
+                a.send_zerocopy(b'data')
+            self.assertEqual(a.zerocopy_pending, 0)
+
+
 class TestExceptions(unittest.TestCase):
 
     def testExceptionTree(self):
@@ -1,4 +1,5 @@
 from test import support
+import math
 import random
 import unittest
 from functools import cmp_to_key
@@ -383,6 +384,53 @@ def test_unsafe_float_compare(self):
         check_against_PyObject_RichCompareBool(self, [float(x) for
                                                       x in range(100)])
 
+    def test_radix_sort(self):
+        # Large lists of ints, floats and latin strings are sorted with a
+        # radix sort, unless they are nearly sorted.
+        random.seed(0)
+        n = 2000
+        def randstr(chars):
+            k = random.randrange(12)
+            return ''.join(random.choice(chars) for _ in range(k))
+        lists = [
+            [random.randrange(-1000, 1000) for _ in range(n)],
+            [random.randrange(-2**62, 2**62) for _ in range(n)],
+            [random.randrange(2**30, 2**31) for _ in range(n)],
+            [random.choice([0, -1, 1, 2**62, -2**62, 2**63 - 1, -2**63,
+                            2**63, -2**63 - 1, 2**100, -2**100])
+             for _ in range(n)],
+            [random.uniform(-1e6, 1e6) for _ in range(n)],
+            [random.choice([0.0, -0.0, 1.0, -1.0, float('inf'),
+                            float('-inf'), 5e-324, -5e-324, 1e308])
+             for _ in range(n)],
+            [random.random() for _ in range(n)] + [float('nan')],
+            [randstr('ab') for _ in range(n)],
+            [randstr('ab\0\xff') for _ in range(n)],
+            ['common prefix ' + randstr('xyz') for _ in range(n)],
+            ['same'] * n,
+            [random.randrange(5) for _ in range(n)] + [2.5],
+        ]
+        for L in lists:
+            with self.subTest(L=L[:5]):
+                check_against_PyObject_RichCompareBool(self, L)
+                # Nearly sorted
+                L = sorted(L, key=str)
+                L[::100] = L[-1::-100]
+                check_against_PyObject_RichCompareBool(self, L)
+
+    def test_radix_sort_stability(self):
+        random.seed(0)
+        L = [(random.randrange(100), i) for i in range(2000)]
+        for key in [lambda t: t[0], lambda t: float(t[0]),
+                    lambda t: -t[0] * 2**40, lambda t: '%03d' % t[0]]:
+            expected = sorted(L, key=lambda t: (key(t), t[1]))
+            self.assertEqual(sorted(L, key=key), expected)
+            expected = sorted(L, key=lambda t: (key(t), -t[1]), reverse=True)
+            self.assertEqual(sorted(L, key=key, reverse=True), expected)
+        L = [random.choice([0.0, -0.0]) for _ in range(2000)]
+        signs = [math.copysign(1, x) for x in L]
+        self.assertEqual([math.copysign(1, x) for x in sorted(L)], signs)
+
     def test_unsafe_tuple_compare(self):
         # This test was suggested by Tim Peters. It verifies that the tuple
         # comparison respects the current tuple compare semantics, which do not
@@ -215,6 +215,80 @@ def test_vformat_recursion_limit(self):
         self.assertIn("recursion", str(err.exception))
 
 
+class TestTranslationTable(unittest.TestCase):
+    def check(self, *args):
+        table = string.TranslationTable(*args)
+        mapping = str.maketrans(*args)
+        for text in ['', 'a', 'abc', 'xyz', 'abababc', '[a]', 'a.b-c ',
+                     '\xe9', 'a\xe9b', '\u20ac', 'a\u20acb\u0100',
+                     '\U0001f600', 'a\U0001f600b\xe9\u20ac', 'a' * 100]:
+            with self.subTest(args=args, text=text):
+                self.assertEqual(text.translate(table), text.translate(mapping))
+
+    def test_translate(self):
+        self.check({'a': None})
+        self.check({'a': None, 'b': ord('i')})
+        self.check({'a': None, 'b': ord('i'), 'c': 'x'})
+        self.check({'a': None, 'b': ''})
+        self.check({'z': 'yy'})
+        self.check({'a': None, 'b': '<i>'})
+        self.check('abc', 'xyz', 'd')
+        self.check({'a': '\xe9'})
+        self.check({'a': '<\xe9>', '\xe9': 'e'})
+        self.check({'\xe9': None, '\u20ac': 'EUR'})
+        self.check({'a': '\u20ac', 'b': '\U0001f600'})
+        self.check({'\u20ac': None, '\u0100': '\xe9'})
+        self.check({'\U0001f600': ':)', 'b': None})
+        self.check({ord('.'): None, ord('-'): '_', -1: 'x', 2**100: 'y'})
+        self.check({})
+        # the first string replacement is stored at index 0
+        self.check({'\0': '', 'a': 'b'})
+        self.check({'a': '', 'b': 'xy'})
+
+    def test_result_type(self):
+        table = string.TranslationTable({'a': '\xe9', 'b': None, 'c': 'c'})
+        for text, expected in [('ac', '\xe9c'), ('bc', 'c'), ('b', ''),
+                               ('\xe9b', '\xe9'), ('\u20acb', '\u20ac')]:
+            result = text.translate(table)
+            self.assertIs(type(result), str)
+            self.assertEqual(result, expected)
+            self.assertEqual(result.isascii(), expected.isascii())
+
+    def test_mapping(self):
+        table = string.TranslationTable('ab', 'xy', 'c')
+        self.assertEqual(len(table), 3)
+        self.assertEqual(table[ord('a')], ord('x'))
+        self.assertIsNone(table[ord('c')])
+        self.assertRaises(KeyError, table.__getitem__, ord('z'))
+        self.assertIn(ord('b'), table)
+        self.assertNotIn(ord('z'), table)
+        self.assertEqual(sorted(table), [ord('a'), ord('b'), ord('c')])
+        self.assertEqual(sorted(table.keys()), sorted(table))
+        self.assertEqual(dict(table.items()), str.maketrans('ab', 'xy', 'c'))
+        self.assertEqual(sorted(table.values(), key=str),
+                         [ord('x'), ord('y'), None])
+        self.assertEqual(table.get(ord('a')), ord('x'))
+        self.assertIsNone(table.get(ord('z')))
+        self.assertEqual(table.get(ord('z'), 0), 0)
+        self.assertEqual(dict(table), str.maketrans('ab', 'xy', 'c'))
+        # other users of translation mappings
+        self.assertEqual('abc'.translate(table), 'xy')
+
+    def test_errors(self):
+        self.assertRaises(TypeError, string.TranslationTable)
+        self.assertRaises(TypeError, string.TranslationTable, [])
+        self.assertRaises(ValueError, string.TranslationTable, 'abc', 'de')
+        self.assertRaises(ValueError, string.TranslationTable, {'xy': 2})
+        # the values are checked when the table is built
+        self.assertRaises(ValueError, string.TranslationTable, {'a': -1})
+        self.assertRaises(ValueError, string.TranslationTable,
+                          {'a': 0x110000})
+        self.assertRaises(OverflowError, string.TranslationTable,
+                          {'a': 2**100})
+        self.assertRaises(TypeError, string.TranslationTable, {'a': 1.5})
+        self.assertRaises(TypeError, string.TranslationTable, {'a': b'x'})
+
+
 # Template tests (formerly housed in test_pep292.py)
 
 class Bag:
@@ -3,6 +3,7 @@
 #endif
 
 #include "Python.h"
+#include "pycore_bytesobject.h"   // _PyBytes_Find()
 #include "pycore_freelist.h"      // _Py_FREELIST_POP()
 #include "pycore_genobject.h"
 #include "pycore_llist.h"         // struct llist_node
@@ -97,6 +98,16 @@ typedef struct {
      || PyObject_TypeCheck(obj, state->FutureType)      \
      || PyObject_TypeCheck(obj, state->TaskType))
 
+typedef struct {
+    PyObject_HEAD
+    PyObject *storage;      /* bytearray holding the data, or NULL */
+    Py_ssize_t start;       /* offset of the first byte of data */
+    Py_ssize_t end;         /* offset after the last byte of data */
+    Py_ssize_t reserved;    /* size of the last get_buffer() result */
+} StreamBufferObj;
+
+#define StreamBufferObj_CAST(op)    ((StreamBufferObj *)(op))
+
 typedef struct _Py_AsyncioModuleDebugOffsets {
     struct _asyncio_task_object {
         uint64_t size;
@@ -146,6 +157,7 @@ typedef struct {
     PyTypeObject *TaskStepMethWrapper_Type;
     PyTypeObject *FutureType;
     PyTypeObject *TaskType;
+    PyTypeObject *StreamBufferType;
 
     PyObject *asyncio_mod;
     PyObject *context_kwname;
@@ -3604,6 +3616,481 @@ task_wakeup(PyObject *op, PyObject *arg)
 }
 
 
+/*********************** StreamBuffer **************************/
+
+/* The buffer of asyncio.StreamReader.  The data lives in a bytearray, the
+   storage, between the start and end offsets: data is consumed by moving
+   the start offset, and received directly into the storage through
+   get_buffer() and buffer_updated() rather than copied from bytes objects.
+   The storage is compacted or grown only when there is no room left after
+   the data; if a memoryview returned by get_buffer() is still alive, the
+   data is moved to a new storage instead. */
+
+/*[clinic input]
+class _asyncio._StreamBuffer "StreamBufferObj *" "get_asyncio_state_by_cls(type)->StreamBufferType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=ffc9c2398e7881ea]*/
+
+/* Free space to make when get_buffer() has no size hint */
+#define STREAM_BUFFER_CHUNK (64 * 1024)
+/* Storage larger than this is released when the buffer becomes empty */
+#define STREAM_BUFFER_MAX_IDLE (4 * STREAM_BUFFER_CHUNK)
+
+static inline Py_ssize_t
+stream_buffer_capacity(StreamBufferObj *self)
+{
+    return self->storage == NULL ? 0 : PyByteArray_GET_SIZE(self->storage);
+}
+
+static inline char *
+stream_buffer_data(StreamBufferObj *self)
+{
+    assert(self->storage != NULL);
+    return PyByteArray_AS_STRING(self->storage) + self->start;
+}
+
+static inline int
+stream_buffer_exported(StreamBufferObj *self)
+{
+    return (self->storage != NULL &&
+            ((PyByteArrayObject *)self->storage)->ob_exports > 0);
+}
+
+/* Called when the buffer becomes empty. */
+static void
+stream_buffer_reset(StreamBufferObj *self)
+{
+    assert(self->start == self->end);
+    if (self->reserved > 0) {
+        /* Keep the offsets of the space handed out by get_buffer(). */
+        return;
+    }
+    self->start = self->end = 0;
+    if (stream_buffer_capacity(self) > STREAM_BUFFER_MAX_IDLE) {
+        /* Give back the memory after a large burst of data.  Memoryviews
+           returned by get_buffer() keep the storage alive. */
+        Py_CLEAR(self->storage);
+    }
+}
+
+/* Make room for at least size bytes after the data. */
+static int
+stream_buffer_reserve(StreamBufferObj *self, Py_ssize_t size)
+{
+    Py_ssize_t capacity = stream_buffer_capacity(self);
+    Py_ssize_t len = self->end - self->start;
+
+    if (capacity - self->end >= size) {
+        return 0;
+    }
+    if (size > PY_SSIZE_T_MAX - len) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    Py_ssize_t needed = len + size;
+    Py_ssize_t new_capacity = capacity;
+    if (new_capacity < needed) {
+        new_capacity = Py_MAX(needed, Py_MIN(capacity, PY_SSIZE_T_MAX / 2) * 2);
+    }
+
+    if (self->storage == NULL || stream_buffer_exported(self)) {
+        /* A memoryview refers to the storage: it cannot be moved. */
+        PyObject *storage = PyByteArray_FromStringAndSize(NULL, new_capacity);
+        if (storage == NULL) {
+            return -1;
+        }
+        if (len > 0) {
+            memcpy(PyByteArray_AS_STRING(storage), stream_buffer_data(self),
+                   len);
+        }
+        Py_XSETREF(self->storage, storage);
+    }
+    else {
+        if (len > 0 && self->start > 0) {
+            memmove(PyByteArray_AS_STRING(self->storage),
+                    stream_buffer_data(self), len);
+        }
+        if (new_capacity != capacity &&
+            PyByteArray_Resize(self->storage, new_capacity) < 0)
+        {
+            self->end = len;
+            self->start = 0;
+            return -1;
+        }
+    }
+    self->start = 0;
+    self->end = len;
+    return 0;
+}
+
+/* Normalize a start index like a slice of the data does. */
+static inline Py_ssize_t
+stream_buffer_adjust_index(StreamBufferObj *self, Py_ssize_t index)
+{
+    Py_ssize_t len = self->end - self->start;
+    if (index < 0) {
+        index += len;
+        if (index < 0) {
+            index = 0;
+        }
+    }
+    return index;
+}
+
+/*[clinic input]
+@classmethod
+_asyncio._StreamBuffer.__new__ as stream_buffer_new
+
+Buffer of asyncio.StreamReader.
+[clinic start generated code]*/
+
+static PyObject *
+stream_buffer_new_impl(PyTypeObject *type)
+/*[clinic end generated code: output=ee41a8db4c4355ef input=4a8f658bb150083b]*/
+{
+    StreamBufferObj *self = (StreamBufferObj *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->storage = NULL;
+    self->start = self->end = self->reserved = 0;
+    return (PyObject *)self;
+}
+
+static void
+StreamBufferObj_dealloc(PyObject *op)
+{
+    StreamBufferObj *self = StreamBufferObj_CAST(op);
+    PyTypeObject *tp = Py_TYPE(self);
+    Py_XDECREF(self->storage);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.extend
+
+    data: Py_buffer
+    /
+
+Append data to the end of the buffer.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_extend_impl(StreamBufferObj *self, Py_buffer *data)
+/*[clinic end generated code: output=e60d8ec03a60a719 input=c4aeac709ac5c730]*/
+{
+    if (data->len == 0) {
+        Py_RETURN_NONE;
+    }
+    if (self->start == self->end) {
+        stream_buffer_reset(self);
+    }
+    self->reserved = 0;
+    if (stream_buffer_reserve(self, data->len) < 0) {
+        return NULL;
+    }
+    memcpy(PyByteArray_AS_STRING(self->storage) + self->end, data->buf,
+           data->len);
+    self->end += data->len;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.get_buffer
+
+    sizehint: Py_ssize_t
+    /
+
+Return a writable memoryview of the free space after the data.
+
+Like BufferedProtocol.get_buffer(), the memoryview has at least sizehint
+bytes, or a default size if sizehint is not positive.  Bytes written to it
+are added to the buffer by buffer_updated().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_get_buffer_impl(StreamBufferObj *self,
+                                       Py_ssize_t sizehint)
+/*[clinic end generated code: output=9567b70c1b22311e input=e16b01de5c411cce]*/
+{
+    if (sizehint <= 0) {
+        sizehint = STREAM_BUFFER_CHUNK;
+    }
+    self->reserved = 0;
+    if (self->start == self->end) {
+        stream_buffer_reset(self);
+    }
+    if (stream_buffer_reserve(self, sizehint) < 0) {
+        return NULL;
+    }
+
+    PyObject *view = PyMemoryView_FromObject(self->storage);
+    if (view == NULL) {
+        return NULL;
+    }
+    Py_ssize_t capacity = stream_buffer_capacity(self);
+    PyObject *free_space = PySequence_GetSlice(view, self->end, capacity);
+    Py_DECREF(view);
+    if (free_space == NULL) {
+        return NULL;
+    }
+    self->reserved = capacity - self->end;
+    return free_space;
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.buffer_updated
+
+    nbytes: Py_ssize_t
+    /
+
+Add the first nbytes bytes of the last get_buffer() result to the buffer.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_buffer_updated_impl(StreamBufferObj *self,
+                                           Py_ssize_t nbytes)
+/*[clinic end generated code: output=a92007dd332a3c54 input=ff22dace3d7d5e0e]*/
+{
+    if (nbytes < 0 || nbytes > self->reserved) {
+        PyErr_SetString(PyExc_ValueError,
+                        "nbytes exceeds the size of the last get_buffer() "
+                        "result");
+        return NULL;
+    }
+    self->end += nbytes;
+    self->reserved = 0;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.take
+
+    n: Py_ssize_t
+    /
+
+Remove up to n bytes from the start of the buffer and return them.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_take_impl(StreamBufferObj *self, Py_ssize_t n)
+/*[clinic end generated code: output=79cf2a61ca9d1a80 input=9e530d2d550170c0]*/
+{
+    if (n < 0) {
+        PyErr_SetString(PyExc_ValueError, "n must be non-negative");
+        return NULL;
+    }
+    n = Py_MIN(n, self->end - self->start);
+    if (n == 0) {
+        return Py_GetConstant(Py_CONSTANT_EMPTY_BYTES);
+    }
+    PyObject *data = PyBytes_FromStringAndSize(stream_buffer_data(self), n);
+    if (data == NULL) {
+        return NULL;
+    }
+    self->start += n;
+    if (self->start == self->end) {
+        stream_buffer_reset(self);
+    }
+    return data;
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.clear
+
+Remove all data from the buffer.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_clear_impl(StreamBufferObj *self)
+/*[clinic end generated code: output=68085c7b245593a0 input=d2c20018d6f81dcf]*/
+{
+    self->reserved = 0;
+    self->start = self->end;
+    stream_buffer_reset(self);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.find
+
+    sub: Py_buffer
+    start: Py_ssize_t = 0
+    /
+
+Return the lowest index of sub in the data, or -1 if it is not found.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_find_impl(StreamBufferObj *self, Py_buffer *sub,
+                                 Py_ssize_t start)
+/*[clinic end generated code: output=bb9a5856177e2f94 input=be2d1f804d1a2682]*/
+{
+    Py_ssize_t len = self->end - self->start;
+    start = stream_buffer_adjust_index(self, start);
+    if (start > len) {
+        return PyLong_FromLong(-1);
+    }
+    if (sub->len == 0) {
+        return PyLong_FromSsize_t(start);
+    }
+    if (sub->len > len - start) {
+        return PyLong_FromLong(-1);
+    }
+    Py_ssize_t index = _PyBytes_Find(stream_buffer_data(self) + start,
+                                     len - start, sub->buf, sub->len, start);
+    return PyLong_FromSsize_t(index);
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.startswith
+
+    prefix: Py_buffer
+    start: Py_ssize_t = 0
+    /
+
+Return True if the data at start begins with prefix.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_startswith_impl(StreamBufferObj *self,
+                                       Py_buffer *prefix, Py_ssize_t start)
+/*[clinic end generated code: output=cd968cf07a3bd828 input=246795b85a1b3361]*/
+{
+    Py_ssize_t len = self->end - self->start;
+    start = stream_buffer_adjust_index(self, start);
+    if (start > len || prefix->len > len - start) {
+        Py_RETURN_FALSE;
+    }
+    if (prefix->len == 0) {
+        Py_RETURN_TRUE;
+    }
+    return PyBool_FromLong(memcmp(stream_buffer_data(self) + start,
+                                  prefix->buf, prefix->len) == 0);
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.__bytes__
+
+Return a copy of the data.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer___bytes___impl(StreamBufferObj *self)
+/*[clinic end generated code: output=cb65662d97d56ee1 input=e328cfac2aeb76f2]*/
+{
+    Py_ssize_t len = self->end - self->start;
+    if (len == 0) {
+        return Py_GetConstant(Py_CONSTANT_EMPTY_BYTES);
+    }
+    return PyBytes_FromStringAndSize(stream_buffer_data(self), len);
+}
+
+/*[clinic input]
+@critical_section
+_asyncio._StreamBuffer.__sizeof__
+
+Return the size of the buffer in memory, in bytes.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer___sizeof___impl(StreamBufferObj *self)
+/*[clinic end generated code: output=19dc34e943adc200 input=bed2bd1d41f4cdd3]*/
+{
+    Py_ssize_t size = Py_TYPE(self)->tp_basicsize;
+    if (self->storage != NULL) {
+        size += ((PyByteArrayObject *)self->storage)->ob_alloc;
+    }
+    return PyLong_FromSsize_t(size);
+}
+
+static Py_ssize_t
+StreamBufferObj_length(PyObject *op)
+{
+    StreamBufferObj *self = StreamBufferObj_CAST(op);
+    Py_ssize_t len;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    len = self->end - self->start;
+    Py_END_CRITICAL_SECTION();
+    return len;
+}
+
+static PyObject *
+StreamBufferObj_richcompare(PyObject *op, PyObject *other, int cmp)
+{
+    if ((cmp != Py_EQ && cmp != Py_NE) || !PyObject_CheckBuffer(other)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    Py_buffer view;
+    if (PyObject_GetBuffer(other, &view, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+    StreamBufferObj *self = StreamBufferObj_CAST(op);
+    int equal;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    Py_ssize_t len = self->end - self->start;
+    equal = (len == view.len &&
+             (len == 0 ||
+              memcmp(stream_buffer_data(self), view.buf, len) == 0));
+    Py_END_CRITICAL_SECTION();
+    PyBuffer_Release(&view);
+    return PyBool_FromLong(cmp == Py_EQ ? equal : !equal);
+}
+
+static PyObject *
+StreamBufferObj_repr(PyObject *op)
+{
+    PyObject *data = _asyncio__StreamBuffer___bytes__(op, NULL);
+    if (data == NULL) {
+        return NULL;
+    }
+    PyObject *repr = PyUnicode_FromFormat("%s(%R)",
+                                          _PyType_Name(Py_TYPE(op)), data);
+    Py_DECREF(data);
+    return repr;
+}
+
+static PyMethodDef StreamBuffer_methods[] = {
+    _ASYNCIO__STREAMBUFFER_EXTEND_METHODDEF
+    _ASYNCIO__STREAMBUFFER_GET_BUFFER_METHODDEF
+    _ASYNCIO__STREAMBUFFER_BUFFER_UPDATED_METHODDEF
+    _ASYNCIO__STREAMBUFFER_TAKE_METHODDEF
+    _ASYNCIO__STREAMBUFFER_CLEAR_METHODDEF
+    _ASYNCIO__STREAMBUFFER_FIND_METHODDEF
+    _ASYNCIO__STREAMBUFFER_STARTSWITH_METHODDEF
+    _ASYNCIO__STREAMBUFFER___BYTES___METHODDEF
+    _ASYNCIO__STREAMBUFFER___SIZEOF___METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyType_Slot StreamBuffer_slots[] = {
+    {Py_tp_dealloc, StreamBufferObj_dealloc},
+    {Py_tp_repr, StreamBufferObj_repr},
+    {Py_tp_richcompare, StreamBufferObj_richcompare},
+    {Py_tp_methods, StreamBuffer_methods},
+    {Py_tp_new, stream_buffer_new},
+    {Py_tp_doc, (void *)stream_buffer_new__doc__},
+    {Py_sq_length, StreamBufferObj_length},
+    {0, NULL},
+};
+
+static PyType_Spec StreamBuffer_spec = {
+    .name = "_asyncio._StreamBuffer",
+    .basicsize = sizeof(StreamBufferObj),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE,
+    .slots = StreamBuffer_slots,
+};
+
+
 /*********************** Functions **************************/
 
 
@@ -3888,6 +4375,393 @@ _asyncio__swap_current_task_impl(PyObject *module, PyObject *loop,
 }
 
 
+/* The heap of scheduled TimerHandles of BaseEventLoop.  These mirror the
+   heapq functions but compare the _when attributes directly instead of
+   calling TimerHandle.__lt__() for each comparison. */
+
+static int
+timer_lt(PyObject *a, PyObject *b)
+{
+    PyObject *when_a = PyObject_GetAttr(a, &_Py_ID(_when));
+    if (when_a == NULL) {
+        return -1;
+    }
+    PyObject *when_b = PyObject_GetAttr(b, &_Py_ID(_when));
+    if (when_b == NULL) {
+        Py_DECREF(when_a);
+        return -1;
+    }
+    int res;
+    if (PyFloat_CheckExact(when_a) && PyFloat_CheckExact(when_b)) {
+        res = PyFloat_AS_DOUBLE(when_a) < PyFloat_AS_DOUBLE(when_b);
+    }
+    else {
+        res = PyObject_RichCompareBool(when_a, when_b, Py_LT);
+    }
+    Py_DECREF(when_a);
+    Py_DECREF(when_b);
+    return res;
+}
+
+static int
+timer_siftdown(PyListObject *heap, Py_ssize_t startpos, Py_ssize_t pos)
+{
+    PyObject *newitem, *parent, **arr;
+    Py_ssize_t parentpos, size;
+    int cmp;
+
+    size = PyList_GET_SIZE(heap);
+    assert(pos < size);
+
+    /* Follow the path to the root, moving parents down until finding
+       a place newitem fits. */
+    arr = _PyList_ITEMS(heap);
+    newitem = arr[pos];
+    while (pos > startpos) {
+        parentpos = (pos - 1) >> 1;
+        parent = arr[parentpos];
+        Py_INCREF(newitem);
+        Py_INCREF(parent);
+        cmp = timer_lt(newitem, parent);
+        Py_DECREF(parent);
+        Py_DECREF(newitem);
+        if (cmp < 0) {
+            return -1;
+        }
+        if (size != PyList_GET_SIZE(heap)) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "list changed size during iteration");
+            return -1;
+        }
+        if (cmp == 0) {
+            break;
+        }
+        arr = _PyList_ITEMS(heap);
+        parent = arr[parentpos];
+        newitem = arr[pos];
+        arr[parentpos] = newitem;
+        arr[pos] = parent;
+        pos = parentpos;
+    }
+    return 0;
+}
+
+static int
+timer_siftup(PyListObject *heap, Py_ssize_t pos)
+{
+    Py_ssize_t startpos, endpos, childpos, limit;
+    PyObject *tmp1, *tmp2, **arr;
+    int cmp;
+
+    endpos = PyList_GET_SIZE(heap);
+    startpos = pos;
+    assert(pos < endpos);
+
+    /* Bubble up the smaller child until hitting a leaf. */
+    arr = _PyList_ITEMS(heap);
+    limit = endpos >> 1;         /* smallest pos that has no child */
+    while (pos < limit) {
+        /* Set childpos to index of smaller child.   */
+        childpos = 2*pos + 1;    /* leftmost child position  */
+        if (childpos + 1 < endpos) {
+            PyObject *a = arr[childpos];
+            PyObject *b = arr[childpos + 1];
+            Py_INCREF(a);
+            Py_INCREF(b);
+            cmp = timer_lt(a, b);
+            Py_DECREF(a);
+            Py_DECREF(b);
+            if (cmp < 0) {
+                return -1;
+            }
+            childpos += ((unsigned)cmp ^ 1);   /* increment when cmp==0 */
+            arr = _PyList_ITEMS(heap);         /* arr may have changed */
+            if (endpos != PyList_GET_SIZE(heap)) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "list changed size during iteration");
+                return -1;
+            }
+        }
+        /* Move the smaller child up. */
+        tmp1 = arr[childpos];
+        tmp2 = arr[pos];
+        arr[childpos] = tmp2;
+        arr[pos] = tmp1;
+        pos = childpos;
+    }
+    /* Bubble it up to its final resting place (by sifting its parents down). */
+    return timer_siftdown(heap, startpos, pos);
+}
+
+/* Pop the earliest timer off the heap and mark it as no longer scheduled. */
+static PyObject *
+timer_heappop(PyObject *heap)
+{
+    Py_ssize_t n = PyList_GET_SIZE(heap);
+    assert(n > 0);
+
+    PyObject *lastelt = Py_NewRef(PyList_GET_ITEM(heap, n - 1));
+    if (PyList_SetSlice(heap, n - 1, n, NULL) < 0) {
+        Py_DECREF(lastelt);
+        return NULL;
+    }
+    n--;
+
+    PyObject *timer;
+    if (n == 0) {
+        timer = lastelt;
+    }
+    else {
+        timer = PyList_GET_ITEM(heap, 0);
+        PyList_SET_ITEM(heap, 0, lastelt);
+        if (timer_siftup((PyListObject *)heap, 0) < 0) {
+            Py_DECREF(timer);
+            return NULL;
+        }
+    }
+    if (PyObject_SetAttr(timer, &_Py_ID(_scheduled), Py_False) < 0) {
+        Py_DECREF(timer);
+        return NULL;
+    }
+    return timer;
+}
+
+static int
+timer_is_cancelled(PyObject *timer)
+{
+    PyObject *cancelled = PyObject_GetAttr(timer, &_Py_ID(_cancelled));
+    if (cancelled == NULL) {
+        return -1;
+    }
+    int res = PyObject_IsTrue(cancelled);
+    Py_DECREF(cancelled);
+    return res;
+}
+
+
+/*[clinic input]
+_asyncio._schedule_timer
+
+    scheduled: object(subclass_of='&PyList_Type')
+    timer: object
+    /
+
+Push a TimerHandle onto the heap of scheduled timers.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__schedule_timer_impl(PyObject *module, PyObject *scheduled,
+                              PyObject *timer)
+/*[clinic end generated code: output=27427daf8bd5f992 input=f6e82f0229ba7f84]*/
+{
+    if (PyList_Append(scheduled, timer) < 0) {
+        return NULL;
+    }
+    if (timer_siftdown((PyListObject *)scheduled, 0,
+                       PyList_GET_SIZE(scheduled) - 1) < 0) {
+        return NULL;
+    }
+    if (PyObject_SetAttr(timer, &_Py_ID(_scheduled), Py_True) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._pop_cancelled_timers -> Py_ssize_t
+
+    scheduled: object(subclass_of='&PyList_Type')
+    /
+
+Pop the cancelled timers at the head of the heap.
+
+Returns the number of timers removed.
+[clinic start generated code]*/
+
+static Py_ssize_t
+_asyncio__pop_cancelled_timers_impl(PyObject *module, PyObject *scheduled)
+/*[clinic end generated code: output=3c83664aa09cbd00 input=851526f0396b24e1]*/
+{
+    Py_ssize_t count = 0;
+    while (PyList_GET_SIZE(scheduled) > 0) {
+        int cancelled = timer_is_cancelled(PyList_GET_ITEM(scheduled, 0));
+        if (cancelled < 0) {
+            return -1;
+        }
+        if (!cancelled) {
+            break;
+        }
+        PyObject *timer = timer_heappop(scheduled);
+        if (timer == NULL) {
+            return -1;
+        }
+        Py_DECREF(timer);
+        count++;
+    }
+    return count;
+}
+
+
+/*[clinic input]
+_asyncio._remove_cancelled_timers
+
+    scheduled: object(subclass_of='&PyList_Type')
+    /
+
+Remove all cancelled timers from the heap of scheduled timers.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__remove_cancelled_timers_impl(PyObject *module, PyObject *scheduled)
+/*[clinic end generated code: output=02a5430447dd0b48 input=47fdda1360dd34f7]*/
+{
+    PyObject *kept = PyList_New(0);
+    if (kept == NULL) {
+        return NULL;
+    }
+    Py_ssize_t n = PyList_GET_SIZE(scheduled);
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *timer = Py_NewRef(PyList_GET_ITEM(scheduled, i));
+        int cancelled = timer_is_cancelled(timer);
+        if (cancelled > 0) {
+            cancelled = PyObject_SetAttr(timer, &_Py_ID(_scheduled),
+                                         Py_False);
+            cancelled = cancelled < 0 ? -1 : 1;
+        }
+        else if (cancelled == 0 && PyList_Append(kept, timer) < 0) {
+            cancelled = -1;
+        }
+        Py_DECREF(timer);
+        if (cancelled < 0) {
+            goto error;
+        }
+        if (n != PyList_GET_SIZE(scheduled)) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "list changed size during iteration");
+            goto error;
+        }
+    }
+
+    /* Transform the kept timers into a heap, in place, in O(len(kept))
+       time, like heapq.heapify(). */
+    n = PyList_GET_SIZE(kept);
+    for (Py_ssize_t i = (n >> 1) - 1; i >= 0; i--) {
+        if (timer_siftup((PyListObject *)kept, i) < 0) {
+            goto error;
+        }
+    }
+    if (PyList_SetSlice(scheduled, 0, PY_SSIZE_T_MAX, kept) < 0) {
+        goto error;
+    }
+    Py_DECREF(kept);
+    Py_RETURN_NONE;
+
+error:
+    Py_DECREF(kept);
+    return NULL;
+}
+
+
+/*[clinic input]
+_asyncio._pop_due_timers
+
+    scheduled: object(subclass_of='&PyList_Type')
+    ready: object
+    end_time: object
+    /
+
+Move the timers due before end_time from the heap to the ready queue.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__pop_due_timers_impl(PyObject *module, PyObject *scheduled,
+                              PyObject *ready, PyObject *end_time)
+/*[clinic end generated code: output=7b8c213cfae5f993 input=1f8818398f916341]*/
+{
+    while (PyList_GET_SIZE(scheduled) > 0) {
+        PyObject *when = PyObject_GetAttr(PyList_GET_ITEM(scheduled, 0),
+                                          &_Py_ID(_when));
+        if (when == NULL) {
+            return NULL;
+        }
+        int due;
+        if (PyFloat_CheckExact(when) && PyFloat_CheckExact(end_time)) {
+            due = PyFloat_AS_DOUBLE(when) < PyFloat_AS_DOUBLE(end_time);
+        }
+        else {
+            due = PyObject_RichCompareBool(when, end_time, Py_LT);
+        }
+        Py_DECREF(when);
+        if (due <= 0) {
+            if (due < 0) {
+                return NULL;
+            }
+            break;
+        }
+        PyObject *timer = timer_heappop(scheduled);
+        if (timer == NULL) {
+            return NULL;
+        }
+        PyObject *res = PyObject_CallMethodOneArg(ready, &_Py_ID(append),
+                                                  timer);
+        Py_DECREF(timer);
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._run_ready
+
+    ready: object
+    ntodo: Py_ssize_t
+    /
+
+Pop the first ntodo handles of the ready queue and run them.
+
+Cancelled handles are skipped.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__run_ready_impl(PyObject *module, PyObject *ready, Py_ssize_t ntodo)
+/*[clinic end generated code: output=07b364c488de9d1f input=40d89fc9358d0366]*/
+{
+    PyObject *popleft = PyObject_GetAttr(ready, &_Py_ID(popleft));
+    if (popleft == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < ntodo; i++) {
+        PyObject *handle = PyObject_CallNoArgs(popleft);
+        if (handle == NULL) {
+            goto error;
+        }
+        int cancelled = timer_is_cancelled(handle);
+        if (cancelled == 0) {
+            PyObject *res = PyObject_CallMethodNoArgs(handle, &_Py_ID(_run));
+            if (res == NULL) {
+                cancelled = -1;
+            }
+            Py_XDECREF(res);
+        }
+        Py_DECREF(handle);
+        if (cancelled < 0) {
+            goto error;
+        }
+    }
+    Py_DECREF(popleft);
+    Py_RETURN_NONE;
+
+error:
+    Py_DECREF(popleft);
+    return NULL;
+}
+
+
 /*[clinic input]
 _asyncio.current_task
 
@@ -4193,6 +5067,7 @@ module_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->TaskStepMethWrapper_Type);
     Py_VISIT(state->FutureType);
     Py_VISIT(state->TaskType);
+    Py_VISIT(state->StreamBufferType);
 
     Py_VISIT(state->asyncio_mod);
     Py_VISIT(state->traceback_extract_stack);
@@ -4223,6 +5098,7 @@ module_clear(PyObject *mod)
     Py_CLEAR(state->TaskStepMethWrapper_Type);
     Py_CLEAR(state->FutureType);
     Py_CLEAR(state->TaskType);
+    Py_CLEAR(state->StreamBufferType);
 
     Py_CLEAR(state->asyncio_mod);
     Py_CLEAR(state->traceback_extract_stack);
@@ -4352,6 +5228,11 @@ static PyMethodDef asyncio_methods[] = {
     _ASYNCIO__ENTER_TASK_METHODDEF
     _ASYNCIO__LEAVE_TASK_METHODDEF
     _ASYNCIO__SWAP_CURRENT_TASK_METHODDEF
+    _ASYNCIO__SCHEDULE_TIMER_METHODDEF
+    _ASYNCIO__POP_CANCELLED_TIMERS_METHODDEF
+    _ASYNCIO__REMOVE_CANCELLED_TIMERS_METHODDEF
+    _ASYNCIO__POP_DUE_TIMERS_METHODDEF
+    _ASYNCIO__RUN_READY_METHODDEF
     _ASYNCIO_ALL_TASKS_METHODDEF
     _ASYNCIO_FUTURE_ADD_TO_AWAITED_BY_METHODDEF
     _ASYNCIO_FUTURE_DISCARD_FROM_AWAITED_BY_METHODDEF
@@ -4377,6 +5258,7 @@ module_exec(PyObject *mod)
     CREATE_TYPE(mod, state->FutureIterType, &FutureIter_spec, NULL);
     CREATE_TYPE(mod, state->FutureType, &Future_spec, NULL);
     CREATE_TYPE(mod, state->TaskType, &Task_spec, state->FutureType);
+    CREATE_TYPE(mod, state->StreamBufferType, &StreamBuffer_spec, NULL);
 
 #undef CREATE_TYPE
 
@@ -4387,6 +5269,10 @@ module_exec(PyObject *mod)
     if (PyModule_AddType(mod, state->TaskType) < 0) {
         return -1;
     }
+
+    if (PyModule_AddType(mod, state->StreamBufferType) < 0) {
+        return -1;
+    }
     // Must be done after types are added to avoid a circular dependency
     if (module_init(state) < 0) {
         return -1;
@@ -9,11 +9,16 @@
 
 #include "Python.h"
 #include "pycore_call.h"                // _PyObject_CallNoArgs()
+#include "pycore_critical_section.h"    // Py_BEGIN_CRITICAL_SECTION()
 #include "pycore_fileutils.h"           // _PyFile_Flush
 #include "pycore_object.h"              // _PyObject_GC_UNTRACK()
 #include "pycore_pyerrors.h"            // _Py_FatalErrorFormat()
 #include "pycore_pylifecycle.h"         // _Py_IsInterpreterFinalizing()
 
+#ifdef HAVE_FCNTL_H
+#  include <fcntl.h>              // posix_fadvise()
+#endif
+
 #include "_iomodule.h"
 
 /*[clinic input]
@@ -258,6 +263,20 @@ typedef struct {
     Py_ssize_t buffer_size;
     Py_ssize_t buffer_mask;
 
+    /* Adaptive buffering (BufferedReader only): the buffer grows while
+       the stream is read sequentially and shrinks back on seeks. */
+    char adaptive;
+    /* True if the raw stream is a FileIO, so that posix_fadvise() can
+       be applied to its file descriptor. */
+    char can_advise;
+    char advised;
+    int sequential_fills;
+    Py_ssize_t initial_buffer_size;
+
+    /* Statistics */
+    unsigned long long raw_reads;
+    unsigned long long bytes_copied;
+
     PyObject *dict;
     PyObject *weakreflist;
 } buffered;
@@ -400,6 +419,15 @@ _enter_buffered_busy(buffered *self)
         (size & ~self->buffer_mask) : \
         (self->buffer_size * (size / self->buffer_size)))
 
+/* Bounds and growth rate of the buffer in adaptive mode.  The buffer never
+   shrinks below the smaller of the initial size and ADAPTIVE_MIN_BUFFER_SIZE,
+   and never grows above the larger of the initial size and
+   ADAPTIVE_MAX_BUFFER_SIZE.  It doubles every ADAPTIVE_SEQUENTIAL_FILLS
+   consecutive refills which were not separated by a seek. */
+#define ADAPTIVE_MIN_BUFFER_SIZE (8 * 1024)
+#define ADAPTIVE_MAX_BUFFER_SIZE (1024 * 1024)
+#define ADAPTIVE_SEQUENTIAL_FILLS 2
+
 
 static int
 buffered_clear(PyObject *op)
@@ -690,6 +718,45 @@ _io__Buffered_mode_get_impl(buffered *self)
     return PyObject_GetAttr(self->raw, &_Py_ID(mode));
 }
 
+/*[clinic input]
+@critical_section
+@getter
+_io._Buffered.buffer_size
+[clinic start generated code]*/
+
+static PyObject *
+_io__Buffered_buffer_size_get_impl(buffered *self)
+/*[clinic end generated code: output=2ead8b04a183fe60 input=6b16622ad6230c6f]*/
+{
+    return PyLong_FromSsize_t(self->buffer_size);
+}
+
+/*[clinic input]
+@critical_section
+@getter
+_io._Buffered.raw_reads
+[clinic start generated code]*/
+
+static PyObject *
+_io__Buffered_raw_reads_get_impl(buffered *self)
+/*[clinic end generated code: output=c40fd0d7d9770efa input=cca5ebfa7361c29a]*/
+{
+    return PyLong_FromUnsignedLongLong(self->raw_reads);
+}
+
+/*[clinic input]
+@critical_section
+@getter
+_io._Buffered.bytes_copied
+[clinic start generated code]*/
+
+static PyObject *
+_io__Buffered_bytes_copied_get_impl(buffered *self)
+/*[clinic end generated code: output=cafb641574bd7385 input=97f75d9248e64656]*/
+{
+    return PyLong_FromUnsignedLongLong(self->bytes_copied);
+}
+
 /* Lower-level APIs */
 
 /*[clinic input]
@@ -737,6 +804,8 @@ static PyObject *
 _bufferedreader_read_generic(buffered *self, Py_ssize_t);
 static Py_ssize_t
 _bufferedreader_raw_read(buffered *self, char *start, Py_ssize_t len);
+static void
+_bufferedreader_adapt_on_seek(buffered *self);
 
 /*
  * Helpers
@@ -825,10 +894,23 @@ _buffered_raw_seek(buffered *self, Py_off_t target, int whence)
     return n;
 }
 
+static void
+_buffered_set_mask(buffered *self)
+{
+    Py_ssize_t n;
+    /* Find out whether buffer_size is a power of 2 */
+    /* XXX is this optimization useful? */
+    for (n = self->buffer_size - 1; n & 1; n >>= 1)
+        ;
+    if (n == 0)
+        self->buffer_mask = self->buffer_size - 1;
+    else
+        self->buffer_mask = 0;
+}
+
 static int
 _buffered_init(buffered *self)
 {
-    Py_ssize_t n;
     if (self->buffer_size <= 0) {
         PyErr_SetString(PyExc_ValueError,
             "buffer size must be strictly positive");
@@ -849,14 +931,14 @@ _buffered_init(buffered *self)
         return -1;
     }
     self->owner = 0;
-    /* Find out whether buffer_size is a power of 2 */
-    /* XXX is this optimization useful? */
-    for (n = self->buffer_size - 1; n & 1; n >>= 1)
-        ;
-    if (n == 0)
-        self->buffer_mask = self->buffer_size - 1;
-    else
-        self->buffer_mask = 0;
+    _buffered_set_mask(self);
+    self->adaptive = 0;
+    self->can_advise = 0;
+    self->advised = 0;
+    self->sequential_fills = 0;
+    self->initial_buffer_size = self->buffer_size;
+    self->raw_reads = 0;
+    self->bytes_copied = 0;
     if (_buffered_raw_tell(self) == -1)
         PyErr_Clear();
     return 0;
@@ -1435,6 +1517,8 @@ _io__Buffered_seek_impl(buffered *self, PyObject *targetobj, int whence)
     res = PyLong_FromOff_t(n);
     if (res != NULL && self->readable)
         _bufferedreader_reset_buf(self);
+    if (res != NULL && self->adaptive)
+        _bufferedreader_adapt_on_seek(self);
 
 end:
     LEAVE_BUFFERED(self)
@@ -1482,6 +1566,185 @@ _io__Buffered_truncate_impl(buffered *self, PyTypeObject *cls, PyObject *pos)
     return res;
 }
 
+/*
+ * Positional I/O, which bypasses the buffer
+ */
+
+/* Flush the pending writes, so that a positional read sees them, and return
+   a new reference to the raw stream. */
+static PyObject *
+_buffered_prepare_pread_lock_held(buffered *self)
+{
+    PyObject *res;
+
+    CHECK_INITIALIZED(self)
+    CHECK_CLOSED(self, "read of closed file")
+
+    if (VALID_WRITE_BUFFER(self)) {
+        if (!ENTER_BUFFERED(self))
+            return NULL;
+        res = _bufferedwriter_flush_unlocked(self);
+        LEAVE_BUFFERED(self)
+        if (res == NULL)
+            return NULL;
+        Py_DECREF(res);
+    }
+    return Py_NewRef(self->raw);
+}
+
+/* The raw read is done without holding any lock, so that several threads
+   can read from the file at once. */
+static PyObject *
+_buffered_pread_generic(buffered *self, PyObject *name,
+                        PyObject *arg, PyObject *offset)
+{
+    PyObject *raw, *res;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    raw = _buffered_prepare_pread_lock_held(self);
+    Py_END_CRITICAL_SECTION();
+    if (raw == NULL)
+        return NULL;
+    res = PyObject_CallMethodObjArgs(raw, name, arg, offset, NULL);
+    Py_DECREF(raw);
+    return res;
+}
+
+/*[clinic input]
+_io._Buffered.pread
+    size: object
+    offset: object
+    /
+
+Read at most size bytes at offset from the raw stream.
+
+Pending writes are flushed first.  The current position is neither used
+nor changed.
+[clinic start generated code]*/
+
+static PyObject *
+_io__Buffered_pread_impl(buffered *self, PyObject *size, PyObject *offset)
+/*[clinic end generated code: output=e208055e007589df input=2947425bcb0bad98]*/
+{
+    return _buffered_pread_generic(self, &_Py_ID(pread), size, offset);
+}
+
+/*[clinic input]
+_io._Buffered.preadv
+    buffers: object
+    offset: object
+    /
+
+Read from the raw stream at offset into a sequence of writable buffers.
+
+Pending writes are flushed first.  The current position is neither used
+nor changed.
+[clinic start generated code]*/
+
+static PyObject *
+_io__Buffered_preadv_impl(buffered *self, PyObject *buffers,
+                          PyObject *offset)
+/*[clinic end generated code: output=e66bc1fe677d32cc input=d024273395a0fac2]*/
+{
+    return _buffered_pread_generic(self, &_Py_ID(preadv), buffers, offset);
+}
+
+static PyObject *
+_buffered_pwrite_generic(buffered *self, PyTypeObject *cls, PyObject *name,
+                         PyObject *arg, PyObject *offset)
+{
+    PyObject *res;
+    Py_off_t start, n, buf_start;
+
+    CHECK_INITIALIZED(self)
+    CHECK_CLOSED(self, "write to closed file")
+    if (!self->writable) {
+        _PyIO_State *state = get_io_state_by_cls(cls);
+        return bufferediobase_unsupported(state, "pwrite");
+    }
+    if (!ENTER_BUFFERED(self))
+        return NULL;
+
+    /* Data passed to write() before reaches the file first */
+    res = _bufferedwriter_flush_unlocked(self);
+    if (res == NULL)
+        goto end;
+    Py_DECREF(res);
+
+    res = PyObject_CallMethodObjArgs(self->raw, name, arg, offset, NULL);
+    if (res == NULL || res == Py_None || !VALID_READ_BUFFER(self))
+        goto end;
+
+    /* Drop the read buffer if it holds data which was just overwritten */
+    n = PyNumber_AsOff_t(res, PyExc_ValueError);
+    if (n == -1 && PyErr_Occurred())
+        goto error;
+    start = PyNumber_AsOff_t(offset, PyExc_OverflowError);
+    if (start == -1 && PyErr_Occurred())
+        goto error;
+    buf_start = self->abs_pos - self->raw_pos;
+    if (n > 0 &&
+        (self->abs_pos < 0 || self->raw_pos < 0 ||
+         (start < buf_start + self->read_end && start + n > buf_start)))
+    {
+        n = _buffered_raw_seek(self, -RAW_OFFSET(self), 1);
+        _bufferedreader_reset_buf(self);
+        if (n == -1)
+            goto error;
+    }
+    goto end;
+
+error:
+    Py_CLEAR(res);
+end:
+    LEAVE_BUFFERED(self)
+    return res;
+}
+
+/*[clinic input]
+@critical_section
+_io._Buffered.pwrite
+    cls: defining_class
+    buffer: object
+    offset: object
+    /
+
+Write buffer to the raw stream at offset, return number of bytes written.
+
+Pending writes are flushed first.  The current position is not changed.
+[clinic start generated code]*/
+
+static PyObject *
+_io__Buffered_pwrite_impl(buffered *self, PyTypeObject *cls,
+                          PyObject *buffer, PyObject *offset)
+/*[clinic end generated code: output=503d5f328e07fd26 input=f189e51421c9013a]*/
+{
+    return _buffered_pwrite_generic(self, cls, &_Py_ID(pwrite),
+                                    buffer, offset);
+}
+
+/*[clinic input]
+@critical_section
+_io._Buffered.pwritev
+    cls: defining_class
+    buffers: object
+    offset: object
+    /
+
+Write a sequence of buffers to the raw stream at offset.
+
+Pending writes are flushed first.  The current position is not changed.
+[clinic start generated code]*/
+
+static PyObject *
+_io__Buffered_pwritev_impl(buffered *self, PyTypeObject *cls,
+                           PyObject *buffers, PyObject *offset)
+/*[clinic end generated code: output=2be413616f14b7f3 input=a0dc4e9e4b4146e5]*/
+{
+    return _buffered_pwrite_generic(self, cls, &_Py_ID(pwritev),
+                                    buffers, offset);
+}
+
 static PyObject *
 buffered_iternext(PyObject *op)
 {
@@ -1566,18 +1829,101 @@ static void _bufferedreader_reset_buf(buffered *self)
     self->read_end = -1;
 }
 
+/* Replace the buffer with a new one of the given size.  The buffered data
+   is discarded, so this must only be called when the buffer is invalid or
+   about to be refilled from the start.  On memory errors the current buffer
+   is kept: adaptive sizing is only a hint. */
+static void
+_bufferedreader_resize_buf(buffered *self, Py_ssize_t size)
+{
+    char *buffer = PyMem_Malloc(size);
+    if (buffer == NULL)
+        return;
+    PyMem_Free(self->buffer);
+    self->buffer = buffer;
+    self->buffer_size = size;
+    _buffered_set_mask(self);
+}
+
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_SEQUENTIAL)
+/* Pass an access pattern hint for the raw file to the kernel.  Errors are
+   ignored. */
+static void
+_bufferedreader_advise(buffered *self, int advice)
+{
+    PyObject *res = PyObject_CallMethodNoArgs(self->raw, &_Py_ID(fileno));
+    if (res == NULL) {
+        PyErr_Clear();
+        return;
+    }
+    int fd = PyLong_AsInt(res);
+    Py_DECREF(res);
+    if (fd < 0) {
+        PyErr_Clear();
+        return;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    (void)posix_fadvise(fd, 0, 0, advice);
+    Py_END_ALLOW_THREADS
+}
+#endif
+
+/* Called in adaptive mode before the buffer is refilled from the start. */
+static void
+_bufferedreader_adapt_on_fill(buffered *self)
+{
+    Py_ssize_t limit = Py_MAX(self->initial_buffer_size,
+                              ADAPTIVE_MAX_BUFFER_SIZE);
+    if (++self->sequential_fills < ADAPTIVE_SEQUENTIAL_FILLS)
+        return;
+    self->sequential_fills = 0;
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_SEQUENTIAL)
+    if (self->can_advise && !self->advised) {
+        _bufferedreader_advise(self, POSIX_FADV_SEQUENTIAL);
+        self->advised = 1;
+    }
+#endif
+    if (self->buffer_size < limit) {
+        _bufferedreader_resize_buf(self, self->buffer_size > limit / 2
+                                         ? limit : self->buffer_size * 2);
+    }
+}
+
+/* Called in adaptive mode after a seek which invalidated the buffer. */
+static void
+_bufferedreader_adapt_on_seek(buffered *self)
+{
+    Py_ssize_t floor = Py_MIN(self->initial_buffer_size,
+                              ADAPTIVE_MIN_BUFFER_SIZE);
+    self->sequential_fills = 0;
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_SEQUENTIAL)
+    if (self->advised) {
+        _bufferedreader_advise(self, POSIX_FADV_NORMAL);
+        self->advised = 0;
+    }
+#endif
+    if (self->buffer_size > floor) {
+        _bufferedreader_resize_buf(self, Py_MAX(self->buffer_size / 2, floor));
+    }
+}
+
 /*[clinic input]
 _io.BufferedReader.__init__
     raw: object
     buffer_size: Py_ssize_t(c_default="DEFAULT_BUFFER_SIZE") = DEFAULT_BUFFER_SIZE
+    *
+    adaptive: bool = False
 
 Create a new buffered reader using the given readable raw IO object.
+
+If adaptive is true, the buffer grows while the stream is read
+sequentially and shrinks when it is accessed randomly.
 [clinic start generated code]*/
 
 static int
 _io_BufferedReader___init___impl(buffered *self, PyObject *raw,
-                                 Py_ssize_t buffer_size)
-/*[clinic end generated code: output=cddcfefa0ed294c4 input=fb887e06f11b4e48]*/
+                                 Py_ssize_t buffer_size, int adaptive)
+/*[clinic end generated code: output=7e15a07fb6023fe3 input=0c9b703708d3345b]*/
 {
     self->ok = 0;
     self->detached = 0;
@@ -1595,6 +1941,9 @@ _io_BufferedReader___init___impl(buffered *self, PyObject *raw,
     if (_buffered_init(self) < 0)
         return -1;
     _bufferedreader_reset_buf(self);
+    self->adaptive = adaptive;
+    self->can_advise = adaptive && PyObject_TypeCheck(raw,
+                                                      state->PyFileIO_Type);
 
     self->fast_closed_checks = (
         Py_IS_TYPE(self, state->PyBufferedReader_Type) &&
@@ -1622,6 +1971,7 @@ _bufferedreader_raw_read(buffered *self, char *start, Py_ssize_t len)
        We then retry reading, ignoring the signal if no handler has
        raised (see issue #10956).
     */
+    self->raw_reads++;
     do {
         res = PyObject_CallMethodOneArg(self->raw, &_Py_ID(readinto), memobj);
     } while (res == NULL && _PyIO_trap_eintr());
@@ -1663,10 +2013,13 @@ _bufferedreader_fill_buffer(buffered *self)
         start = Py_SAFE_DOWNCAST(self->read_end, Py_off_t, Py_ssize_t);
     else
         start = 0;
+    if (start == 0 && self->adaptive)
+        _bufferedreader_adapt_on_fill(self);
     len = self->buffer_size - start;
     n = _bufferedreader_raw_read(self, self->buffer + start, len);
     if (n <= 0)
         return n;
+    self->bytes_copied += n;
     self->read_end = start + n;
     self->raw_pos = start + n;
     return n;
@@ -1700,6 +2053,7 @@ _bufferedreader_read_all(buffered *self)
         goto cleanup;
     }
     if (readall) {
+        self->raw_reads++;
         tmp = _PyObject_CallNoArgs(readall);
         Py_DECREF(readall);
         if (tmp == NULL)
@@ -1731,6 +2085,7 @@ _bufferedreader_read_all(buffered *self)
         }
 
         /* Read until EOF or until read() would block. */
+        self->raw_reads++;
         data = PyObject_CallMethodNoArgs(self->raw, &_Py_ID(read));
         if (data == NULL)
             goto cleanup;
@@ -2550,6 +2905,8 @@ static PyMethodDef bufferedreader_methods[] = {
     _IO__BUFFERED_READINTO_METHODDEF
     _IO__BUFFERED_READINTO1_METHODDEF
     _IO__BUFFERED_READLINE_METHODDEF
+    _IO__BUFFERED_PREAD_METHODDEF
+    _IO__BUFFERED_PREADV_METHODDEF
     _IO__BUFFERED_SEEK_METHODDEF
     _IO__BUFFERED_TELL_METHODDEF
     _IO__BUFFERED_TRUNCATE_METHODDEF
@@ -2571,6 +2928,9 @@ static PyGetSetDef bufferedreader_getset[] = {
     _IO__BUFFERED_CLOSED_GETSETDEF
     _IO__BUFFERED_NAME_GETSETDEF
     _IO__BUFFERED_MODE_GETSETDEF
+    _IO__BUFFERED_BUFFER_SIZE_GETSETDEF
+    _IO__BUFFERED_RAW_READS_GETSETDEF
+    _IO__BUFFERED_BYTES_COPIED_GETSETDEF
     {NULL}
 };
 
@@ -2608,6 +2968,8 @@ static PyMethodDef bufferedwriter_methods[] = {
     _IO__BUFFERED__DEALLOC_WARN_METHODDEF
 
     _IO_BUFFEREDWRITER_WRITE_METHODDEF
+    _IO__BUFFERED_PWRITE_METHODDEF
+    _IO__BUFFERED_PWRITEV_METHODDEF
     _IO__BUFFERED_TRUNCATE_METHODDEF
     _IO__BUFFERED_FLUSH_METHODDEF
     _IO__BUFFERED_SEEK_METHODDEF
@@ -2630,6 +2992,7 @@ static PyGetSetDef bufferedwriter_getset[] = {
     _IO__BUFFERED_CLOSED_GETSETDEF
     _IO__BUFFERED_NAME_GETSETDEF
     _IO__BUFFERED_MODE_GETSETDEF
+    _IO__BUFFERED_BUFFER_SIZE_GETSETDEF
     {NULL}
 };
 
@@ -2729,6 +3092,10 @@ static PyMethodDef bufferedrandom_methods[] = {
     _IO__BUFFERED_READLINE_METHODDEF
     _IO__BUFFERED_PEEK_METHODDEF
     _IO_BUFFEREDWRITER_WRITE_METHODDEF
+    _IO__BUFFERED_PREAD_METHODDEF
+    _IO__BUFFERED_PREADV_METHODDEF
+    _IO__BUFFERED_PWRITE_METHODDEF
+    _IO__BUFFERED_PWRITEV_METHODDEF
     _IO__BUFFERED___SIZEOF___METHODDEF
 
     {"__getstate__", _PyIOBase_cannot_pickle, METH_NOARGS},
@@ -2747,6 +3114,9 @@ static PyGetSetDef bufferedrandom_getset[] = {
     _IO__BUFFERED_CLOSED_GETSETDEF
     _IO__BUFFERED_NAME_GETSETDEF
     _IO__BUFFERED_MODE_GETSETDEF
+    _IO__BUFFERED_BUFFER_SIZE_GETSETDEF
+    _IO__BUFFERED_RAW_READS_GETSETDEF
+    _IO__BUFFERED_BYTES_COPIED_GETSETDEF
     {NULL}
 };
 
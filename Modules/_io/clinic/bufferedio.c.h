@@ -533,6 +533,81 @@ _io__Buffered_mode_get(PyObject *self, void *Py_UNUSED(context))
     return return_value;
 }
 
+#if !defined(_io__Buffered_buffer_size_DOCSTR)
+#  define _io__Buffered_buffer_size_DOCSTR NULL
+#endif
+#if defined(_IO__BUFFERED_BUFFER_SIZE_GETSETDEF)
+#  undef _IO__BUFFERED_BUFFER_SIZE_GETSETDEF
+#  define _IO__BUFFERED_BUFFER_SIZE_GETSETDEF {"buffer_size", (getter)_io__Buffered_buffer_size_get, (setter)_io__Buffered_buffer_size_set, _io__Buffered_buffer_size_DOCSTR},
+#else
+#  define _IO__BUFFERED_BUFFER_SIZE_GETSETDEF {"buffer_size", (getter)_io__Buffered_buffer_size_get, NULL, _io__Buffered_buffer_size_DOCSTR},
+#endif
+
+static PyObject *
+_io__Buffered_buffer_size_get_impl(buffered *self);
+
+static PyObject *
+_io__Buffered_buffer_size_get(PyObject *self, void *Py_UNUSED(context))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _io__Buffered_buffer_size_get_impl((buffered *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+#if !defined(_io__Buffered_raw_reads_DOCSTR)
+#  define _io__Buffered_raw_reads_DOCSTR NULL
+#endif
+#if defined(_IO__BUFFERED_RAW_READS_GETSETDEF)
+#  undef _IO__BUFFERED_RAW_READS_GETSETDEF
+#  define _IO__BUFFERED_RAW_READS_GETSETDEF {"raw_reads", (getter)_io__Buffered_raw_reads_get, (setter)_io__Buffered_raw_reads_set, _io__Buffered_raw_reads_DOCSTR},
+#else
+#  define _IO__BUFFERED_RAW_READS_GETSETDEF {"raw_reads", (getter)_io__Buffered_raw_reads_get, NULL, _io__Buffered_raw_reads_DOCSTR},
+#endif
+
+static PyObject *
+_io__Buffered_raw_reads_get_impl(buffered *self);
+
+static PyObject *
+_io__Buffered_raw_reads_get(PyObject *self, void *Py_UNUSED(context))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _io__Buffered_raw_reads_get_impl((buffered *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+#if !defined(_io__Buffered_bytes_copied_DOCSTR)
+#  define _io__Buffered_bytes_copied_DOCSTR NULL
+#endif
+#if defined(_IO__BUFFERED_BYTES_COPIED_GETSETDEF)
+#  undef _IO__BUFFERED_BYTES_COPIED_GETSETDEF
+#  define _IO__BUFFERED_BYTES_COPIED_GETSETDEF {"bytes_copied", (getter)_io__Buffered_bytes_copied_get, (setter)_io__Buffered_bytes_copied_set, _io__Buffered_bytes_copied_DOCSTR},
+#else
+#  define _IO__BUFFERED_BYTES_COPIED_GETSETDEF {"bytes_copied", (getter)_io__Buffered_bytes_copied_get, NULL, _io__Buffered_bytes_copied_DOCSTR},
+#endif
+
+static PyObject *
+_io__Buffered_bytes_copied_get_impl(buffered *self);
+
+static PyObject *
+_io__Buffered_bytes_copied_get(PyObject *self, void *Py_UNUSED(context))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _io__Buffered_bytes_copied_get_impl((buffered *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_io__Buffered_fileno__doc__,
 "fileno($self, /)\n"
 "--\n"
@@ -938,15 +1013,187 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_io__Buffered_pread__doc__,
+"pread($self, size, offset, /)\n"
+"--\n"
+"\n"
+"Read at most size bytes at offset from the raw stream.\n"
+"\n"
+"Pending writes are flushed first.  The current position is neither used\n"
+"nor changed.");
+
+#define _IO__BUFFERED_PREAD_METHODDEF    \
+    {"pread", _PyCFunction_CAST(_io__Buffered_pread), METH_FASTCALL, _io__Buffered_pread__doc__},
+
+static PyObject *
+_io__Buffered_pread_impl(buffered *self, PyObject *size, PyObject *offset);
+
+static PyObject *
+_io__Buffered_pread(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *size;
+    PyObject *offset;
+
+    if (!_PyArg_CheckPositional("pread", nargs, 2, 2)) {
+        goto exit;
+    }
+    size = args[0];
+    offset = args[1];
+    return_value = _io__Buffered_pread_impl((buffered *)self, size, offset);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_io__Buffered_preadv__doc__,
+"preadv($self, buffers, offset, /)\n"
+"--\n"
+"\n"
+"Read from the raw stream at offset into a sequence of writable buffers.\n"
+"\n"
+"Pending writes are flushed first.  The current position is neither used\n"
+"nor changed.");
+
+#define _IO__BUFFERED_PREADV_METHODDEF    \
+    {"preadv", _PyCFunction_CAST(_io__Buffered_preadv), METH_FASTCALL, _io__Buffered_preadv__doc__},
+
+static PyObject *
+_io__Buffered_preadv_impl(buffered *self, PyObject *buffers,
+                          PyObject *offset);
+
+static PyObject *
+_io__Buffered_preadv(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *buffers;
+    PyObject *offset;
+
+    if (!_PyArg_CheckPositional("preadv", nargs, 2, 2)) {
+        goto exit;
+    }
+    buffers = args[0];
+    offset = args[1];
+    return_value = _io__Buffered_preadv_impl((buffered *)self, buffers, offset);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_io__Buffered_pwrite__doc__,
+"pwrite($self, buffer, offset, /)\n"
+"--\n"
+"\n"
+"Write buffer to the raw stream at offset, return number of bytes written.\n"
+"\n"
+"Pending writes are flushed first.  The current position is not changed.");
+
+#define _IO__BUFFERED_PWRITE_METHODDEF    \
+    {"pwrite", _PyCFunction_CAST(_io__Buffered_pwrite), METH_METHOD|METH_FASTCALL|METH_KEYWORDS, _io__Buffered_pwrite__doc__},
+
+static PyObject *
+_io__Buffered_pwrite_impl(buffered *self, PyTypeObject *cls,
+                          PyObject *buffer, PyObject *offset);
+
+static PyObject *
+_io__Buffered_pwrite(PyObject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+    #  define KWTUPLE (PyObject *)&_Py_SINGLETON(tuple_empty)
+    #else
+    #  define KWTUPLE NULL
+    #endif
+
+    static const char * const _keywords[] = {"", "", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "pwrite",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    PyObject *buffer;
+    PyObject *offset;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    buffer = args[0];
+    offset = args[1];
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _io__Buffered_pwrite_impl((buffered *)self, cls, buffer, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_io__Buffered_pwritev__doc__,
+"pwritev($self, buffers, offset, /)\n"
+"--\n"
+"\n"
+"Write a sequence of buffers to the raw stream at offset.\n"
+"\n"
+"Pending writes are flushed first.  The current position is not changed.");
+
+#define _IO__BUFFERED_PWRITEV_METHODDEF    \
+    {"pwritev", _PyCFunction_CAST(_io__Buffered_pwritev), METH_METHOD|METH_FASTCALL|METH_KEYWORDS, _io__Buffered_pwritev__doc__},
+
+static PyObject *
+_io__Buffered_pwritev_impl(buffered *self, PyTypeObject *cls,
+                           PyObject *buffers, PyObject *offset);
+
+static PyObject *
+_io__Buffered_pwritev(PyObject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+    #  define KWTUPLE (PyObject *)&_Py_SINGLETON(tuple_empty)
+    #else
+    #  define KWTUPLE NULL
+    #endif
+
+    static const char * const _keywords[] = {"", "", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "pwritev",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    PyObject *buffers;
+    PyObject *offset;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    buffers = args[0];
+    offset = args[1];
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _io__Buffered_pwritev_impl((buffered *)self, cls, buffers, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(_io_BufferedReader___init____doc__,
-"BufferedReader(raw, buffer_size=DEFAULT_BUFFER_SIZE)\n"
+"BufferedReader(raw, buffer_size=DEFAULT_BUFFER_SIZE, *, adaptive=False)\n"
 "--\n"
 "\n"
-"Create a new buffered reader using the given readable raw IO object.");
+"Create a new buffered reader using the given readable raw IO object.\n"
+"\n"
+"If adaptive is true, the buffer grows while the stream is read\n"
+"sequentially and shrinks when it is accessed randomly.");
 
 static int
 _io_BufferedReader___init___impl(buffered *self, PyObject *raw,
-                                 Py_ssize_t buffer_size);
+                                 Py_ssize_t buffer_size, int adaptive);
 
 static int
 _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
@@ -954,7 +1201,7 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     int return_value = -1;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 2
+    #define NUM_KEYWORDS 3
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -963,7 +1210,7 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(raw), &_Py_ID(buffer_size), },
+        .ob_item = { &_Py_ID(raw), &_Py_ID(buffer_size), &_Py_ID(adaptive), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -972,19 +1219,20 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"raw", "buffer_size", NULL};
+    static const char * const _keywords[] = {"raw", "buffer_size", "adaptive", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "BufferedReader",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[2];
+    PyObject *argsbuf[3];
     PyObject * const *fastargs;
     Py_ssize_t nargs = PyTuple_GET_SIZE(args);
     Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 1;
     PyObject *raw;
     Py_ssize_t buffer_size = DEFAULT_BUFFER_SIZE;
+    int adaptive = 0;
 
     fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
             /*minpos*/ 1, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -995,20 +1243,33 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     if (!noptargs) {
         goto skip_optional_pos;
     }
-    {
-        Py_ssize_t ival = -1;
-        PyObject *iobj = _PyNumber_Index(fastargs[1]);
-        if (iobj != NULL) {
-            ival = PyLong_AsSsize_t(iobj);
-            Py_DECREF(iobj);
+    if (fastargs[1]) {
+        {
+            Py_ssize_t ival = -1;
+            PyObject *iobj = _PyNumber_Index(fastargs[1]);
+            if (iobj != NULL) {
+                ival = PyLong_AsSsize_t(iobj);
+                Py_DECREF(iobj);
+            }
+            if (ival == -1 && PyErr_Occurred()) {
+                goto exit;
+            }
+            buffer_size = ival;
         }
-        if (ival == -1 && PyErr_Occurred()) {
-            goto exit;
+        if (!--noptargs) {
+            goto skip_optional_pos;
         }
-        buffer_size = ival;
     }
 skip_optional_pos:
-    return_value = _io_BufferedReader___init___impl((buffered *)self, raw, buffer_size);
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    adaptive = PyObject_IsTrue(fastargs[2]);
+    if (adaptive < 0) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = _io_BufferedReader___init___impl((buffered *)self, raw, buffer_size, adaptive);
 
 exit:
     return return_value;
@@ -1265,4 +1526,4 @@ skip_optional_pos:
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=3ee17211d2010462 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=ec8e3d09198e3907 input=a9049054013a1b77]*/
@@ -402,6 +402,257 @@ exit:
     return return_value;
 }
 
+#if defined(HAVE_PREAD)
+
+PyDoc_STRVAR(_io_FileIO_pread__doc__,
+"pread($self, size, offset, /)\n"
+"--\n"
+"\n"
+"Read at most size bytes at offset, returned as bytes.\n"
+"\n"
+"The current file position is neither used nor changed, so several threads\n"
+"can read from the same file object at once.  Return an empty bytes object\n"
+"at EOF, or None in non-blocking mode if no data is available.");
+
+#define _IO_FILEIO_PREAD_METHODDEF    \
+    {"pread", _PyCFunction_CAST(_io_FileIO_pread), METH_METHOD|METH_FASTCALL|METH_KEYWORDS, _io_FileIO_pread__doc__},
+
+static PyObject *
+_io_FileIO_pread_impl(fileio *self, PyTypeObject *cls, Py_ssize_t size,
+                      long long offset);
+
+static PyObject *
+_io_FileIO_pread(PyObject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+    #  define KWTUPLE (PyObject *)&_Py_SINGLETON(tuple_empty)
+    #else
+    #  define KWTUPLE NULL
+    #endif
+
+    static const char * const _keywords[] = {"", "", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "pread",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_ssize_t size;
+    long long offset;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[0]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        size = ival;
+    }
+    offset = PyLong_AsLongLong(args[1]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _io_FileIO_pread_impl((fileio *)self, cls, size, offset);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_PREAD) */
+
+#if defined(HAVE_PWRITE)
+
+PyDoc_STRVAR(_io_FileIO_pwrite__doc__,
+"pwrite($self, b, offset, /)\n"
+"--\n"
+"\n"
+"Write buffer b to the file at offset, return number of bytes written.\n"
+"\n"
+"The current file position is neither used nor changed.  Only makes one\n"
+"system call, so not all of the data may be written.  In non-blocking mode,\n"
+"returns None if the write would block.");
+
+#define _IO_FILEIO_PWRITE_METHODDEF    \
+    {"pwrite", _PyCFunction_CAST(_io_FileIO_pwrite), METH_METHOD|METH_FASTCALL|METH_KEYWORDS, _io_FileIO_pwrite__doc__},
+
+static PyObject *
+_io_FileIO_pwrite_impl(fileio *self, PyTypeObject *cls, Py_buffer *b,
+                       long long offset);
+
+static PyObject *
+_io_FileIO_pwrite(PyObject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+    #  define KWTUPLE (PyObject *)&_Py_SINGLETON(tuple_empty)
+    #else
+    #  define KWTUPLE NULL
+    #endif
+
+    static const char * const _keywords[] = {"", "", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "pwrite",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_buffer b = {NULL, NULL};
+    long long offset;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &b, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    offset = PyLong_AsLongLong(args[1]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _io_FileIO_pwrite_impl((fileio *)self, cls, &b, offset);
+
+exit:
+    /* Cleanup for b */
+    if (b.obj) {
+       PyBuffer_Release(&b);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_PWRITE) */
+
+#if defined(HAVE_PREADV)
+
+PyDoc_STRVAR(_io_FileIO_preadv__doc__,
+"preadv($self, buffers, offset, /)\n"
+"--\n"
+"\n"
+"Read from the file at offset into a sequence of writable buffers.\n"
+"\n"
+"Each buffer is filled before moving on to the next one.  The current file\n"
+"position is neither used nor changed.  Return the total number of bytes\n"
+"read, which may be less than the total size of the buffers, or None in\n"
+"non-blocking mode if no data is available.");
+
+#define _IO_FILEIO_PREADV_METHODDEF    \
+    {"preadv", _PyCFunction_CAST(_io_FileIO_preadv), METH_METHOD|METH_FASTCALL|METH_KEYWORDS, _io_FileIO_preadv__doc__},
+
+static PyObject *
+_io_FileIO_preadv_impl(fileio *self, PyTypeObject *cls, PyObject *buffers,
+                       long long offset);
+
+static PyObject *
+_io_FileIO_preadv(PyObject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+    #  define KWTUPLE (PyObject *)&_Py_SINGLETON(tuple_empty)
+    #else
+    #  define KWTUPLE NULL
+    #endif
+
+    static const char * const _keywords[] = {"", "", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "preadv",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    PyObject *buffers;
+    long long offset;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    buffers = args[0];
+    offset = PyLong_AsLongLong(args[1]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _io_FileIO_preadv_impl((fileio *)self, cls, buffers, offset);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_PREADV) */
+
+#if defined(HAVE_PWRITEV)
+
+PyDoc_STRVAR(_io_FileIO_pwritev__doc__,
+"pwritev($self, buffers, offset, /)\n"
+"--\n"
+"\n"
+"Write the contents of a sequence of buffers to the file at offset.\n"
+"\n"
+"The current file position is neither used nor changed.  Return the total\n"
+"number of bytes written, which may be less than the total size of the\n"
+"buffers, or None in non-blocking mode if the write would block.");
+
+#define _IO_FILEIO_PWRITEV_METHODDEF    \
+    {"pwritev", _PyCFunction_CAST(_io_FileIO_pwritev), METH_METHOD|METH_FASTCALL|METH_KEYWORDS, _io_FileIO_pwritev__doc__},
+
+static PyObject *
+_io_FileIO_pwritev_impl(fileio *self, PyTypeObject *cls, PyObject *buffers,
+                        long long offset);
+
+static PyObject *
+_io_FileIO_pwritev(PyObject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+    #  define KWTUPLE (PyObject *)&_Py_SINGLETON(tuple_empty)
+    #else
+    #  define KWTUPLE NULL
+    #endif
+
+    static const char * const _keywords[] = {"", "", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "pwritev",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    PyObject *buffers;
+    long long offset;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    buffers = args[0];
+    offset = PyLong_AsLongLong(args[1]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _io_FileIO_pwritev_impl((fileio *)self, cls, buffers, offset);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_PWRITEV) */
+
 PyDoc_STRVAR(_io_FileIO_seek__doc__,
 "seek($self, pos, whence=0, /)\n"
 "--\n"
@@ -540,7 +791,23 @@ _io_FileIO_isatty(PyObject *self, PyObject *Py_UNUSED(ignored))
     return _io_FileIO_isatty_impl((fileio *)self);
 }
 
+#ifndef _IO_FILEIO_PREAD_METHODDEF
+    #define _IO_FILEIO_PREAD_METHODDEF
+#endif /* !defined(_IO_FILEIO_PREAD_METHODDEF) */
+
+#ifndef _IO_FILEIO_PWRITE_METHODDEF
+    #define _IO_FILEIO_PWRITE_METHODDEF
+#endif /* !defined(_IO_FILEIO_PWRITE_METHODDEF) */
+
+#ifndef _IO_FILEIO_PREADV_METHODDEF
+    #define _IO_FILEIO_PREADV_METHODDEF
+#endif /* !defined(_IO_FILEIO_PREADV_METHODDEF) */
+
+#ifndef _IO_FILEIO_PWRITEV_METHODDEF
+    #define _IO_FILEIO_PWRITEV_METHODDEF
+#endif /* !defined(_IO_FILEIO_PWRITEV_METHODDEF) */
+
 #ifndef _IO_FILEIO_TRUNCATE_METHODDEF
     #define _IO_FILEIO_TRUNCATE_METHODDEF
 #endif /* !defined(_IO_FILEIO_TRUNCATE_METHODDEF) */
-/*[clinic end generated code: output=1902fac9e39358aa input=a9049054013a1b77]*/
+/*[clinic end generated code: output=2d1c49a0bf622dca input=a9049054013a1b77]*/
@@ -18,6 +18,9 @@
 #ifdef HAVE_FCNTL_H
 #  include <fcntl.h>              // open()
 #endif
+#ifdef HAVE_SYS_UIO_H
+#  include <sys/uio.h>            // preadv(), pwritev()
+#endif
 
 #include "_iomodule.h"
 
@@ -952,6 +955,295 @@ _io_FileIO_write_impl(fileio *self, PyTypeObject *cls, Py_buffer *b)
     return PyLong_FromSsize_t(n);
 }
 
+#ifdef HAVE_PREAD
+/*[clinic input]
+_io.FileIO.pread
+    cls: defining_class
+    size: Py_ssize_t
+    offset: long_long
+    /
+
+Read at most size bytes at offset, returned as bytes.
+
+The current file position is neither used nor changed, so several threads
+can read from the same file object at once.  Return an empty bytes object
+at EOF, or None in non-blocking mode if no data is available.
+[clinic start generated code]*/
+
+static PyObject *
+_io_FileIO_pread_impl(fileio *self, PyTypeObject *cls, Py_ssize_t size,
+                      long long offset)
+/*[clinic end generated code: output=7c370a7b61afc122 input=de6af9ad15b7d811]*/
+{
+    PyObject *bytes;
+    Py_ssize_t n;
+    int async_err = 0;
+
+    if (self->fd < 0)
+        return err_closed();
+    if (!self->readable) {
+        _PyIO_State *state = get_io_state_by_cls(cls);
+        return err_mode(state, "reading");
+    }
+    if (size < 0) {
+        PyErr_SetString(PyExc_ValueError, "negative size");
+        return NULL;
+    }
+    if (size > _PY_READ_MAX) {
+        size = _PY_READ_MAX;
+    }
+
+    bytes = PyBytes_FromStringAndSize(NULL, size);
+    if (bytes == NULL)
+        return NULL;
+
+    do {
+        Py_BEGIN_ALLOW_THREADS
+        n = pread(self->fd, PyBytes_AS_STRING(bytes), size, (Py_off_t)offset);
+        Py_END_ALLOW_THREADS
+    } while (n < 0 && errno == EINTR && !(async_err = PyErr_CheckSignals()));
+
+    if (n < 0) {
+        int err = errno;
+        Py_DECREF(bytes);
+        if (async_err)
+            return NULL;
+        if (err == EAGAIN)
+            Py_RETURN_NONE;
+        errno = err;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+
+    if (n != size) {
+        if (_PyBytes_Resize(&bytes, n) < 0)
+            return NULL;
+    }
+    return bytes;
+}
+#endif /* HAVE_PREAD */
+
+#ifdef HAVE_PWRITE
+/*[clinic input]
+_io.FileIO.pwrite
+    cls: defining_class
+    b: Py_buffer
+    offset: long_long
+    /
+
+Write buffer b to the file at offset, return number of bytes written.
+
+The current file position is neither used nor changed.  Only makes one
+system call, so not all of the data may be written.  In non-blocking mode,
+returns None if the write would block.
+[clinic start generated code]*/
+
+static PyObject *
+_io_FileIO_pwrite_impl(fileio *self, PyTypeObject *cls, Py_buffer *b,
+                       long long offset)
+/*[clinic end generated code: output=13ea4c02fc0ae613 input=ca7b8705476d873c]*/
+{
+    Py_ssize_t n;
+    int async_err = 0;
+
+    if (self->fd < 0)
+        return err_closed();
+    if (!self->writable) {
+        _PyIO_State *state = get_io_state_by_cls(cls);
+        return err_mode(state, "writing");
+    }
+
+    do {
+        Py_BEGIN_ALLOW_THREADS
+        n = pwrite(self->fd, b->buf, Py_MIN(b->len, _PY_WRITE_MAX),
+                   (Py_off_t)offset);
+        Py_END_ALLOW_THREADS
+    } while (n < 0 && errno == EINTR && !(async_err = PyErr_CheckSignals()));
+
+    if (n < 0) {
+        if (async_err)
+            return NULL;
+        if (errno == EAGAIN)
+            Py_RETURN_NONE;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    return PyLong_FromSsize_t(n);
+}
+#endif /* HAVE_PWRITE */
+
+#if defined(HAVE_PREADV) || defined(HAVE_PWRITEV)
+/* Fill iov with the memory of the buffers in the sequence seq, which are
+   exported with the flags type into views.  Return the number of buffers,
+   or -1 on error. */
+static Py_ssize_t
+fileio_iov_setup(PyObject *seq, int type,
+                 struct iovec **iov, Py_buffer **views)
+{
+    Py_ssize_t cnt, i;
+
+    if (!PySequence_Check(seq)) {
+        PyErr_Format(PyExc_TypeError,
+                     "buffers must be a sequence, not %.200s",
+                     Py_TYPE(seq)->tp_name);
+        return -1;
+    }
+    cnt = PySequence_Size(seq);
+    if (cnt < 0)
+        return -1;
+
+    *iov = PyMem_New(struct iovec, cnt);
+    *views = PyMem_New(Py_buffer, cnt);
+    if (*iov == NULL || *views == NULL) {
+        PyMem_Free(*iov);
+        PyMem_Free(*views);
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < cnt; i++) {
+        PyObject *item = PySequence_GetItem(seq, i);
+        if (item == NULL)
+            goto error;
+        int r = PyObject_GetBuffer(item, &(*views)[i], type);
+        Py_DECREF(item);
+        if (r < 0)
+            goto error;
+        (*iov)[i].iov_base = (*views)[i].buf;
+        (*iov)[i].iov_len = (*views)[i].len;
+    }
+    return cnt;
+
+error:
+    while (--i >= 0) {
+        PyBuffer_Release(&(*views)[i]);
+    }
+    PyMem_Free(*iov);
+    PyMem_Free(*views);
+    return -1;
+}
+
+static void
+fileio_iov_cleanup(struct iovec *iov, Py_buffer *views, Py_ssize_t cnt)
+{
+    for (Py_ssize_t i = 0; i < cnt; i++) {
+        PyBuffer_Release(&views[i]);
+    }
+    PyMem_Free(iov);
+    PyMem_Free(views);
+}
+#endif
+
+#ifdef HAVE_PREADV
+/*[clinic input]
+_io.FileIO.preadv
+    cls: defining_class
+    buffers: object
+    offset: long_long
+    /
+
+Read from the file at offset into a sequence of writable buffers.
+
+Each buffer is filled before moving on to the next one.  The current file
+position is neither used nor changed.  Return the total number of bytes
+read, which may be less than the total size of the buffers, or None in
+non-blocking mode if no data is available.
+[clinic start generated code]*/
+
+static PyObject *
+_io_FileIO_preadv_impl(fileio *self, PyTypeObject *cls, PyObject *buffers,
+                       long long offset)
+/*[clinic end generated code: output=4423b362c0770dd8 input=0ab899e3a825fd33]*/
+{
+    struct iovec *iov;
+    Py_buffer *views;
+    Py_ssize_t cnt, n;
+    int async_err = 0, err;
+
+    if (self->fd < 0)
+        return err_closed();
+    if (!self->readable) {
+        _PyIO_State *state = get_io_state_by_cls(cls);
+        return err_mode(state, "reading");
+    }
+
+    cnt = fileio_iov_setup(buffers, PyBUF_WRITABLE, &iov, &views);
+    if (cnt < 0)
+        return NULL;
+    do {
+        Py_BEGIN_ALLOW_THREADS
+        n = preadv(self->fd, iov, (int)Py_MIN(cnt, INT_MAX), (Py_off_t)offset);
+        Py_END_ALLOW_THREADS
+    } while (n < 0 && errno == EINTR && !(async_err = PyErr_CheckSignals()));
+    /* copy errno because PyBuffer_Release() can indirectly modify it */
+    err = errno;
+    fileio_iov_cleanup(iov, views, cnt);
+
+    if (n < 0) {
+        if (async_err)
+            return NULL;
+        if (err == EAGAIN)
+            Py_RETURN_NONE;
+        errno = err;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    return PyLong_FromSsize_t(n);
+}
+#endif /* HAVE_PREADV */
+
+#ifdef HAVE_PWRITEV
+/*[clinic input]
+_io.FileIO.pwritev
+    cls: defining_class
+    buffers: object
+    offset: long_long
+    /
+
+Write the contents of a sequence of buffers to the file at offset.
+
+The current file position is neither used nor changed.  Return the total
+number of bytes written, which may be less than the total size of the
+buffers, or None in non-blocking mode if the write would block.
+[clinic start generated code]*/
+
+static PyObject *
+_io_FileIO_pwritev_impl(fileio *self, PyTypeObject *cls, PyObject *buffers,
+                        long long offset)
+/*[clinic end generated code: output=02e3f2b286d43219 input=aae41efdf7c2eda9]*/
+{
+    struct iovec *iov;
+    Py_buffer *views;
+    Py_ssize_t cnt, n;
+    int async_err = 0, err;
+
+    if (self->fd < 0)
+        return err_closed();
+    if (!self->writable) {
+        _PyIO_State *state = get_io_state_by_cls(cls);
+        return err_mode(state, "writing");
+    }
+
+    cnt = fileio_iov_setup(buffers, PyBUF_SIMPLE, &iov, &views);
+    if (cnt < 0)
+        return NULL;
+    do {
+        Py_BEGIN_ALLOW_THREADS
+        n = pwritev(self->fd, iov, (int)Py_MIN(cnt, INT_MAX), (Py_off_t)offset);
+        Py_END_ALLOW_THREADS
+    } while (n < 0 && errno == EINTR && !(async_err = PyErr_CheckSignals()));
+    /* copy errno because PyBuffer_Release() can indirectly modify it */
+    err = errno;
+    fileio_iov_cleanup(iov, views, cnt);
+
+    if (n < 0) {
+        if (async_err)
+            return NULL;
+        if (err == EAGAIN)
+            Py_RETURN_NONE;
+        errno = err;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    return PyLong_FromSsize_t(n);
+}
+#endif /* HAVE_PWRITEV */
+
 /* XXX Windows support below is likely incomplete */
 
 /* Cribbed from posix_lseek() */
@@ -1251,6 +1543,10 @@ static PyMethodDef fileio_methods[] = {
     _IO_FILEIO_READALL_METHODDEF
     _IO_FILEIO_READINTO_METHODDEF
     _IO_FILEIO_WRITE_METHODDEF
+    _IO_FILEIO_PREAD_METHODDEF
+    _IO_FILEIO_PWRITE_METHODDEF
+    _IO_FILEIO_PREADV_METHODDEF
+    _IO_FILEIO_PWRITEV_METHODDEF
     _IO_FILEIO_SEEK_METHODDEF
     _IO_FILEIO_TELL_METHODDEF
     _IO_FILEIO_TRUNCATE_METHODDEF
@@ -222,6 +222,8 @@ struct nldecoder_object {
     unsigned int pendingcr: 1;
     unsigned int translate: 1;
     unsigned int seennl: 3;
+    /* decoder is encodings.utf_8.IncrementalDecoder (see utf8_decode()) */
+    unsigned int utf8: 1;
 };
 
 #define nldecoder_object_CAST(op)   ((nldecoder_object *)(op))
@@ -261,6 +263,7 @@ _io_IncrementalNewlineDecoder___init___impl(nldecoder_object *self,
     self->translate = translate ? 1 : 0;
     self->seennl = 0;
     self->pendingcr = 0;
+    self->utf8 = 0;
 
     return 0;
 }
@@ -322,6 +325,94 @@ check_decoded(PyObject *decoded)
 #define SEEN_CRLF 4
 #define SEEN_ALL (SEEN_CR | SEEN_LF | SEEN_CRLF)
 
+/* Same as encodings.utf_8.IncrementalDecoder.decode(), without going
+   through the Python-level method.  The undecoded tail is still kept in the
+   decoder's "buffer" attribute, so that getstate() and setstate() keep
+   working. */
+static PyObject *
+utf8_decode(PyObject *decoder, PyObject *input, int final)
+{
+    PyObject *buffer, *errors, *data, *result = NULL;
+    const char *errors_str;
+    Py_ssize_t consumed;
+
+    buffer = PyObject_GetAttr(decoder, &_Py_ID(buffer));
+    if (buffer == NULL)
+        return NULL;
+    errors = PyObject_GetAttr(decoder, &_Py_ID(errors));
+    if (errors == NULL) {
+        Py_DECREF(buffer);
+        return NULL;
+    }
+    if (!PyBytes_Check(buffer) || !PyUnicode_Check(errors)) {
+        /* Unusual state, let the decoder handle it */
+        Py_DECREF(buffer);
+        Py_DECREF(errors);
+        return PyObject_CallMethodObjArgs(decoder, &_Py_ID(decode), input,
+                                          final ? Py_True : Py_False, NULL);
+    }
+    errors_str = PyUnicode_AsUTF8(errors);
+    if (errors_str == NULL)
+        goto end;
+
+    data = Py_NewRef(buffer);
+    PyBytes_Concat(&data, input);
+    if (data == NULL)
+        goto end;
+    consumed = PyBytes_GET_SIZE(data);
+    result = PyUnicode_DecodeUTF8Stateful(PyBytes_AS_STRING(data),
+                                          PyBytes_GET_SIZE(data), errors_str,
+                                          final ? NULL : &consumed);
+    if (result != NULL &&
+        (consumed < PyBytes_GET_SIZE(data) || PyBytes_GET_SIZE(buffer) > 0))
+    {
+        PyObject *rest = PyBytes_FromStringAndSize(
+            PyBytes_AS_STRING(data) + consumed,
+            PyBytes_GET_SIZE(data) - consumed);
+        if (rest == NULL ||
+            PyObject_SetAttr(decoder, &_Py_ID(buffer), rest) < 0)
+        {
+            Py_CLEAR(result);
+        }
+        Py_XDECREF(rest);
+    }
+    Py_DECREF(data);
+
+end:
+    Py_DECREF(buffer);
+    Py_DECREF(errors);
+    return result;
+}
+
+/* Return 1 if decoder is an instance of the built-in UTF-8 incremental
+   decoder, which utf8_decode() can bypass.  The encodings.utf_8 module is
+   not imported here: if the decoder comes from it, it is already loaded
+   (and importing may be impossible at shutdown). */
+static int
+is_utf8_decoder(PyObject *decoder)
+{
+    PyObject *name = PyUnicode_FromString("encodings.utf_8");
+    if (name == NULL)
+        return -1;
+    PyObject *mod = PyImport_GetModule(name);
+    Py_DECREF(name);
+    if (mod == NULL || mod == Py_None) {
+        /* Not loaded, or sys.modules is gone: use the generic path. */
+        PyErr_Clear();
+        Py_XDECREF(mod);
+        return 0;
+    }
+    PyObject *type;
+    int r = PyObject_GetOptionalAttrString(mod, "IncrementalDecoder",
+                                           &type);
+    Py_DECREF(mod);
+    if (r <= 0)
+        return r;
+    int res = Py_IS_TYPE(decoder, (PyTypeObject *)type);
+    Py_DECREF(type);
+    return res;
+}
+
 PyObject *
 _PyIncrementalNewlineDecoder_decode(PyObject *myself,
                                     PyObject *input, int final)
@@ -333,7 +424,10 @@ _PyIncrementalNewlineDecoder_decode(PyObject *myself,
     CHECK_INITIALIZED_DECODER(self);
 
     /* decode input (with the eventual \r from a previous pass) */
-    if (self->decoder != Py_None) {
+    if (self->utf8) {
+        output = utf8_decode(self->decoder, input, final);
+    }
+    else if (self->decoder != Py_None) {
         output = PyObject_CallMethodObjArgs(self->decoder,
             &_Py_ID(decode), input, final ? Py_True : Py_False, NULL);
     }
@@ -684,6 +778,9 @@ struct textio
     char finalizing;
     /* Specialized encoding func (see below) */
     encodefunc_t encodefunc;
+    /* True if the decoder is, or wraps, the built-in UTF-8 incremental
+       decoder, whose Python-level methods are then bypassed. */
+    char utf8_decoder;
     /* Whether or not it's the start of the stream */
     char encoding_start_of_stream;
 
@@ -905,10 +1002,27 @@ _textiowrapper_set_decoder(textio *self, PyObject *codec_info,
         return 0;
 
     Py_CLEAR(self->decoder);
+    self->utf8_decoder = 0;
     self->decoder = _PyCodecInfo_GetIncrementalDecoder(codec_info, errors);
     if (self->decoder == NULL)
         return -1;
 
+    /* Check the normalized name of the codec */
+    if (PyObject_GetOptionalAttr(codec_info, &_Py_ID(name), &res) < 0) {
+        return -1;
+    }
+    if (res != NULL && PyUnicode_Check(res) &&
+        _PyUnicode_EqualToASCIIString(res, "utf-8"))
+    {
+        r = is_utf8_decoder(self->decoder);
+        if (r < 0) {
+            Py_DECREF(res);
+            return -1;
+        }
+        self->utf8_decoder = r;
+    }
+    Py_XDECREF(res);
+
     if (self->readuniversal) {
         _PyIO_State *state = self->state;
         PyObject *incrementalDecoder = PyObject_CallFunctionObjArgs(
@@ -916,6 +1030,7 @@ _textiowrapper_set_decoder(textio *self, PyObject *codec_info,
             self->decoder, self->readtranslate ? Py_True : Py_False, NULL);
         if (incrementalDecoder == NULL)
             return -1;
+        nldecoder_object_CAST(incrementalDecoder)->utf8 = self->utf8_decoder;
         Py_XSETREF(self->decoder, incrementalDecoder);
     }
 
@@ -923,13 +1038,15 @@ _textiowrapper_set_decoder(textio *self, PyObject *codec_info,
 }
 
 static PyObject*
-_textiowrapper_decode(_PyIO_State *state, PyObject *decoder, PyObject *bytes,
-                      int eof)
+_textiowrapper_decode(textio *self, PyObject *bytes, int eof)
 {
     PyObject *chars;
+    PyObject *decoder = self->decoder;
 
-    if (Py_IS_TYPE(decoder, state->PyIncrementalNewlineDecoder_Type))
+    if (Py_IS_TYPE(decoder, self->state->PyIncrementalNewlineDecoder_Type))
         chars = _PyIncrementalNewlineDecoder_decode(decoder, bytes, eof);
+    else if (self->utf8_decoder)
+        chars = utf8_decode(decoder, bytes, eof);
     else
         chars = PyObject_CallMethodObjArgs(decoder, &_Py_ID(decode), bytes,
                                            eof ? Py_True : Py_False, NULL);
@@ -966,7 +1083,7 @@ _textiowrapper_set_encoder(textio *self, PyObject *codec_info,
     if (self->encoder == NULL)
         return -1;
 
-    /* Get the normalized named of the codec */
+    /* Check the normalized name of the codec */
     if (PyObject_GetOptionalAttr(codec_info, &_Py_ID(name), &res) < 0) {
         return -1;
     }
@@ -1154,6 +1271,7 @@ _io_TextIOWrapper___init___impl(textio *self, PyObject *buffer,
     self->decoded_chars_used = 0;
     self->pending_bytes_count = 0;
     self->encodefunc = NULL;
+    self->utf8_decoder = 0;
     self->b2cratio = 0.0;
 
     if (encoding == NULL && _PyRuntime.preconfig.utf8_mode) {
@@ -1867,7 +1985,30 @@ textiowrapper_read_chunk(textio *self, Py_ssize_t size_hint)
         return -1;
     }
 
-    if (self->telling) {
+    if (self->telling && self->utf8_decoder) {
+        /* Same as below, but read the state of the UTF-8 decoder directly
+         * (see utf8_decode()).
+         */
+        PyObject *decoder = self->decoder;
+        int pendingcr = 0;
+        if (Py_IS_TYPE(decoder, self->state->PyIncrementalNewlineDecoder_Type)) {
+            pendingcr = nldecoder_object_CAST(decoder)->pendingcr;
+            decoder = nldecoder_object_CAST(decoder)->decoder;
+        }
+        dec_buffer = PyObject_GetAttr(decoder, &_Py_ID(buffer));
+        if (dec_buffer == NULL)
+            return -1;
+        if (!PyBytes_Check(dec_buffer)) {
+            PyErr_Format(PyExc_TypeError,
+                         "illegal decoder state: the first item should be a "
+                         "bytes object, not '%.200s'",
+                         Py_TYPE(dec_buffer)->tp_name);
+            Py_DECREF(dec_buffer);
+            return -1;
+        }
+        dec_flags = PyLong_FromLong(pendingcr);
+    }
+    else if (self->telling) {
         /* To prepare for tell(), we need to snapshot a point in the file
          * where the decoder's input buffer is empty.
          */
@@ -1930,8 +2071,7 @@ textiowrapper_read_chunk(textio *self, Py_ssize_t size_hint)
     nbytes = input_chunk_buf.len;
     eof = (nbytes == 0);
 
-    decoded_chars = _textiowrapper_decode(self->state, self->decoder,
-                                          input_chunk, eof);
+    decoded_chars = _textiowrapper_decode(self, input_chunk, eof);
     PyBuffer_Release(&input_chunk_buf);
     if (decoded_chars == NULL)
         goto fail;
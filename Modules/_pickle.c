@@ -599,16 +599,14 @@ Pdata_poplist(Pdata *self, Py_ssize_t start)
     return list;
 }
 
-typedef struct {
-    PyObject *me_key;
-    Py_ssize_t me_value;
-} PyMemoEntry;
-
+/* The keys and the values of the memo table live in two parallel arrays
+   allocated as one block, so that probing only touches the keys. */
 typedef struct {
     size_t mt_mask;
     size_t mt_used;
     size_t mt_allocated;
-    PyMemoEntry *mt_table;
+    PyObject **mt_keys;         /* NULL for an empty slot */
+    Py_ssize_t *mt_values;      /* memo id of mt_keys[i] */
 } PyMemoTable;
 
 typedef struct PicklerObject {
@@ -647,6 +645,14 @@ typedef struct PicklerObject {
                                    the name of globals for Python 2.x. */
     PyObject *fast_memo;
     PyObject *buffer_callback;  /* Callback for out-of-band buffers, or NULL */
+    Py_ssize_t buffer_threshold; /* Size from which bytes, bytearray and
+                                    array objects are pickled as
+                                    PickleBuffers, or -1 */
+    int memoize_strings;        /* Whether str and bytes objects are
+                                   memoized. */
+    PyObject *reduce_cache;     /* {type: how to save its instances} for the
+                                   current dump(), or NULL. See
+                                   reduce_cache_add(). */
 } PicklerObject;
 
 typedef struct UnpicklerObject {
@@ -718,8 +724,29 @@ static int save_reduce(PickleState *, PicklerObject *, PyObject *, PyObject *);
  difference. */
 
 #define MT_MINSIZE 8
-#define PERTURB_SHIFT 5
 
+/* Allocate the keys and values arrays of a table of size slots, with all
+   keys set to NULL.  Returns -1 on failure, 0 on success. */
+static int
+_PyMemoTable_Alloc(PyMemoTable *self, size_t size)
+{
+    if (size > PY_SSIZE_T_MAX / (sizeof(PyObject *) + sizeof(Py_ssize_t))) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    PyObject **keys = PyMem_Malloc(size * (sizeof(PyObject *) +
+                                           sizeof(Py_ssize_t)));
+    if (keys == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    memset(keys, 0, size * sizeof(PyObject *));
+    self->mt_keys = keys;
+    self->mt_values = (Py_ssize_t *)(keys + size);
+    self->mt_allocated = size;
+    self->mt_mask = size - 1;
+    return 0;
+}
 
 static PyMemoTable *
 PyMemoTable_New(void)
@@ -731,15 +758,10 @@ PyMemoTable_New(void)
     }
 
     memo->mt_used = 0;
-    memo->mt_allocated = MT_MINSIZE;
-    memo->mt_mask = MT_MINSIZE - 1;
-    memo->mt_table = PyMem_Malloc(MT_MINSIZE * sizeof(PyMemoEntry));
-    if (memo->mt_table == NULL) {
+    if (_PyMemoTable_Alloc(memo, MT_MINSIZE) < 0) {
         PyMem_Free(memo);
-        PyErr_NoMemory();
         return NULL;
     }
-    memset(memo->mt_table, 0, MT_MINSIZE * sizeof(PyMemoEntry));
 
     return memo;
 }
@@ -747,27 +769,22 @@ PyMemoTable_New(void)
 static PyMemoTable *
 PyMemoTable_Copy(PyMemoTable *self)
 {
-    PyMemoTable *new = PyMemoTable_New();
-    if (new == NULL)
+    PyMemoTable *new = PyMem_Malloc(sizeof(PyMemoTable));
+    if (new == NULL) {
+        PyErr_NoMemory();
         return NULL;
+    }
 
     new->mt_used = self->mt_used;
-    new->mt_allocated = self->mt_allocated;
-    new->mt_mask = self->mt_mask;
-    /* The table we get from _New() is probably smaller than we wanted.
-       Free it and allocate one that's the right size. */
-    PyMem_Free(new->mt_table);
-    new->mt_table = PyMem_NEW(PyMemoEntry, self->mt_allocated);
-    if (new->mt_table == NULL) {
+    if (_PyMemoTable_Alloc(new, self->mt_allocated) < 0) {
         PyMem_Free(new);
-        PyErr_NoMemory();
         return NULL;
     }
     for (size_t i = 0; i < self->mt_allocated; i++) {
-        Py_XINCREF(self->mt_table[i].me_key);
+        Py_XINCREF(self->mt_keys[i]);
     }
-    memcpy(new->mt_table, self->mt_table,
-           sizeof(PyMemoEntry) * self->mt_allocated);
+    memcpy(new->mt_keys, self->mt_keys,
+           (sizeof(PyObject *) + sizeof(Py_ssize_t)) * self->mt_allocated);
 
     return new;
 }
@@ -784,10 +801,10 @@ PyMemoTable_Clear(PyMemoTable *self)
     Py_ssize_t i = self->mt_allocated;
 
     while (--i >= 0) {
-        Py_XDECREF(self->mt_table[i].me_key);
+        Py_XDECREF(self->mt_keys[i]);
     }
     self->mt_used = 0;
-    memset(self->mt_table, 0, self->mt_allocated * sizeof(PyMemoEntry));
+    memset(self->mt_keys, 0, self->mt_allocated * sizeof(PyObject *));
     return 0;
 }
 
@@ -798,44 +815,64 @@ PyMemoTable_Del(PyMemoTable *self)
         return;
     PyMemoTable_Clear(self);
 
-    PyMem_Free(self->mt_table);
+    PyMem_Free(self->mt_keys);
     PyMem_Free(self);
 }
 
+/* Objects are aligned and often allocated next to each other, so the low
+   bits of their addresses say little.  Multiply by an odd constant (Fibonacci
+   hashing) and fold the well-mixed high bits into the low ones that the mask
+   keeps. */
+static inline size_t
+_PyMemoTable_Hash(PyObject *key)
+{
+    size_t hash = (size_t)(uintptr_t)key >> 3;
+#if SIZEOF_SIZE_T > 4
+    hash *= (size_t)0x9E3779B97F4A7C15ULL;
+    hash ^= hash >> 32;
+#else
+    hash *= (size_t)0x9E3779B9UL;
+    hash ^= hash >> 16;
+#endif
+    return hash;
+}
+
 /* Since entries cannot be deleted from this hashtable, _PyMemoTable_Lookup()
-   can be considerably simpler than dictobject.c's lookdict(). */
-static PyMemoEntry *
+   can use plain linear probing.  Returns the index of the slot holding key,
+   or of the empty slot where it would be inserted. */
+static inline size_t
 _PyMemoTable_Lookup(PyMemoTable *self, PyObject *key)
 {
-    size_t i;
-    size_t perturb;
     size_t mask = self->mt_mask;
-    PyMemoEntry *table = self->mt_table;
-    PyMemoEntry *entry;
-    Py_hash_t hash = (Py_hash_t)key >> 3;
-
-    i = hash & mask;
-    entry = &table[i];
-    if (entry->me_key == NULL || entry->me_key == key)
-        return entry;
+    PyObject **keys = self->mt_keys;
+    size_t i = _PyMemoTable_Hash(key) & mask;
 
-    for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
-        i = (i << 2) + i + perturb + 1;
-        entry = &table[i & mask];
-        if (entry->me_key == NULL || entry->me_key == key)
-            return entry;
+    while (keys[i] != NULL && keys[i] != key) {
+        i = (i + 1) & mask;
     }
-    Py_UNREACHABLE();
+    return i;
+}
+
+/* Hint that the slot of key will be looked up soon. */
+static inline void
+PyMemoTable_Prefetch(PyMemoTable *self, PyObject *key)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(&self->mt_keys[_PyMemoTable_Hash(key) & self->mt_mask],
+                       0, 3);
+#else
+    (void)self;
+    (void)key;
+#endif
 }
 
 /* Returns -1 on failure, 0 on success. */
 static int
 _PyMemoTable_ResizeTable(PyMemoTable *self, size_t min_size)
 {
-    PyMemoEntry *oldtable = NULL;
-    PyMemoEntry *oldentry, *newentry;
+    PyObject **oldkeys = self->mt_keys;
+    Py_ssize_t *oldvalues = self->mt_values;
     size_t new_size = MT_MINSIZE;
-    size_t to_process;
 
     assert(min_size > 0);
 
@@ -852,33 +889,24 @@ _PyMemoTable_ResizeTable(PyMemoTable *self, size_t min_size)
     assert((new_size & (new_size - 1)) == 0);
 
     /* Allocate new table. */
-    oldtable = self->mt_table;
-    self->mt_table = PyMem_NEW(PyMemoEntry, new_size);
-    if (self->mt_table == NULL) {
-        self->mt_table = oldtable;
-        PyErr_NoMemory();
+    if (_PyMemoTable_Alloc(self, new_size) < 0) {
         return -1;
     }
-    self->mt_allocated = new_size;
-    self->mt_mask = new_size - 1;
-    memset(self->mt_table, 0, sizeof(PyMemoEntry) * new_size);
 
     /* Copy entries from the old table. */
-    to_process = self->mt_used;
-    for (oldentry = oldtable; to_process > 0; oldentry++) {
-        if (oldentry->me_key != NULL) {
+    size_t to_process = self->mt_used;
+    for (size_t j = 0; to_process > 0; j++) {
+        PyObject *key = oldkeys[j];
+        if (key != NULL) {
             to_process--;
-            /* newentry is a pointer to a chunk of the new
-               mt_table, so we're setting the key:value pair
-               in-place. */
-            newentry = _PyMemoTable_Lookup(self, oldentry->me_key);
-            newentry->me_key = oldentry->me_key;
-            newentry->me_value = oldentry->me_value;
+            size_t i = _PyMemoTable_Lookup(self, key);
+            self->mt_keys[i] = key;
+            self->mt_values[i] = oldvalues[j];
         }
     }
 
     /* Deallocate the old table. */
-    PyMem_Free(oldtable);
+    PyMem_Free(oldkeys);
     return 0;
 }
 
@@ -886,27 +914,25 @@ _PyMemoTable_ResizeTable(PyMemoTable *self, size_t min_size)
 static Py_ssize_t *
 PyMemoTable_Get(PyMemoTable *self, PyObject *key)
 {
-    PyMemoEntry *entry = _PyMemoTable_Lookup(self, key);
-    if (entry->me_key == NULL)
+    size_t i = _PyMemoTable_Lookup(self, key);
+    if (self->mt_keys[i] == NULL)
         return NULL;
-    return &entry->me_value;
+    return &self->mt_values[i];
 }
 
 /* Returns -1 on failure, 0 on success. */
 static int
 PyMemoTable_Set(PyMemoTable *self, PyObject *key, Py_ssize_t value)
 {
-    PyMemoEntry *entry;
-
     assert(key != NULL);
 
-    entry = _PyMemoTable_Lookup(self, key);
-    if (entry->me_key != NULL) {
-        entry->me_value = value;
+    size_t i = _PyMemoTable_Lookup(self, key);
+    if (self->mt_keys[i] != NULL) {
+        self->mt_values[i] = value;
         return 0;
     }
-    entry->me_key = Py_NewRef(key);
-    entry->me_value = value;
+    self->mt_keys[i] = Py_NewRef(key);
+    self->mt_values[i] = value;
     self->mt_used++;
 
     /* If we added a key, we can safely resize. Otherwise just return!
@@ -928,7 +954,6 @@ PyMemoTable_Set(PyMemoTable *self, PyObject *key, Py_ssize_t value)
 }
 
 #undef MT_MINSIZE
-#undef PERTURB_SHIFT
 
 /*************************************************************************/
 
@@ -1136,6 +1161,9 @@ _Pickler_New(PickleState *st)
     self->fix_imports = 0;
     self->fast_memo = NULL;
     self->buffer_callback = NULL;
+    self->buffer_threshold = -1;
+    self->memoize_strings = 1;
+    self->reduce_cache = NULL;
 
     PyObject_GC_Track(self);
     return self;
@@ -1207,6 +1235,33 @@ _Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback)
     return 0;
 }
 
+/* Must be called after _Pickler_SetBufferCallback(). */
+static int
+_Pickler_SetBufferThreshold(PicklerObject *self, PyObject *buffer_threshold)
+{
+    if (buffer_threshold == Py_None) {
+        self->buffer_threshold = -1;
+        return 0;
+    }
+    if (self->buffer_callback == NULL) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer_threshold needs a buffer_callback");
+        return -1;
+    }
+    Py_ssize_t threshold = PyNumber_AsSsize_t(buffer_threshold,
+                                              PyExc_OverflowError);
+    if (threshold == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (threshold < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer_threshold must be non-negative");
+        return -1;
+    }
+    self->buffer_threshold = threshold;
+    return 0;
+}
+
 /* Returns the size of the input on success, -1 on failure. This takes its
    own reference to `input`. */
 static Py_ssize_t
@@ -2437,7 +2492,10 @@ _save_bytes_data(PickleState *st, PicklerObject *self, PyObject *obj,
         return -1;
     }
 
-    if (memo_put(st, self, obj) < 0) {
+    /* obj is a PickleBuffer when called from save_picklebuffer(). */
+    if ((self->memoize_strings || !PyBytes_CheckExact(obj)) &&
+        memo_put(st, self, obj) < 0)
+    {
         return -1;
     }
 
@@ -2773,7 +2831,7 @@ save_unicode(PickleState *state, PicklerObject *self, PyObject *obj)
         if (_Pickler_Write(self, "\n", 1) < 0)
             return -1;
     }
-    if (memo_put(state, self, obj) < 0)
+    if (self->memoize_strings && memo_put(state, self, obj) < 0)
         return -1;
 
     return 0;
@@ -3077,6 +3135,10 @@ batch_list_exact(PickleState *state, PicklerObject *self, PyObject *obj)
             return -1;
         while (total < PyList_GET_SIZE(obj)) {
             item = PyList_GET_ITEM(obj, total);
+            if (total + 1 < PyList_GET_SIZE(obj)) {
+                PyMemoTable_Prefetch(self->memo,
+                                     PyList_GET_ITEM(obj, total + 1));
+            }
             Py_INCREF(item);
             int err = save(state, self, item, 0);
             Py_DECREF(item);
@@ -3358,6 +3420,7 @@ batch_dict_exact(PickleState *state, PicklerObject *self, PyObject *obj)
         if (_Pickler_Write(self, &mark_op, 1) < 0)
             return -1;
         while (PyDict_Next(obj, &ppos, &key, &value)) {
+            PyMemoTable_Prefetch(self->memo, value);
             Py_INCREF(key);
             Py_INCREF(value);
             if (save(state, self, key, 0) < 0) {
@@ -4353,6 +4416,283 @@ save_reduce(PickleState *st, PicklerObject *self, PyObject *args,
     return 0;
 }
 
+/* Record in self->reduce_cache how to save the instances of type, given the
+   value returned by the __reduce_ex__() method of one of them.
+
+   Most classes (plain classes, dataclasses, namedtuples...) inherit
+   object.__reduce_ex__(), which returns (copyreg.__newobj__, (type, *args),
+   state, None, None).  Finding that out costs several attribute lookups and
+   allocations per object, so once a type is known to reduce that way, the
+   cache maps it to Py_True (no __new__ arguments) or to its __getnewargs__
+   function, and save_cached_newobj() writes the same opcodes directly.
+   Other types map to Py_None and go through the full reduction. */
+static int
+reduce_cache_add(PicklerObject *self, PyTypeObject *type,
+                 PyObject *reduce_value)
+{
+    PyTypeObject *base = &PyBaseObject_Type;
+    PyObject *how = Py_None;
+
+    if (self->proto >= 2 &&
+        PyTuple_Check(reduce_value) &&
+        PyTuple_GET_SIZE(reduce_value) == 5 &&
+        PyTuple_GET_ITEM(reduce_value, 3) == Py_None &&
+        PyTuple_GET_ITEM(reduce_value, 4) == Py_None)
+    {
+        PyObject *callable = PyTuple_GET_ITEM(reduce_value, 0);
+        PyObject *argtup = PyTuple_GET_ITEM(reduce_value, 1);
+
+        if (PyFunction_Check(callable) &&
+            _PyUnicode_Equal(((PyFunctionObject *)callable)->func_name,
+                             &_Py_ID(__newobj__)) &&
+            PyTuple_Check(argtup) &&
+            PyTuple_GET_SIZE(argtup) >= 1 &&
+            PyTuple_GET_ITEM(argtup, 0) == (PyObject *)type &&
+            _PyType_Lookup(type, &_Py_ID(__reduce_ex__)) ==
+                _PyType_Lookup(base, &_Py_ID(__reduce_ex__)) &&
+            _PyType_Lookup(type, &_Py_ID(__reduce__)) ==
+                _PyType_Lookup(base, &_Py_ID(__reduce__)) &&
+            _PyType_Lookup(type, &_Py_ID(__class__)) ==
+                _PyType_Lookup(base, &_Py_ID(__class__)) &&
+            _PyType_Lookup(type, &_Py_ID(__getnewargs_ex__)) == NULL)
+        {
+            PyObject *getnewargs = _PyType_Lookup(type,
+                                                  &_Py_ID(__getnewargs__));
+            if (getnewargs == NULL) {
+                if (PyTuple_GET_SIZE(argtup) == 1) {
+                    how = Py_True;
+                }
+            }
+            else if (PyFunction_Check(getnewargs)) {
+                how = getnewargs;
+            }
+        }
+    }
+
+    if (self->reduce_cache == NULL) {
+        self->reduce_cache = PyDict_New();
+        if (self->reduce_cache == NULL) {
+            return -1;
+        }
+    }
+    return PyDict_SetItem(self->reduce_cache, (PyObject *)type, how);
+}
+
+/* Return 1 if obj finds the __reduce_ex__() and __reduce__() methods of its
+   type, so that the reduction recorded in self->reduce_cache for the type
+   applies to it.  Return 0 if it may find others, in its instance
+   dictionary or through a custom __getattribute__() or __getattr__(), and
+   -1 on error. */
+static int
+reduce_cache_applies(PyObject *obj)
+{
+    PyObject *names[2] = {&_Py_ID(__reduce_ex__), &_Py_ID(__reduce__)};
+
+    if (Py_TYPE(obj)->tp_getattro != PyObject_GenericGetAttr) {
+        return 0;
+    }
+    for (int i = 0; i < 2; i++) {
+        PyObject *method = NULL;
+        int found = _PyObject_GetMethod(obj, names[i], &method);
+        if (method == NULL) {
+            return PyErr_Occurred() ? -1 : 0;
+        }
+        Py_DECREF(method);
+        if (!found) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Save obj as reduce_newobj() in Objects/typeobject.c would reduce it, once
+   reduce_cache_add() has checked that its type uses that reduction.  how is
+   the value found in the cache.  This writes the same opcodes as save_reduce()
+   given the full reduction. */
+static int
+save_cached_newobj(PickleState *st, PicklerObject *self, PyObject *obj,
+                   PyObject *how)
+{
+    PyObject *cls = (PyObject *)Py_TYPE(obj);
+    PyObject *newargs;
+    PyObject *state = NULL;
+    int status = -1;
+
+    const char newobj_op = NEWOBJ;
+    const char build_op = BUILD;
+
+    if (how == Py_True) {
+        newargs = PyTuple_New(0);
+    }
+    else {
+        newargs = PyObject_CallOneArg(how, obj);
+        if (newargs != NULL && !PyTuple_Check(newargs)) {
+            PyErr_Format(PyExc_TypeError,
+                         "__getnewargs__ should return a tuple, "
+                         "not '%.200s'", Py_TYPE(newargs)->tp_name);
+            Py_CLEAR(newargs);
+        }
+    }
+    if (newargs == NULL) {
+        return -1;
+    }
+    /* Like reduce_newobj(), require the default __getstate__() to save the
+       whole object unless __getnewargs__() passes part of it. */
+    int required = (how == Py_True &&
+                    !PyList_Check(obj) && !PyDict_Check(obj));
+    state = _PyObject_GetStateEx(obj, required);
+    if (state == NULL) {
+        goto error;
+    }
+
+    if (save(st, self, cls, 0) < 0) {
+        _PyErr_FormatNote("when serializing %T class", obj);
+        goto error;
+    }
+    if (save(st, self, newargs, 0) < 0) {
+        _PyErr_FormatNote("when serializing %T __new__ arguments", obj);
+        goto error;
+    }
+    if (_Pickler_Write(self, &newobj_op, 1) < 0) {
+        goto error;
+    }
+
+    /* See save_reduce() for the recursive case. */
+    if (PyMemoTable_Get(self->memo, obj)) {
+        const char pop_op = POP;
+
+        if (_Pickler_Write(self, &pop_op, 1) < 0 ||
+            memo_get(st, self, obj) < 0)
+        {
+            goto error;
+        }
+        status = 0;
+        goto error;
+    }
+    if (memo_put(st, self, obj) < 0) {
+        goto error;
+    }
+
+    if (state != Py_None) {
+        if (save(st, self, state, 0) < 0) {
+            _PyErr_FormatNote("when serializing %T state", obj);
+            goto error;
+        }
+        if (_Pickler_Write(self, &build_op, 1) < 0) {
+            goto error;
+        }
+    }
+    status = 0;
+
+  error:
+    Py_DECREF(newargs);
+    Py_XDECREF(state);
+    return status;
+}
+
+/* Pickle a bytes, bytearray or array.array object of at least
+   self->buffer_threshold bytes as its constructor called with a PickleBuffer,
+   so that save_picklebuffer() may write its data out-of-band.
+
+   Returns 1 if obj was saved, 0 if it is not eligible and -1 on error. */
+static int
+save_large_buffer(PickleState *st, PicklerObject *self, PyObject *obj)
+{
+    PyTypeObject *type = Py_TYPE(obj);
+    PyObject *pickle_buffer;
+    PyObject *reduce_value;
+    int status;
+
+    assert(self->buffer_threshold >= 0);
+    if (type == &PyBytes_Type || type == &PyByteArray_Type) {
+        Py_ssize_t size = PyBytes_Check(obj) ? PyBytes_GET_SIZE(obj)
+                                             : PyByteArray_GET_SIZE(obj);
+        if (size < self->buffer_threshold) {
+            return 0;
+        }
+        pickle_buffer = PyPickleBuffer_FromObject(obj);
+        if (pickle_buffer == NULL) {
+            return -1;
+        }
+        reduce_value = Py_BuildValue("(O(N))", (PyObject *)type,
+                                     pickle_buffer);
+    }
+    else {
+        /* Only look the array type up for objects exporting a buffer. */
+        if (type->tp_as_buffer == NULL) {
+            return 0;
+        }
+        PyObject *array_type = PyImport_ImportModuleAttrString("array",
+                                                               "array");
+        if (array_type == NULL) {
+            return -1;
+        }
+        int is_array = ((PyObject *)type == array_type);
+        Py_DECREF(array_type);
+        if (!is_array) {
+            return 0;
+        }
+
+        pickle_buffer = PyPickleBuffer_FromObject(obj);
+        if (pickle_buffer == NULL) {
+            return -1;
+        }
+        const Py_buffer *view = PyPickleBuffer_GetBuffer(pickle_buffer);
+        if (view == NULL) {
+            Py_DECREF(pickle_buffer);
+            return -1;
+        }
+        if (view->len < self->buffer_threshold) {
+            Py_DECREF(pickle_buffer);
+            return 0;
+        }
+
+        /* Reducing an empty array gives the reconstructor and the machine
+           format code without copying the data. */
+        PyObject *empty_reduce = NULL;
+        PyObject *typecode = PyObject_GetAttrString(obj, "typecode");
+        if (typecode != NULL) {
+            PyObject *empty = PyObject_CallOneArg((PyObject *)type, typecode);
+            Py_DECREF(typecode);
+            if (empty != NULL) {
+                empty_reduce = PyObject_CallMethod(empty, "__reduce_ex__",
+                                                   "i", 3);
+                Py_DECREF(empty);
+            }
+        }
+        if (empty_reduce == NULL) {
+            Py_DECREF(pickle_buffer);
+            return -1;
+        }
+        PyObject *args;
+        if (!PyTuple_Check(empty_reduce) ||
+            PyTuple_GET_SIZE(empty_reduce) < 2 ||
+            !PyTuple_Check(args = PyTuple_GET_ITEM(empty_reduce, 1)) ||
+            PyTuple_GET_SIZE(args) != 4)
+        {
+            /* Unknown machine format, the array is pickled as a list. */
+            Py_DECREF(empty_reduce);
+            Py_DECREF(pickle_buffer);
+            return 0;
+        }
+        reduce_value = Py_BuildValue("(O(OOON))",
+                                     PyTuple_GET_ITEM(empty_reduce, 0),
+                                     PyTuple_GET_ITEM(args, 0),
+                                     PyTuple_GET_ITEM(args, 1),
+                                     PyTuple_GET_ITEM(args, 2),
+                                     pickle_buffer);
+        Py_DECREF(empty_reduce);
+    }
+    if (reduce_value == NULL) {
+        return -1;
+    }
+
+    /* save_reduce() will memoize the object automatically. */
+    status = save_reduce(st, self, reduce_value, obj);
+    Py_DECREF(reduce_value);
+    return status < 0 ? -1 : 1;
+}
+
 static int
 save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
 {
@@ -4360,6 +4700,7 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
     PyObject *reduce_func = NULL;
     PyObject *reduce_value = NULL;
     int status = 0;
+    int cacheable = 0;
 
     if (_Pickler_OpcodeBoundary(self) < 0)
         return -1;
@@ -4406,6 +4747,12 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
     }
 
     if (type == &PyBytes_Type) {
+        if (self->buffer_threshold >= 0) {
+            status = save_large_buffer(st, self, obj);
+            if (status != 0) {
+                return status < 0 ? -1 : 0;
+            }
+        }
         return save_bytes(st, self, obj);
     }
     else if (type == &PyUnicode_Type) {
@@ -4439,6 +4786,13 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
         goto done;
     }
     else if (type == &PyByteArray_Type) {
+        if (self->buffer_threshold >= 0) {
+            status = save_large_buffer(st, self, obj);
+            if (status != 0) {
+                status = status < 0 ? -1 : 0;
+                goto done;
+            }
+        }
         status = save_bytearray(st, self, obj);
         goto done;
     }
@@ -4471,6 +4825,34 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
         goto done;
     }
 
+    /* Skip the reduction of objects whose type reduces the default way,
+       as found from a previous instance.  Objects which may find another
+       __reduce_ex__() or __reduce__() are neither looked up nor cached. */
+    cacheable = reduce_cache_applies(obj);
+    if (cacheable < 0) {
+        goto error;
+    }
+    if (cacheable && self->reduce_cache != NULL) {
+        PyObject *how;
+        if (PyDict_GetItemRef(self->reduce_cache, (PyObject *)type,
+                              &how) < 0)
+        {
+            goto error;
+        }
+        if (how == Py_None) {
+            cacheable = 0;
+            Py_DECREF(how);
+        }
+        else if (how != NULL) {
+            status = save_cached_newobj(st, self, obj, how);
+            Py_DECREF(how);
+            if (status < 0) {
+                _PyErr_FormatNote("when serializing %T object", obj);
+            }
+            goto done;
+        }
+    }
+
     /* XXX: This part needs some unit tests. */
 
     /* Get a reduction callable, and call it.  This may come from
@@ -4498,6 +4880,7 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
     }
 
     if (reduce_func != NULL) {
+        cacheable = 0;
         reduce_value = _Pickle_FastCall(reduce_func, Py_NewRef(obj));
     }
     else if (PyType_IsSubtype(type, &PyType_Type)) {
@@ -4505,6 +4888,16 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
         goto done;
     }
     else {
+        /* A large array is only written out-of-band if no reducer was
+           registered for it. */
+        if (self->buffer_threshold >= 0) {
+            status = save_large_buffer(st, self, obj);
+            if (status != 0) {
+                status = status < 0 ? -1 : 0;
+                goto done;
+            }
+        }
+
         /* XXX: If the __reduce__ method is defined, __reduce_ex__ is
            automatically defined as __reduce__. While this is convenient, this
            make it impossible to know which method was actually called. Of
@@ -4525,6 +4918,7 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
             }
         }
         else {
+            cacheable = 0;
             /* Check for a __reduce__ method. */
             if (PyObject_GetOptionalAttr(obj, &_Py_ID(__reduce__), &reduce_func) < 0) {
                 goto error;
@@ -4556,6 +4950,10 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
         goto error;
     }
 
+    if (cacheable && reduce_cache_add(self, type, reduce_value) < 0) {
+        goto error;
+    }
+
     status = save_reduce(st, self, reduce_value, obj);
     if (status < 0) {
         _PyErr_FormatNote("when serializing %T object", obj);
@@ -4638,6 +5036,8 @@ dump(PickleState *state, PicklerObject *self, PyObject *obj)
      * be garbage-collected as long as the Pickler itself is not collected. */
     Py_CLEAR(self->persistent_id);
     Py_CLEAR(self->reducer_override);
+    /* Classes may change between two dumps. */
+    Py_CLEAR(self->reduce_cache);
     return status;
 }
 
@@ -4716,7 +5116,8 @@ _pickle_Pickler___sizeof___impl(PicklerObject *self)
     size_t res = _PyObject_SIZE(Py_TYPE(self));
     if (self->memo != NULL) {
         res += sizeof(PyMemoTable);
-        res += self->memo->mt_allocated * sizeof(PyMemoEntry);
+        res += self->memo->mt_allocated * (sizeof(PyObject *) +
+                                           sizeof(Py_ssize_t));
     }
     if (self->output_buffer != NULL) {
         size_t s = _PySys_GetSizeOf(self->output_buffer);
@@ -4749,6 +5150,7 @@ Pickler_clear(PyObject *op)
     Py_CLEAR(self->fast_memo);
     Py_CLEAR(self->reducer_override);
     Py_CLEAR(self->buffer_callback);
+    Py_CLEAR(self->reduce_cache);
 
     if (self->memo != NULL) {
         PyMemoTable *memo = self->memo;
@@ -4780,11 +5182,12 @@ Pickler_traverse(PyObject *op, visitproc visit, void *arg)
     Py_VISIT(self->fast_memo);
     Py_VISIT(self->reducer_override);
     Py_VISIT(self->buffer_callback);
+    Py_VISIT(self->reduce_cache);
     PyMemoTable *memo = self->memo;
-    if (memo && memo->mt_table) {
+    if (memo && memo->mt_keys) {
         Py_ssize_t i = memo->mt_allocated;
         while (--i >= 0) {
-            Py_VISIT(memo->mt_table[i].me_key);
+            Py_VISIT(memo->mt_keys[i]);
         }
     }
 
@@ -4800,6 +5203,8 @@ _pickle.Pickler.__init__
   protocol: object = None
   fix_imports: bool = True
   buffer_callback: object = None
+  buffer_threshold: object = None
+  memoize_strings: bool = True
 
 This takes a binary file for writing a pickle data stream.
 
@@ -4832,13 +5237,24 @@ buffer is serialized in-band, i.e. inside the pickle stream.
 It is an error if *buffer_callback* is not None and *protocol*
 is None or smaller than 5.
 
+If *buffer_threshold* is not None, bytes, bytearray and array.array
+objects whose size in bytes is at least *buffer_threshold* are pickled
+as if they were wrapped in a PickleBuffer, so that *buffer_callback*
+can send them out-of-band.  It requires a *buffer_callback*.
+
+If *memoize_strings* is false, str and bytes objects are not memoized:
+each reference to the same string is pickled again.  This makes
+pickling faster when most strings are unique.
+
 [clinic start generated code]*/
 
 static int
 _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
                               PyObject *protocol, int fix_imports,
-                              PyObject *buffer_callback)
-/*[clinic end generated code: output=0abedc50590d259b input=cddc50f66b770002]*/
+                              PyObject *buffer_callback,
+                              PyObject *buffer_threshold,
+                              int memoize_strings)
+/*[clinic end generated code: output=979020caa0aaceae input=0fb7fba08724548b]*/
 {
     /* In case of multiple __init__() calls, clear previous content. */
     if (self->write != NULL)
@@ -4853,6 +5269,11 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
     if (_Pickler_SetBufferCallback(self, buffer_callback) < 0)
         return -1;
 
+    if (_Pickler_SetBufferThreshold(self, buffer_threshold) < 0)
+        return -1;
+
+    self->memoize_strings = memoize_strings;
+
     /* memo and output_buffer may have already been created in _Pickler_New */
     if (self->memo == NULL) {
         self->memo = PyMemoTable_New();
@@ -4926,16 +5347,16 @@ _pickle_PicklerMemoProxy_copy_impl(PicklerMemoProxyObject *self)
 
     memo = self->pickler->memo;
     for (size_t i = 0; i < memo->mt_allocated; ++i) {
-        PyMemoEntry entry = memo->mt_table[i];
-        if (entry.me_key != NULL) {
+        PyObject *me_key = memo->mt_keys[i];
+        if (me_key != NULL) {
             int status;
             PyObject *key, *value;
 
-            key = PyLong_FromVoidPtr(entry.me_key);
+            key = PyLong_FromVoidPtr(me_key);
             if (key == NULL) {
                 goto error;
             }
-            value = Py_BuildValue("nO", entry.me_value, entry.me_key);
+            value = Py_BuildValue("nO", memo->mt_values[i], me_key);
             if (value == NULL) {
                 Py_DECREF(key);
                 goto error;
@@ -7702,6 +8123,8 @@ _pickle.dump
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  buffer_threshold: object = None
+  memoize_strings: bool = True
 
 Write a pickled representation of obj to the open file object file.
 
@@ -7730,13 +8153,18 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+If *buffer_threshold* is not None, large bytes, bytearray and
+array.array objects are passed to *buffer_callback* as buffer views.
+If *memoize_strings* is false, str and bytes objects are not memoized.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
                   PyObject *protocol, int fix_imports,
-                  PyObject *buffer_callback)
-/*[clinic end generated code: output=706186dba996490c input=b89ce8d0e911fd46]*/
+                  PyObject *buffer_callback, PyObject *buffer_threshold,
+                  int memoize_strings)
+/*[clinic end generated code: output=eb3b40ff1121d039 input=5328b20b8a218f2d]*/
 {
     PickleState *state = _Pickle_GetState(module);
     PicklerObject *pickler = _Pickler_New(state);
@@ -7753,6 +8181,11 @@ _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
     if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
         goto error;
 
+    if (_Pickler_SetBufferThreshold(pickler, buffer_threshold) < 0)
+        goto error;
+
+    pickler->memoize_strings = memoize_strings;
+
     if (dump(state, pickler, obj) < 0)
         goto error;
 
@@ -7776,6 +8209,8 @@ _pickle.dumps
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  buffer_threshold: object = None
+  memoize_strings: bool = True
 
 Return the pickled representation of the object as a bytes object.
 
@@ -7796,12 +8231,17 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+If *buffer_threshold* is not None, large bytes, bytearray and
+array.array objects are passed to *buffer_callback* as buffer views.
+If *memoize_strings* is false, str and bytes objects are not memoized.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
-                   int fix_imports, PyObject *buffer_callback)
-/*[clinic end generated code: output=fbab0093a5580fdf input=139fc546886c63ac]*/
+                   int fix_imports, PyObject *buffer_callback,
+                   PyObject *buffer_threshold, int memoize_strings)
+/*[clinic end generated code: output=8ef40de8adcf33cf input=dbafbbea71852e82]*/
 {
     PyObject *result;
     PickleState *state = _Pickle_GetState(module);
@@ -7816,6 +8256,11 @@ _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
     if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
         goto error;
 
+    if (_Pickler_SetBufferThreshold(pickler, buffer_threshold) < 0)
+        goto error;
+
+    pickler->memoize_strings = memoize_strings;
+
     if (dump(state, pickler, obj) < 0)
         goto error;
 
@@ -647,6 +647,128 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_sre_SRE_Pattern_findspans_into__doc__,
+"findspans_into($self, /, buffer, string, pos=0, endpos=sys.maxsize, *,\n"
+"               groups=False)\n"
+"--\n"
+"\n"
+"Write the spans of all non-overlapping matches for the RE pattern in string into buffer.\n"
+"\n"
+"buffer must be a writable buffer of signed 32- or 64-bit integers, such as\n"
+"an array.array(\'q\').  For each match, its start and end are written, and if\n"
+"groups is true, the start and end of each group follow (-1 for groups which\n"
+"did not participate in the match).\n"
+"\n"
+"Return a tuple (count, next): count is the number of matches written, and\n"
+"next is the position to pass as pos to continue the search if buffer was\n"
+"too small to hold all of them, or None.");
+
+#define _SRE_SRE_PATTERN_FINDSPANS_INTO_METHODDEF    \
+    {"findspans_into", _PyCFunction_CAST(_sre_SRE_Pattern_findspans_into), METH_FASTCALL|METH_KEYWORDS, _sre_SRE_Pattern_findspans_into__doc__},
+
+static PyObject *
+_sre_SRE_Pattern_findspans_into_impl(PatternObject *self, PyObject *buffer,
+                                     PyObject *string, Py_ssize_t pos,
+                                     Py_ssize_t endpos, int groups);
+
+static PyObject *
+_sre_SRE_Pattern_findspans_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 5
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(buffer), &_Py_ID(string), &_Py_ID(pos), &_Py_ID(endpos), &_Py_ID(groups), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"buffer", "string", "pos", "endpos", "groups", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "findspans_into",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[5];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
+    PyObject *buffer;
+    PyObject *string;
+    Py_ssize_t pos = 0;
+    Py_ssize_t endpos = PY_SSIZE_T_MAX;
+    int groups = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 4, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    buffer = args[0];
+    string = args[1];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[2]) {
+        {
+            Py_ssize_t ival = -1;
+            PyObject *iobj = _PyNumber_Index(args[2]);
+            if (iobj != NULL) {
+                ival = PyLong_AsSsize_t(iobj);
+                Py_DECREF(iobj);
+            }
+            if (ival == -1 && PyErr_Occurred()) {
+                goto exit;
+            }
+            pos = ival;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    if (args[3]) {
+        {
+            Py_ssize_t ival = -1;
+            PyObject *iobj = _PyNumber_Index(args[3]);
+            if (iobj != NULL) {
+                ival = PyLong_AsSsize_t(iobj);
+                Py_DECREF(iobj);
+            }
+            if (ival == -1 && PyErr_Occurred()) {
+                goto exit;
+            }
+            endpos = ival;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+skip_optional_pos:
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    groups = PyObject_IsTrue(args[4]);
+    if (groups < 0) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = _sre_SRE_Pattern_findspans_into_impl((PatternObject *)self, buffer, string, pos, endpos, groups);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(_sre_SRE_Pattern_scanner__doc__,
 "scanner($self, /, string, pos=0, endpos=sys.maxsize)\n"
 "--\n"
@@ -1565,7 +1687,137 @@ _sre_SRE_Scanner_search(PyObject *self, PyTypeObject *cls, PyObject *const *args
     return _sre_SRE_Scanner_search_impl((ScannerObject *)self, cls);
 }
 
+PyDoc_STRVAR(_sre_compile_set__doc__,
+"compile_set($module, patterns, /)\n"
+"--\n"
+"\n"
+"\n"
+"\n"
+"  patterns\n"
+"    A tuple of compiled patterns.");
+
+#define _SRE_COMPILE_SET_METHODDEF    \
+    {"compile_set", (PyCFunction)_sre_compile_set, METH_O, _sre_compile_set__doc__},
+
+static PyObject *
+_sre_compile_set_impl(PyObject *module, PyObject *patterns);
+
+static PyObject *
+_sre_compile_set(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyObject *patterns;
+
+    if (!PyTuple_Check(arg)) {
+        _PyArg_BadArgument("compile_set", "argument", "tuple", arg);
+        goto exit;
+    }
+    patterns = arg;
+    return_value = _sre_compile_set_impl(module, patterns);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_sre_SRE_PatternSet_matches__doc__,
+"matches($self, /, string, pos=0, endpos=sys.maxsize)\n"
+"--\n"
+"\n"
+"Return a list of the indices of the patterns which match somewhere in string.\n"
+"\n"
+"The string is scanned once for the literals required by the patterns, and\n"
+"only the patterns whose literal occurs in it are searched for.");
+
+#define _SRE_SRE_PATTERNSET_MATCHES_METHODDEF    \
+    {"matches", _PyCFunction_CAST(_sre_SRE_PatternSet_matches), METH_FASTCALL|METH_KEYWORDS, _sre_SRE_PatternSet_matches__doc__},
+
+static PyObject *
+_sre_SRE_PatternSet_matches_impl(PatternSetObject *self, PyObject *string,
+                                 Py_ssize_t pos, Py_ssize_t endpos);
+
+static PyObject *
+_sre_SRE_PatternSet_matches(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 3
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(string), &_Py_ID(pos), &_Py_ID(endpos), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"string", "pos", "endpos", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "matches",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[3];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    PyObject *string;
+    Py_ssize_t pos = 0;
+    Py_ssize_t endpos = PY_SSIZE_T_MAX;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 1, /*maxpos*/ 3, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    string = args[0];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[1]) {
+        {
+            Py_ssize_t ival = -1;
+            PyObject *iobj = _PyNumber_Index(args[1]);
+            if (iobj != NULL) {
+                ival = PyLong_AsSsize_t(iobj);
+                Py_DECREF(iobj);
+            }
+            if (ival == -1 && PyErr_Occurred()) {
+                goto exit;
+            }
+            pos = ival;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[2]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        endpos = ival;
+    }
+skip_optional_pos:
+    return_value = _sre_SRE_PatternSet_matches_impl((PatternSetObject *)self, string, pos, endpos);
+
+exit:
+    return return_value;
+}
+
 #ifndef _SRE_SRE_PATTERN__FAIL_AFTER_METHODDEF
     #define _SRE_SRE_PATTERN__FAIL_AFTER_METHODDEF
 #endif /* !defined(_SRE_SRE_PATTERN__FAIL_AFTER_METHODDEF) */
-/*[clinic end generated code: output=bbf42e1de3bdd3ae input=a9049054013a1b77]*/
+/*[clinic end generated code: output=902ab0ebca2bbc0d input=a9049054013a1b77]*/
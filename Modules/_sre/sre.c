@@ -39,6 +39,7 @@ static const char copyright[] =
     " SRE 2.2.2 Copyright (c) 1997-2002 by Secret Labs AB ";
 
 #include "Python.h"
+#include "pycore_bytesobject.h"     // _PyBytes_Find()
 #include "pycore_critical_section.h" // Py_BEGIN_CRITICAL_SECTION
 #include "pycore_dict.h"             // _PyDict_Next()
 #include "pycore_long.h"             // _PyLong_GetZero()
@@ -107,6 +108,9 @@ static unsigned int sre_toupper(unsigned int ch) {
 #define SRE_ERROR_MEMORY -9 /* out of memory */
 #define SRE_ERROR_INTERRUPTED -10 /* signal handler raised exception */
 
+/* the longest prefix of a required literal searched for by sre_search */
+#define SRE_REQUIRED_MAXLEN 64
+
 #if VERBOSE == 0
 #  define INIT_TRACE(state)
 #  define DO_TRACE 0
@@ -347,6 +351,32 @@ repeat_pool_clear(SRE_STATE *state)
     }
 }
 
+/* the goto function of the automaton of a pattern set: return the child
+   of a trie node for a character, or -1 */
+static inline size_t
+sre_set_hash(Py_ssize_t node, SRE_CODE ch)
+{
+    size_t h = (size_t)node * 1000003 ^ ch;
+    h ^= h >> 15;
+    h *= 0x2c1b3c6d;
+    return h ^ (h >> 12);
+}
+
+LOCAL(Py_ssize_t)
+sre_set_goto(const PatternSetObject* set, Py_ssize_t node, SRE_CODE ch)
+{
+    size_t i;
+    if (node == 0 && ch < 256)
+        return set->root[ch] ? set->root[ch] : -1;
+    for (i = sre_set_hash(node, ch) & set->mask; ; i = (i + 1) & set->mask) {
+        const SRE_SET_EDGE* edge = &set->edges[i];
+        if (edge->child == 0)
+            return -1;
+        if (edge->node == node && edge->ch == ch)
+            return edge->child;
+    }
+}
+
 /* generate 8-bit version */
 
 #define SRE_CHAR Py_UCS1
@@ -377,6 +407,7 @@ typedef struct {
     PyTypeObject *Match_Type;
     PyTypeObject *Scanner_Type;
     PyTypeObject *Template_Type;
+    PyTypeObject *PatternSet_Type;
     PyObject *compile_template;  // reference to re._compile_template
 } _sremodulestate;
 
@@ -406,8 +437,9 @@ module _sre
 class _sre.SRE_Pattern "PatternObject *" "get_sre_module_state_by_class(tp)->Pattern_Type"
 class _sre.SRE_Match "MatchObject *" "get_sre_module_state_by_class(tp)->Match_Type"
 class _sre.SRE_Scanner "ScannerObject *" "get_sre_module_state_by_class(tp)->Scanner_Type"
+class _sre.SRE_PatternSet "PatternSetObject *" "get_sre_module_state_by_class(tp)->PatternSet_Type"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=fe2966e32b66a231]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=ff29c551bc38b8c9]*/
 
 /*[clinic input]
 _sre.getcodesize -> int
@@ -595,6 +627,7 @@ state_init(SRE_STATE* state, PatternObject* pattern, PyObject* string,
     state->string = Py_NewRef(string);
     state->pos = start;
     state->endpos = end;
+    state->linear = pattern->linear;
 
 #ifdef Py_DEBUG
     state->fail_after_count = pattern->fail_after_count;
@@ -741,6 +774,7 @@ pattern_dealloc(PyObject *self)
         PyObject_ClearWeakRefs(self);
     }
     (void)pattern_clear(self);
+    PyMem_Free(obj->linear);
     tp->tp_free(self);
     Py_DECREF(tp);
 }
@@ -748,6 +782,14 @@ pattern_dealloc(PyObject *self)
 LOCAL(Py_ssize_t)
 sre_match(SRE_STATE* state, SRE_CODE* pattern)
 {
+    if (state->linear) {
+        if (state->charsize == 1)
+            return sre_ucs1_linear(state, pattern, 0);
+        if (state->charsize == 2)
+            return sre_ucs2_linear(state, pattern, 0);
+        assert(state->charsize == 4);
+        return sre_ucs4_linear(state, pattern, 0);
+    }
     if (state->charsize == 1)
         return sre_ucs1_match(state, pattern, 1);
     if (state->charsize == 2)
@@ -759,6 +801,14 @@ sre_match(SRE_STATE* state, SRE_CODE* pattern)
 LOCAL(Py_ssize_t)
 sre_search(SRE_STATE* state, SRE_CODE* pattern)
 {
+    if (state->linear) {
+        if (state->charsize == 1)
+            return sre_ucs1_linear(state, pattern, 1);
+        if (state->charsize == 2)
+            return sre_ucs2_linear(state, pattern, 1);
+        assert(state->charsize == 4);
+        return sre_ucs4_linear(state, pattern, 1);
+    }
     if (state->charsize == 1)
         return sre_ucs1_search(state, pattern);
     if (state->charsize == 2)
@@ -1038,6 +1088,159 @@ _sre_SRE_Pattern_finditer_impl(PatternObject *self, PyTypeObject *cls,
     return iterator;
 }
 
+/* write a match position into a buffer of 4- or 8-byte signed integers */
+static int
+write_span_item(Py_buffer *view, Py_ssize_t index, Py_ssize_t value)
+{
+    if (view->itemsize == 8) {
+        ((int64_t *)view->buf)[index] = value;
+    }
+    else if (value > INT32_MAX) {
+        PyErr_SetString(PyExc_OverflowError,
+                        "match position does not fit in the buffer items");
+        return -1;
+    }
+    else {
+        ((int32_t *)view->buf)[index] = (int32_t)value;
+    }
+    return 0;
+}
+
+/*[clinic input]
+_sre.SRE_Pattern.findspans_into
+
+    buffer: object
+    string: object
+    pos: Py_ssize_t = 0
+    endpos: Py_ssize_t(c_default="PY_SSIZE_T_MAX") = sys.maxsize
+    *
+    groups: bool = False
+
+Write the spans of all non-overlapping matches for the RE pattern in string into buffer.
+
+buffer must be a writable buffer of signed 32- or 64-bit integers, such as
+an array.array('q').  For each match, its start and end are written, and if
+groups is true, the start and end of each group follow (-1 for groups which
+did not participate in the match).
+
+Return a tuple (count, next): count is the number of matches written, and
+next is the position to pass as pos to continue the search if buffer was
+too small to hold all of them, or None.
+[clinic start generated code]*/
+
+static PyObject *
+_sre_SRE_Pattern_findspans_into_impl(PatternObject *self, PyObject *buffer,
+                                     PyObject *string, Py_ssize_t pos,
+                                     Py_ssize_t endpos, int groups)
+/*[clinic end generated code: output=f7ced468eeb2882e input=646830b24f5a0daa]*/
+{
+    SRE_STATE state;
+    Py_buffer view;
+    Py_ssize_t status, size, capacity, count = 0, i;
+    Py_ssize_t last_start = -1, last_end = -1;
+    PyObject* next = NULL;
+    const char* format;
+
+    if (PyObject_GetBuffer(buffer, &view, PyBUF_WRITABLE | PyBUF_FORMAT |
+                                          PyBUF_C_CONTIGUOUS) < 0)
+        return NULL;
+    format = view.format;
+    if (format[0] == '@')
+        format++;
+    if ((view.itemsize != 4 && view.itemsize != 8) ||
+        format[0] == '\0' || format[1] != '\0' ||
+        !strchr("ilqn", format[0]))
+    {
+        PyErr_Format(PyExc_TypeError,
+                     "buffer must contain signed 32- or 64-bit integers, "
+                     "not '%s'", view.format);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+    size = groups ? 2 * (self->groups + 1) : 2;
+    capacity = view.len / view.itemsize / size;
+    if (capacity < 2) {
+        /* an empty match may have to be written again with the next one */
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer must have room for at least two matches");
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    if (!state_init(&state, self, string, pos, endpos)) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    while (state.start <= state.end) {
+        Py_ssize_t start, end;
+
+        state_reset(&state);
+
+        state.ptr = state.start;
+
+        status = sre_search(&state, PatternObject_GetCode(self));
+        if (PyErr_Occurred())
+            goto error;
+
+        if (status <= 0) {
+            if (status == 0)
+                break;
+            pattern_error(status);
+            goto error;
+        }
+
+        start = STATE_OFFSET(&state, state.start);
+        end = STATE_OFFSET(&state, state.ptr);
+        if (count == capacity) {
+            /* resuming the search at an empty match would find it again
+               instead of this one, so leave it for the next call */
+            if (last_start == last_end && last_end == start) {
+                count--;
+            }
+            next = PyLong_FromSsize_t(start);
+            if (!next)
+                goto error;
+            break;
+        }
+
+        i = count * size;
+        if (write_span_item(&view, i, start) < 0 ||
+            write_span_item(&view, i + 1, end) < 0)
+            goto error;
+        if (groups) {
+            Py_ssize_t g, j;
+            for (g = 0, j = 0; g < self->groups; g++, j += 2) {
+                Py_ssize_t b = -1, e = -1;
+                if (j+1 <= state.lastmark && state.mark[j] && state.mark[j+1]) {
+                    b = STATE_OFFSET(&state, state.mark[j]);
+                    e = STATE_OFFSET(&state, state.mark[j+1]);
+                }
+                if (write_span_item(&view, i + j + 2, b) < 0 ||
+                    write_span_item(&view, i + j + 3, e) < 0)
+                    goto error;
+            }
+        }
+        count++;
+        last_start = start;
+        last_end = end;
+
+        state.must_advance = (state.ptr == state.start);
+        state.start = state.ptr;
+    }
+
+    state_fini(&state);
+    PyBuffer_Release(&view);
+    if (next == NULL)
+        return Py_BuildValue("(nO)", count, Py_None);
+    return Py_BuildValue("(nN)", count, next);
+
+error:
+    state_fini(&state);
+    PyBuffer_Release(&view);
+    return NULL;
+}
+
 /*[clinic input]
 _sre.SRE_Pattern.scanner
 
@@ -1527,6 +1730,7 @@ pattern_repr(PyObject *self)
         {"re.VERBOSE", SRE_FLAG_VERBOSE},
         {"re.DEBUG", SRE_FLAG_DEBUG},
         {"re.ASCII", SRE_FLAG_ASCII},
+        {"re.LINEAR", SRE_FLAG_LINEAR},
     };
 
     PatternObject *obj = _PatternObject_CAST(self);
@@ -1606,6 +1810,7 @@ pattern_groupindex(PyObject *op, void *Py_UNUSED(ignored))
 }
 
 static int _validate(PatternObject *self); /* Forward */
+static int _linear_compile(PatternObject *self); /* Forward */
 
 /*[clinic input]
 _sre.compile
@@ -1640,6 +1845,7 @@ _sre_compile_impl(PyObject *module, PyObject *pattern, int flags,
     self->pattern = NULL;
     self->groupindex = NULL;
     self->indexgroup = NULL;
+    self->linear = NULL;
 #ifdef Py_DEBUG
     self->fail_after_count = -1;
     self->fail_after_exc = NULL;
@@ -1702,6 +1908,11 @@ _sre_compile_impl(PyObject *module, PyObject *pattern, int flags,
         return NULL;
     }
 
+    if ((flags & SRE_FLAG_LINEAR) && !_linear_compile(self)) {
+        Py_DECREF(self);
+        return NULL;
+    }
+
     return (PyObject*) self;
 }
 
@@ -2010,8 +2221,8 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
             {
                 /* A minimal info field is
                    <INFO> <1=skip> <2=flags> <3=min> <4=max>;
-                   If SRE_INFO_PREFIX or SRE_INFO_CHARSET is in the flags,
-                   more follows. */
+                   If SRE_INFO_REQUIRED, SRE_INFO_PREFIX or
+                   SRE_INFO_CHARSET is in the flags, more follows. */
                 SRE_CODE flags, i;
                 SRE_CODE *newcode;
                 GET_SKIP;
@@ -2022,7 +2233,8 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
                 /* Check that only valid flags are present */
                 if ((flags & ~(SRE_INFO_PREFIX |
                                SRE_INFO_LITERAL |
-                               SRE_INFO_CHARSET)) != 0)
+                               SRE_INFO_CHARSET |
+                               SRE_INFO_REQUIRED)) != 0)
                     FAIL;
                 /* PREFIX and CHARSET are mutually exclusive */
                 if ((flags & SRE_INFO_PREFIX) &&
@@ -2032,6 +2244,19 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
                 if ((flags & SRE_INFO_LITERAL) &&
                     !(flags & SRE_INFO_PREFIX))
                     FAIL;
+                /* Validate the required literal */
+                if (flags & SRE_INFO_REQUIRED) {
+                    SRE_CODE required_len, required_lo;
+                    GET_ARG; required_len = arg;
+                    GET_ARG; required_lo = arg;
+                    GET_ARG;
+                    if (required_len == 0 || arg < required_lo)
+                        FAIL;
+                    /* Here comes the literal */
+                    if (required_len > (uintptr_t)(newcode - code))
+                        FAIL;
+                    code += required_len;
+                }
                 /* Validate the prefix */
                 if (flags & SRE_INFO_PREFIX) {
                     SRE_CODE prefix_len;
@@ -2260,6 +2485,337 @@ _validate(PatternObject *self)
     return 1;
 }
 
+/* -------------------------------------------------------------------- */
+/* linear-time engine */
+
+/* With the LINEAR flag, the validated pattern code is translated into a
+   program for a Pike VM (see SRE(linear) in sre_lib.h), which follows all
+   alternatives in lockstep, one character of the string at a time.  The
+   matching time is then O(len(string) * len(program)) whatever the
+   pattern.  Group references, lookaround assertions, atomic groups and
+   possessive repeats are rejected by the compiler beforehand.
+
+   Counted repeats are unrolled.  The zero-width match protection of the
+   UNTIL operators is kept with a per-thread slot holding the position at
+   which the current iteration of the repeat started. */
+
+#define SRE_LINEAR_MAXSIZE (1 << 20)
+
+typedef struct {
+    SRE_CODE *code;
+    SRE_CODE *scope; /* innermost repeat slot + 1 of each word (or 0) */
+    Py_ssize_t size;
+    Py_ssize_t allocated;
+    const SRE_CODE *base; /* start of the pattern code */
+    Py_ssize_t slots; /* number of thread slots used so far */
+    Py_ssize_t loop; /* innermost repeat slot + 1 (or 0) */
+} linear_compiler;
+
+static int
+linear_emit(linear_compiler *c, SRE_CODE word)
+{
+    if (c->size >= c->allocated) {
+        if (c->allocated >= SRE_LINEAR_MAXSIZE) {
+            PyErr_SetString(PyExc_OverflowError,
+                            "regular expression is too large for the "
+                            "linear-time engine");
+            return -1;
+        }
+        Py_ssize_t allocated = c->allocated * 2;
+        SRE_CODE *code = PyMem_Resize(c->code, SRE_CODE, allocated);
+        if (code == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        c->code = code;
+        SRE_CODE *scope = PyMem_Resize(c->scope, SRE_CODE, allocated);
+        if (scope == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        c->scope = scope;
+        c->allocated = allocated;
+    }
+    c->scope[c->size] = (SRE_CODE)c->loop;
+    c->code[c->size++] = word;
+    return 0;
+}
+
+/* Jumps to a location which is not known yet are chained through their
+   operands, starting at *chain (0 ends the chain, since no operand is at
+   the start of the program). */
+static int
+linear_emit_chained(linear_compiler *c, Py_ssize_t *chain)
+{
+    Py_ssize_t pos = c->size;
+    if (linear_emit(c, (SRE_CODE)*chain) < 0)
+        return -1;
+    *chain = pos;
+    return 0;
+}
+
+static void
+linear_patch(linear_compiler *c, Py_ssize_t chain)
+{
+    while (chain) {
+        Py_ssize_t next = c->code[chain];
+        c->code[chain] = (SRE_CODE)c->size;
+        chain = next;
+    }
+}
+
+static const SRE_CODE *linear_compile_seq(linear_compiler *c,
+                                          const SRE_CODE *code);
+
+static int
+linear_compile_repeat(linear_compiler *c, const SRE_CODE *item,
+                      SRE_CODE min, SRE_CODE max, int greedy, int check)
+{
+    Py_ssize_t slot = 0, exits = 0, outer = c->loop;
+    SRE_CODE i;
+
+    for (i = 0; i < min; i++) {
+        if (!linear_compile_seq(c, item))
+            return -1;
+    }
+    if (min == max)
+        return 0;
+    if (check) {
+        /* zero-width match protection for items which can match an
+           empty string (REPEAT, as opposed to REPEAT_ONE) */
+        slot = c->slots++;
+        if (linear_emit(c, SRE_LINEAR_CLEAR) < 0 ||
+            linear_emit(c, (SRE_CODE)slot) < 0)
+            return -1;
+    }
+    for (i = min; max == SRE_MAXREPEAT || i < max; i++) {
+        Py_ssize_t top = c->size;
+        if (check) {
+            if (linear_emit(c, SRE_LINEAR_LOOP) < 0 ||
+                linear_emit(c, (SRE_CODE)slot) < 0 ||
+                linear_emit(c, greedy) < 0 ||
+                linear_emit_chained(c, &exits) < 0)
+                return -1;
+            c->loop = slot + 1;
+        }
+        else if (greedy) {
+            if (linear_emit(c, SRE_LINEAR_SPLIT) < 0 ||
+                linear_emit(c, (SRE_CODE)(top + 3)) < 0 ||
+                linear_emit_chained(c, &exits) < 0)
+                return -1;
+        }
+        else {
+            if (linear_emit(c, SRE_LINEAR_SPLIT) < 0 ||
+                linear_emit_chained(c, &exits) < 0 ||
+                linear_emit(c, (SRE_CODE)(top + 3)) < 0)
+                return -1;
+        }
+        if (!linear_compile_seq(c, item))
+            return -1;
+        if (max == SRE_MAXREPEAT) {
+            if (linear_emit(c, SRE_LINEAR_JUMP) < 0 ||
+                linear_emit(c, (SRE_CODE)top) < 0)
+                return -1;
+            c->loop = outer;
+            break;
+        }
+        c->loop = outer;
+    }
+    linear_patch(c, exits);
+    return 0;
+}
+
+/* Translate the pattern code up to the end of the current sequence (a
+   SUCCESS, JUMP or UNTIL operator), and return a pointer to it. */
+static const SRE_CODE *
+linear_compile_seq(linear_compiler *c, const SRE_CODE *code)
+{
+    for (;;) {
+        switch (code[0]) {
+
+        case SRE_OP_SUCCESS:
+        case SRE_OP_JUMP:
+        case SRE_OP_MAX_UNTIL:
+        case SRE_OP_MIN_UNTIL:
+            return code;
+
+        case SRE_OP_INFO:
+            code += 1 + code[1];
+            break;
+
+        case SRE_OP_MARK:
+        case SRE_OP_AT:
+            if (linear_emit(c, code[0] == SRE_OP_MARK ? SRE_LINEAR_MARK
+                                                      : SRE_LINEAR_AT) < 0 ||
+                linear_emit(c, code[1]) < 0)
+                return NULL;
+            code += 2;
+            break;
+
+        case SRE_OP_ANY:
+        case SRE_OP_ANY_ALL:
+        case SRE_OP_CATEGORY:
+        case SRE_OP_LITERAL:
+        case SRE_OP_NOT_LITERAL:
+        case SRE_OP_LITERAL_IGNORE:
+        case SRE_OP_NOT_LITERAL_IGNORE:
+        case SRE_OP_LITERAL_LOC_IGNORE:
+        case SRE_OP_NOT_LITERAL_LOC_IGNORE:
+        case SRE_OP_LITERAL_UNI_IGNORE:
+        case SRE_OP_NOT_LITERAL_UNI_IGNORE:
+        case SRE_OP_IN:
+        case SRE_OP_IN_IGNORE:
+        case SRE_OP_IN_LOC_IGNORE:
+        case SRE_OP_IN_UNI_IGNORE:
+            if (linear_emit(c, SRE_LINEAR_CHAR) < 0 ||
+                linear_emit(c, (SRE_CODE)(code - c->base)) < 0)
+                return NULL;
+            switch (code[0]) {
+            case SRE_OP_ANY:
+            case SRE_OP_ANY_ALL:
+                code += 1;
+                break;
+            case SRE_OP_IN:
+            case SRE_OP_IN_IGNORE:
+            case SRE_OP_IN_LOC_IGNORE:
+            case SRE_OP_IN_UNI_IGNORE:
+                code += 1 + code[1];
+                break;
+            default:
+                code += 2;
+            }
+            break;
+
+        case SRE_OP_BRANCH: {
+            /* <BRANCH> <0=skip> code <JUMP> ... <NULL> */
+            const SRE_CODE *alt = code + 1;
+            Py_ssize_t jumps = 0;
+            while (alt[0]) {
+                const SRE_CODE *next = alt + alt[0];
+                Py_ssize_t split = c->size;
+                if (next[0]) {
+                    /* not the last alternative */
+                    if (linear_emit(c, SRE_LINEAR_SPLIT) < 0 ||
+                        linear_emit(c, (SRE_CODE)(split + 3)) < 0 ||
+                        linear_emit(c, 0) < 0)
+                        return NULL;
+                }
+                const SRE_CODE *end = linear_compile_seq(c, alt + 1);
+                if (end == NULL)
+                    return NULL;
+                if (end[0] != SRE_OP_JUMP)
+                    goto unsupported;
+                if (next[0]) {
+                    if (linear_emit(c, SRE_LINEAR_JUMP) < 0 ||
+                        linear_emit_chained(c, &jumps) < 0)
+                        return NULL;
+                    c->code[split + 2] = (SRE_CODE)c->size;
+                }
+                alt = next;
+            }
+            linear_patch(c, jumps);
+            code = alt + 1;
+            break;
+        }
+
+        case SRE_OP_REPEAT:
+        case SRE_OP_REPEAT_ONE:
+        case SRE_OP_MIN_REPEAT_ONE: {
+            /* <REPEAT> <skip> <1=min> <2=max> item <UNTIL> tail */
+            /* <REPEAT_ONE> <skip> <1=min> <2=max> item <SUCCESS> tail */
+            const SRE_CODE *tail = code + 1 + code[1];
+            int greedy, check;
+            if (code[0] == SRE_OP_REPEAT) {
+                greedy = tail[0] == SRE_OP_MAX_UNTIL;
+                check = 1;
+                tail++;
+            }
+            else {
+                greedy = code[0] == SRE_OP_REPEAT_ONE;
+                check = 0;
+            }
+            if (linear_compile_repeat(c, code + 4, code[2], code[3],
+                                      greedy, check) < 0)
+                return NULL;
+            code = tail;
+            break;
+        }
+
+        default:
+            goto unsupported;
+        }
+    }
+
+unsupported:
+    PyErr_SetString(PyExc_ValueError,
+                    "pattern is not supported by the linear-time engine");
+    return NULL;
+}
+
+static int
+_linear_compile(PatternObject *self)
+{
+    linear_compiler c;
+    SRE_LINEAR *prog = NULL;
+    c.allocated = 64;
+    c.code = PyMem_New(SRE_CODE, c.allocated);
+    c.scope = PyMem_New(SRE_CODE, c.allocated);
+    if (c.code == NULL || c.scope == NULL) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+    c.size = 0;
+    c.base = self->code;
+    c.slots = 2 + 2 * self->groups;
+    c.loop = 0;
+
+    const SRE_CODE *end = linear_compile_seq(&c, self->code);
+    if (end == NULL || linear_emit(&c, SRE_LINEAR_MATCH) < 0)
+        goto exit;
+    assert(end[0] == SRE_OP_SUCCESS);
+
+    /* the scope of the instructions follows the code */
+    prog = PyMem_Malloc(sizeof(SRE_LINEAR) + 2 * c.size * sizeof(SRE_CODE));
+    if (prog == NULL) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+    prog->size = c.size;
+    memcpy(prog->code, c.code, c.size * sizeof(SRE_CODE));
+    memcpy(prog->code + c.size, c.scope, c.size * sizeof(SRE_CODE));
+
+    /* only the CHAR and MATCH instructions hold threads between steps */
+    prog->threads = 0;
+    for (Py_ssize_t pc = 0; pc < c.size; ) {
+        switch (c.code[pc]) {
+        case SRE_LINEAR_MATCH:
+            prog->threads++;
+            pc += 1;
+            break;
+        case SRE_LINEAR_CHAR:
+            prog->threads++;
+            pc += 2;
+            break;
+        case SRE_LINEAR_SPLIT:
+            pc += 3;
+            break;
+        case SRE_LINEAR_LOOP:
+            pc += 4;
+            break;
+        default:
+            pc += 2;
+        }
+    }
+    prog->marks = 2 * self->groups;
+    prog->slots = c.slots;
+    self->linear = prog;
+
+exit:
+    PyMem_Free(c.code);
+    PyMem_Free(c.scope);
+    return self->linear != NULL;
+}
+
 /* -------------------------------------------------------------------- */
 /* match methods */
 
@@ -2981,6 +3537,387 @@ pattern_scanner(_sremodulestate *module_state,
     return (PyObject*) scanner;
 }
 
+/* -------------------------------------------------------------------- */
+/* pattern set */
+
+/* find the longest literal in the info block of a pattern; return its
+   length (0 if there is none) */
+static Py_ssize_t
+pattern_literal(PatternObject* pattern, const SRE_CODE** literal, int* exact)
+{
+    const SRE_CODE* code = PatternObject_GetCode(pattern);
+    const SRE_CODE* info = code + 5;
+    Py_ssize_t len = 0;
+
+    *exact = 0;
+    if (code[0] != SRE_OP_INFO)
+        return 0;
+    if (code[2] & SRE_INFO_REQUIRED) {
+        /* <length> <min offset> <max offset> <literal data> */
+        len = info[0];
+        *literal = info + 3;
+        info += 3 + info[0];
+    }
+    if ((code[2] & SRE_INFO_PREFIX) && (Py_ssize_t)info[0] >= len) {
+        /* <length> <skip> <prefix data> <overlap data> */
+        len = info[0];
+        *literal = info + 2;
+        *exact = (code[2] & SRE_INFO_LITERAL) != 0;
+    }
+    if (len > SRE_REQUIRED_MAXLEN) {
+        /* a prefix of a required literal is required too */
+        len = SRE_REQUIRED_MAXLEN;
+        *exact = 0;
+    }
+    return len;
+}
+
+static void
+patternset_add_edge(PatternSetObject* set, Py_ssize_t node, SRE_CODE ch,
+                    Py_ssize_t child)
+{
+    size_t i;
+    if (node == 0 && ch < 256) {
+        set->root[ch] = child;
+        return;
+    }
+    for (i = sre_set_hash(node, ch) & set->mask; set->edges[i].child;
+         i = (i + 1) & set->mask)
+        ;
+    set->edges[i].node = node;
+    set->edges[i].child = child;
+    set->edges[i].ch = ch;
+}
+
+/* build the Aho-Corasick automaton over the literals of the patterns */
+static int
+patternset_build(PatternSetObject* set)
+{
+    Py_ssize_t n = PyTuple_GET_SIZE(set->patterns);
+    Py_ssize_t total = 1, i, j, maxdepth = 0;
+    Py_ssize_t *parent = NULL, *depth = NULL, *order = NULL, *count = NULL;
+    SRE_CODE *incoming = NULL;
+    unsigned char *terminal = NULL;
+    size_t slots = 1;
+    int result = -1;
+
+    for (i = 0; i < n; i++) {
+        const SRE_CODE* literal;
+        int exact;
+        total += pattern_literal(
+            (PatternObject *)PyTuple_GET_ITEM(set->patterns, i),
+            &literal, &exact);
+    }
+    while (slots < 2 * (size_t)total)
+        slots <<= 1;
+
+    set->literal = PyMem_New(Py_ssize_t, n);
+    set->exact = PyMem_New(unsigned char, n);
+    set->fail = PyMem_New(Py_ssize_t, total);
+    set->output = PyMem_New(Py_ssize_t, total);
+    set->edges = PyMem_Calloc(slots, sizeof(SRE_SET_EDGE));
+    parent = PyMem_New(Py_ssize_t, total);
+    depth = PyMem_New(Py_ssize_t, total);
+    order = PyMem_New(Py_ssize_t, total);
+    incoming = PyMem_New(SRE_CODE, total);
+    terminal = PyMem_Calloc(total, 1);
+    if (!set->literal || !set->exact || !set->fail || !set->output ||
+        !set->edges || !parent || !depth || !order || !incoming || !terminal)
+    {
+        PyErr_NoMemory();
+        goto exit;
+    }
+    set->mask = slots - 1;
+    memset(set->root, 0, sizeof(set->root));
+
+    /* insert the literals into the trie */
+    set->nodes = 1;
+    depth[0] = 0;
+    for (i = 0; i < n; i++) {
+        const SRE_CODE* literal;
+        int exact;
+        Py_ssize_t len, node = 0;
+        len = pattern_literal(
+            (PatternObject *)PyTuple_GET_ITEM(set->patterns, i),
+            &literal, &exact);
+        set->exact[i] = (unsigned char)exact;
+        if (len == 0) {
+            set->literal[i] = -1;
+            continue;
+        }
+        for (j = 0; j < len; j++) {
+            Py_ssize_t child = sre_set_goto(set, node, literal[j]);
+            if (child < 0) {
+                child = set->nodes++;
+                parent[child] = node;
+                depth[child] = depth[node] + 1;
+                incoming[child] = literal[j];
+                if (depth[child] > maxdepth)
+                    maxdepth = depth[child];
+                patternset_add_edge(set, node, literal[j], child);
+            }
+            node = child;
+        }
+        set->literal[i] = node;
+        terminal[node] = 1;
+    }
+
+    /* sort the nodes by depth, so that the fail link of a node is
+       computed before those of its descendants */
+    count = PyMem_Calloc(maxdepth + 2, sizeof(Py_ssize_t));
+    if (!count) {
+        PyErr_NoMemory();
+        goto exit;
+    }
+    for (i = 0; i < set->nodes; i++)
+        count[depth[i] + 1]++;
+    for (i = 1; i <= maxdepth; i++)
+        count[i] += count[i - 1];
+    for (i = 0; i < set->nodes; i++)
+        order[count[depth[i]]++] = i;
+
+    set->terminals = 0;
+    set->fail[0] = 0;
+    set->output[0] = 0;
+    for (j = 1; j < set->nodes; j++) {
+        Py_ssize_t node = order[j], fail = 0;
+        if (depth[node] > 1) {
+            Py_ssize_t next;
+            fail = set->fail[parent[node]];
+            while ((next = sre_set_goto(set, fail, incoming[node])) < 0 &&
+                   fail != 0)
+                fail = set->fail[fail];
+            if (next > 0)
+                fail = next;
+        }
+        set->fail[node] = fail;
+        if (terminal[node]) {
+            set->output[node] = node;
+            set->terminals++;
+        }
+        else
+            set->output[node] = set->output[fail];
+    }
+    result = 0;
+
+exit:
+    PyMem_Free(parent);
+    PyMem_Free(depth);
+    PyMem_Free(order);
+    PyMem_Free(count);
+    PyMem_Free(incoming);
+    PyMem_Free(terminal);
+    return result;
+}
+
+/*[clinic input]
+_sre.compile_set
+
+    patterns: object(subclass_of='&PyTuple_Type')
+        A tuple of compiled patterns.
+    /
+
+[clinic start generated code]*/
+
+static PyObject *
+_sre_compile_set_impl(PyObject *module, PyObject *patterns)
+/*[clinic end generated code: output=1060133a261ef030 input=9a9304b80066de3f]*/
+{
+    _sremodulestate *module_state = get_sre_module_state(module);
+    PatternSetObject* self;
+    Py_ssize_t i, n = PyTuple_GET_SIZE(patterns);
+    int isbytes = -1;
+
+    for (i = 0; i < n; i++) {
+        PyObject* item = PyTuple_GET_ITEM(patterns, i);
+        int item_isbytes;
+        if (!Py_IS_TYPE(item, module_state->Pattern_Type)) {
+            PyErr_Format(PyExc_TypeError,
+                         "expected a compiled pattern, got '%.200s'",
+                         Py_TYPE(item)->tp_name);
+            return NULL;
+        }
+        item_isbytes = ((PatternObject *)item)->isbytes;
+        if (item_isbytes >= 0) {
+            if (isbytes >= 0 && isbytes != item_isbytes) {
+                PyErr_SetString(PyExc_TypeError,
+                                "cannot mix string and bytes patterns");
+                return NULL;
+            }
+            isbytes = item_isbytes;
+        }
+    }
+
+    self = PyObject_GC_New(PatternSetObject, module_state->PatternSet_Type);
+    if (!self)
+        return NULL;
+    self->patterns = Py_NewRef(patterns);
+    self->isbytes = isbytes;
+    self->nodes = self->terminals = 0;
+    self->fail = self->output = self->literal = NULL;
+    self->edges = NULL;
+    self->exact = NULL;
+    PyObject_GC_Track(self);
+
+    if (patternset_build(self) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+/*[clinic input]
+_sre.SRE_PatternSet.matches
+
+    string: object
+    pos: Py_ssize_t = 0
+    endpos: Py_ssize_t(c_default="PY_SSIZE_T_MAX") = sys.maxsize
+
+Return a list of the indices of the patterns which match somewhere in string.
+
+The string is scanned once for the literals required by the patterns, and
+only the patterns whose literal occurs in it are searched for.
+[clinic start generated code]*/
+
+static PyObject *
+_sre_SRE_PatternSet_matches_impl(PatternSetObject *self, PyObject *string,
+                                 Py_ssize_t pos, Py_ssize_t endpos)
+/*[clinic end generated code: output=39bf0704d9023fea input=05b899b868f77724]*/
+{
+    Py_ssize_t i, n = PyTuple_GET_SIZE(self->patterns);
+    Py_ssize_t length;
+    int isbytes, charsize;
+    const void* ptr;
+    Py_buffer view;
+    unsigned char* found = NULL;
+    PyObject* list = NULL;
+
+    view.buf = NULL;
+    ptr = getstring(string, &length, &isbytes, &charsize, &view);
+    if (!ptr)
+        return NULL;
+    if (self->isbytes >= 0 && isbytes != self->isbytes) {
+        PyErr_SetString(PyExc_TypeError, isbytes ?
+                        "cannot use a string pattern on a bytes-like object" :
+                        "cannot use a bytes pattern on a string-like object");
+        goto exit;
+    }
+
+    /* adjust boundaries */
+    if (pos < 0)
+        pos = 0;
+    else if (pos > length)
+        pos = length;
+    if (endpos < 0)
+        endpos = 0;
+    else if (endpos > length)
+        endpos = length;
+
+    if (self->terminals) {
+        found = PyMem_Calloc(self->nodes, 1);
+        if (!found) {
+            PyErr_NoMemory();
+            goto exit;
+        }
+        if (charsize == 1)
+            sre_ucs1_set_scan(self, (const Py_UCS1 *)ptr + pos,
+                              (const Py_UCS1 *)ptr + endpos, found,
+                              self->terminals);
+        else if (charsize == 2)
+            sre_ucs2_set_scan(self, (const Py_UCS2 *)ptr + pos,
+                              (const Py_UCS2 *)ptr + endpos, found,
+                              self->terminals);
+        else
+            sre_ucs4_set_scan(self, (const Py_UCS4 *)ptr + pos,
+                              (const Py_UCS4 *)ptr + endpos, found,
+                              self->terminals);
+    }
+
+    list = PyList_New(0);
+    if (!list)
+        goto exit;
+    for (i = 0; i < n; i++) {
+        PyObject* index;
+
+        if (self->literal[i] >= 0 && !found[self->literal[i]])
+            continue;
+        if (self->literal[i] < 0 || !self->exact[i]) {
+            PatternObject* pattern;
+            SRE_STATE state;
+            Py_ssize_t status;
+
+            pattern = (PatternObject *)PyTuple_GET_ITEM(self->patterns, i);
+            if (!state_init(&state, pattern, string, pos, endpos))
+                goto error;
+            status = sre_search(&state, PatternObject_GetCode(pattern));
+            state_fini(&state);
+            if (PyErr_Occurred())
+                goto error;
+            if (status < 0) {
+                pattern_error(status);
+                goto error;
+            }
+            if (status == 0)
+                continue;
+        }
+        index = PyLong_FromSsize_t(i);
+        if (!index || PyList_Append(list, index) < 0) {
+            Py_XDECREF(index);
+            goto error;
+        }
+        Py_DECREF(index);
+    }
+    goto exit;
+
+error:
+    Py_CLEAR(list);
+exit:
+    PyMem_Free(found);
+    if (view.buf)
+        PyBuffer_Release(&view);
+    return list;
+}
+
+static int
+patternset_traverse(PyObject *op, visitproc visit, void *arg)
+{
+    PatternSetObject *self = (PatternSetObject *)op;
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->patterns);
+    return 0;
+}
+
+static int
+patternset_clear(PyObject *op)
+{
+    PatternSetObject *self = (PatternSetObject *)op;
+    Py_CLEAR(self->patterns);
+    return 0;
+}
+
+static void
+patternset_dealloc(PyObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    PatternSetObject *set = (PatternSetObject *)self;
+    PyObject_GC_UnTrack(self);
+    (void)patternset_clear(self);
+    PyMem_Free(set->fail);
+    PyMem_Free(set->output);
+    PyMem_Free(set->edges);
+    PyMem_Free(set->literal);
+    PyMem_Free(set->exact);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static Py_ssize_t
+patternset_length(PyObject *op)
+{
+    PatternSetObject *self = (PatternSetObject *)op;
+    return PyTuple_GET_SIZE(self->patterns);
+}
+
 /* -------------------------------------------------------------------- */
 /* template methods */
 
@@ -3169,6 +4106,7 @@ static PyMethodDef pattern_methods[] = {
     _SRE_SRE_PATTERN_FINDALL_METHODDEF
     _SRE_SRE_PATTERN_SPLIT_METHODDEF
     _SRE_SRE_PATTERN_FINDITER_METHODDEF
+    _SRE_SRE_PATTERN_FINDSPANS_INTO_METHODDEF
     _SRE_SRE_PATTERN_SCANNER_METHODDEF
     _SRE_SRE_PATTERN___COPY___METHODDEF
     _SRE_SRE_PATTERN___DEEPCOPY___METHODDEF
@@ -3316,6 +4254,38 @@ static PyType_Spec scanner_spec = {
     .slots = scanner_slots,
 };
 
+PyDoc_STRVAR(patternset_doc, "Compiled set of regular expression objects.");
+
+static PyMethodDef patternset_methods[] = {
+    _SRE_SRE_PATTERNSET_MATCHES_METHODDEF
+    {NULL, NULL}
+};
+
+static PyMemberDef patternset_members[] = {
+    {"patterns", _Py_T_OBJECT, offsetof(PatternSetObject, patterns),
+     Py_READONLY, "The tuple of the patterns in the set."},
+    {NULL}  /* Sentinel */
+};
+
+static PyType_Slot patternset_slots[] = {
+    {Py_tp_dealloc, patternset_dealloc},
+    {Py_tp_doc, (void *)patternset_doc},
+    {Py_tp_methods, patternset_methods},
+    {Py_tp_members, patternset_members},
+    {Py_tp_traverse, patternset_traverse},
+    {Py_tp_clear, patternset_clear},
+    {Py_sq_length, patternset_length},
+    {0, NULL},
+};
+
+static PyType_Spec patternset_spec = {
+    .name = "re.PatternSet",
+    .basicsize = sizeof(PatternSetObject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE |
+              Py_TPFLAGS_DISALLOW_INSTANTIATION | Py_TPFLAGS_HAVE_GC),
+    .slots = patternset_slots,
+};
+
 static PyType_Slot template_slots[] = {
     {Py_tp_dealloc, template_dealloc},
     {Py_tp_traverse, template_traverse},
@@ -3335,6 +4305,7 @@ static PyType_Spec template_spec = {
 static PyMethodDef _functions[] = {
     _SRE_COMPILE_METHODDEF
     _SRE_TEMPLATE_METHODDEF
+    _SRE_COMPILE_SET_METHODDEF
     _SRE_GETCODESIZE_METHODDEF
     _SRE_ASCII_ISCASED_METHODDEF
     _SRE_UNICODE_ISCASED_METHODDEF
@@ -3352,6 +4323,7 @@ sre_traverse(PyObject *module, visitproc visit, void *arg)
     Py_VISIT(state->Match_Type);
     Py_VISIT(state->Scanner_Type);
     Py_VISIT(state->Template_Type);
+    Py_VISIT(state->PatternSet_Type);
     Py_VISIT(state->compile_template);
 
     return 0;
@@ -3366,6 +4338,7 @@ sre_clear(PyObject *module)
     Py_CLEAR(state->Match_Type);
     Py_CLEAR(state->Scanner_Type);
     Py_CLEAR(state->Template_Type);
+    Py_CLEAR(state->PatternSet_Type);
     Py_CLEAR(state->compile_template);
 
     return 0;
@@ -3403,6 +4376,7 @@ sre_exec(PyObject *m)
     CREATE_TYPE(m, state->Match_Type, &match_spec);
     CREATE_TYPE(m, state->Scanner_Type, &scanner_spec);
     CREATE_TYPE(m, state->Template_Type, &template_spec);
+    CREATE_TYPE(m, state->PatternSet_Type, &patternset_spec);
 
     if (PyModule_AddIntConstant(m, "MAGIC", SRE_MAGIC) < 0) {
         goto error;
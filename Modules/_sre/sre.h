@@ -24,6 +24,25 @@
 # define SRE_MAXGROUPS ((SRE_CODE)PY_SSIZE_T_MAX / SIZEOF_VOID_P / 2)
 #endif
 
+/* opcodes of the linear-time engine; jump targets are absolute */
+#define SRE_LINEAR_MATCH 0 /* <MATCH> */
+#define SRE_LINEAR_CHAR 1 /* <CHAR> <offset of single character item> */
+#define SRE_LINEAR_AT 2 /* <AT> <code> */
+#define SRE_LINEAR_MARK 3 /* <MARK> <gid> */
+#define SRE_LINEAR_JUMP 4 /* <JUMP> <target> */
+#define SRE_LINEAR_SPLIT 5 /* <SPLIT> <preferred target> <other target> */
+#define SRE_LINEAR_CLEAR 6 /* <CLEAR> <slot> */
+#define SRE_LINEAR_LOOP 7 /* <LOOP> <slot> <greedy> <exit> item */
+
+/* program for the linear-time engine (see _linear_compile() in sre.c) */
+typedef struct {
+    Py_ssize_t size; /* number of code words */
+    Py_ssize_t marks; /* number of marks (twice the number of groups) */
+    Py_ssize_t slots; /* thread slots: start, lastindex, marks, loops */
+    Py_ssize_t threads; /* number of CHAR and MATCH instructions */
+    SRE_CODE code[1]; /* followed by the innermost repeat of each word */
+} SRE_LINEAR;
+
 typedef struct {
     PyObject_VAR_HEAD
     Py_ssize_t groups; /* must be first! */
@@ -39,6 +58,7 @@ typedef struct {
     int fail_after_count;
     PyObject *fail_after_exc;
 #endif
+    SRE_LINEAR *linear; /* linear-time program (or NULL) */
     /* pattern code */
     Py_ssize_t codesize;
     SRE_CODE code[1];
@@ -107,6 +127,8 @@ typedef struct {
     SRE_REPEAT *repeat_pool_used;
     SRE_REPEAT *repeat_pool_unused;
     unsigned int sigcount;
+    /* linear-time program of the pattern (or NULL) */
+    const SRE_LINEAR *linear;
 #ifdef Py_DEBUG
     int fail_after_count;
     PyObject *fail_after_exc;
@@ -120,4 +142,27 @@ typedef struct {
     int executing;
 } ScannerObject;
 
+/* an edge of the Aho-Corasick trie of a pattern set */
+typedef struct {
+    Py_ssize_t node; /* parent node */
+    Py_ssize_t child; /* child node (0 if the hash table slot is empty) */
+    SRE_CODE ch;
+} SRE_SET_EDGE;
+
+typedef struct {
+    PyObject_HEAD
+    PyObject* patterns; /* tuple of Pattern objects */
+    int isbytes; /* pattern type (1 - bytes, 0 - string, -1 - any) */
+    /* Aho-Corasick automaton over the literals required by the patterns */
+    Py_ssize_t nodes; /* number of trie nodes (0 is the root) */
+    Py_ssize_t terminals; /* number of nodes ending a literal */
+    Py_ssize_t* fail; /* node of the longest proper suffix of each node */
+    Py_ssize_t* output; /* nearest node ending a literal on the fail chain */
+    SRE_SET_EDGE* edges; /* goto function (open addressing hash table) */
+    size_t mask; /* number of hash table slots minus one */
+    Py_ssize_t root[256]; /* goto function of the root for characters < 256 */
+    Py_ssize_t* literal; /* node ending the literal of each pattern (or -1) */
+    unsigned char* exact; /* the pattern matches exactly its literal */
+} PatternSetObject;
+
 #endif
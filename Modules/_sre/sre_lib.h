@@ -1688,6 +1688,28 @@ SRE(match)(SRE_STATE* state, const SRE_CODE* pattern, int toplevel)
 #define RESET_CAPTURE_GROUP() \
     do { state->lastmark = state->lastindex = -1; } while (0)
 
+/* find the first occurrence of a literal in [ptr, end), or return NULL */
+LOCAL(SRE_CHAR*)
+SRE(find)(SRE_CHAR* ptr, SRE_CHAR* end,
+          const SRE_CHAR* literal, Py_ssize_t len)
+{
+    const char* s = (const char *)ptr;
+    Py_ssize_t n = (end - ptr) * (Py_ssize_t)sizeof(SRE_CHAR);
+    Py_ssize_t i = 0;
+
+    len *= (Py_ssize_t)sizeof(SRE_CHAR);
+    while (n - i >= len) {
+        /* fast search on the bytes, skipping misaligned occurrences */
+        i = _PyBytes_Find(s + i, n - i, (const char *)literal, len, i);
+        if (i < 0)
+            return NULL;
+        if (i % sizeof(SRE_CHAR) == 0)
+            return ptr + i / sizeof(SRE_CHAR);
+        i += sizeof(SRE_CHAR) - i % sizeof(SRE_CHAR);
+    }
+    return NULL;
+}
+
 LOCAL(Py_ssize_t)
 SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
 {
@@ -1699,6 +1721,11 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
     SRE_CODE* prefix = NULL;
     SRE_CODE* charset = NULL;
     SRE_CODE* overlap = NULL;
+    SRE_CHAR required[SRE_REQUIRED_MAXLEN];
+    SRE_CHAR* required_ptr = NULL;
+    Py_ssize_t required_len = 0;
+    Py_ssize_t required_lo = 0;
+    Py_ssize_t required_hi = -1;
     int flags = 0;
     INIT_TRACE(state);
 
@@ -1707,10 +1734,30 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
 
     if (pattern[0] == SRE_OP_INFO) {
         /* optimization info block */
-        /* <INFO> <1=skip> <2=flags> <3=min> <4=max> <5=prefix info>  */
+        /* <INFO> <1=skip> <2=flags> <3=min> <4=max> <5=required info>
+           <prefix info> */
+        SRE_CODE* info = pattern + 5;
 
         flags = pattern[2];
 
+        if (flags & SRE_INFO_REQUIRED) {
+            /* every match contains a known literal */
+            /* <length> <min offset> <max offset> <literal data> */
+            Py_ssize_t i;
+            required_len = Py_MIN(info[0], SRE_REQUIRED_MAXLEN);
+            required_lo = info[1];
+            if (info[2] != ~(SRE_CODE)0)
+                required_hi = info[2];
+            for (i = 0; i < required_len; i++) {
+                required[i] = (SRE_CHAR) info[3 + i];
+#if SIZEOF_SRE_CHAR < 4
+                if ((SRE_CODE) required[i] != info[3 + i])
+                    return 0; /* literal can't match: doesn't fit in char width */
+#endif
+            }
+            info += 3 + info[0];
+        }
+
         if (pattern[3] && (uintptr_t)(end - ptr) < pattern[3]) {
             TRACE(("reject (got %tu chars, need %zu)\n",
                    end - ptr, (size_t) pattern[3]));
@@ -1727,18 +1774,44 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
         if (flags & SRE_INFO_PREFIX) {
             /* pattern starts with a known prefix */
             /* <length> <skip> <prefix data> <overlap data> */
-            prefix_len = pattern[5];
-            prefix_skip = pattern[6];
-            prefix = pattern + 7;
+            prefix_len = info[0];
+            prefix_skip = info[1];
+            prefix = info + 2;
             overlap = prefix + prefix_len - 1;
         } else if (flags & SRE_INFO_CHARSET)
             /* pattern starts with a character from a known set */
             /* <charset> */
-            charset = pattern + 5;
+            charset = info;
 
         pattern += 1 + pattern[1];
     }
 
+/* make sure that the required literal occurs at or after offset
+   required_lo from ptr, and skip ptr forward if the next occurrence
+   is farther away than a match can reach */
+#define SKIP_TO_REQUIRED()                                                  \
+    do {                                                                    \
+        if (required_ptr == NULL || required_ptr - ptr < required_lo) {     \
+            if ((SRE_CHAR *)state->end - ptr < required_lo + required_len)  \
+                return 0;                                                   \
+            required_ptr = SRE(find)(ptr + required_lo,                     \
+                                     (SRE_CHAR *)state->end,                \
+                                     required, required_len);               \
+            if (required_ptr == NULL)                                       \
+                return 0;                                                   \
+        }                                                                   \
+        if (required_hi >= 0 && required_ptr - ptr > required_hi)           \
+            ptr = required_ptr - required_hi;                               \
+    } while (0)
+
+    if (required_len) {
+        /* reject the string early if it doesn't contain the literal */
+        SKIP_TO_REQUIRED();
+        if (ptr > end)
+            return 0;
+        TRACE(("|%p|%p|SEARCH REQUIRED\n", pattern, required_ptr));
+    }
+
     TRACE(("prefix = %p %zd %zd\n",
            prefix, prefix_len, prefix_skip));
     TRACE(("charset = %p\n", charset));
@@ -1831,6 +1904,12 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
                 ptr++;
             if (ptr >= end)
                 return 0;
+            if (required_len) {
+                SRE_CHAR* next = ptr;
+                SKIP_TO_REQUIRED();
+                if (ptr != next)
+                    continue;
+            }
             TRACE(("|%p|%p|SEARCH CHARSET\n", pattern, ptr));
             state->start = ptr;
             state->ptr = ptr;
@@ -1856,6 +1935,11 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
         }
         while (status == 0 && ptr < end) {
             ptr++;
+            if (required_len) {
+                SKIP_TO_REQUIRED();
+                if (ptr > end)
+                    break;
+            }
             RESET_CAPTURE_GROUP();
             TRACE(("|%p|%p|SEARCH\n", pattern, ptr));
             state->start = state->ptr = ptr;
@@ -1863,6 +1947,379 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
         }
     }
 
+#undef SKIP_TO_REQUIRED
+    return status;
+}
+
+/* run the automaton of a pattern set over [ptr, end), marking the nodes
+   ending the literals which occur.  return the number of such nodes still
+   not found, starting from missing; stop early when all are found */
+LOCAL(Py_ssize_t)
+SRE(set_scan)(const PatternSetObject* set, const SRE_CHAR* ptr,
+              const SRE_CHAR* end, unsigned char* found, Py_ssize_t missing)
+{
+    Py_ssize_t node = 0;
+
+    for (; ptr < end; ptr++) {
+        SRE_CODE ch = *ptr;
+        Py_ssize_t next, out;
+        while ((next = sre_set_goto(set, node, ch)) < 0 && node != 0)
+            node = set->fail[node];
+        node = next < 0 ? 0 : next;
+        /* every node on the fail chain of a found node is found too */
+        for (out = set->output[node]; out > 0 && !found[out];
+             out = set->output[set->fail[out]])
+        {
+            found[out] = 1;
+            if (--missing == 0)
+                return 0;
+        }
+    }
+    return missing;
+}
+
+/* check if a character matches a single character item of the pattern
+   code (as used by the linear-time engine) */
+LOCAL(int)
+SRE(linear_char)(SRE_STATE* state, const SRE_CODE* item, SRE_CODE ch)
+{
+    switch (item[0]) {
+    case SRE_OP_ANY:
+        return !SRE_IS_LINEBREAK(ch);
+    case SRE_OP_ANY_ALL:
+        return 1;
+    case SRE_OP_CATEGORY:
+        return sre_category(item[1], ch);
+    case SRE_OP_LITERAL:
+        return ch == item[1];
+    case SRE_OP_NOT_LITERAL:
+        return ch != item[1];
+    case SRE_OP_LITERAL_IGNORE:
+        return sre_lower_ascii(ch) == item[1];
+    case SRE_OP_NOT_LITERAL_IGNORE:
+        return sre_lower_ascii(ch) != item[1];
+    case SRE_OP_LITERAL_UNI_IGNORE:
+        return sre_lower_unicode(ch) == item[1];
+    case SRE_OP_NOT_LITERAL_UNI_IGNORE:
+        return sre_lower_unicode(ch) != item[1];
+    case SRE_OP_LITERAL_LOC_IGNORE:
+        return char_loc_ignore(item[1], ch);
+    case SRE_OP_NOT_LITERAL_LOC_IGNORE:
+        return !char_loc_ignore(item[1], ch);
+    case SRE_OP_IN:
+        return SRE(charset)(state, item + 2, ch);
+    case SRE_OP_IN_IGNORE:
+        return SRE(charset)(state, item + 2, sre_lower_ascii(ch));
+    case SRE_OP_IN_UNI_IGNORE:
+        return SRE(charset)(state, item + 2, sre_lower_unicode(ch));
+    case SRE_OP_IN_LOC_IGNORE:
+        return SRE(charset_loc_ignore)(state, item + 2, ch);
+    }
+    Py_UNREACHABLE();
+}
+
+typedef struct {
+    Py_ssize_t pc; /* instruction to continue with (or -1) */
+    Py_ssize_t slot; /* slot to restore first (or -1) */
+    Py_ssize_t value;
+} SRE(linear_task);
+
+typedef struct {
+    Py_ssize_t n;
+    Py_ssize_t* pc; /* instructions of the threads, by priority */
+    Py_ssize_t* slots; /* slots of the threads */
+} SRE(linear_list);
+
+typedef struct {
+    const SRE_CODE* code;
+    const SRE_CODE* scope; /* innermost repeat slot + 1 (or 0) */
+    Py_ssize_t slots;
+    Py_ssize_t* seen; /* generation in which an instruction was visited */
+    Py_ssize_t generation;
+    Py_ssize_t* cur; /* slots of the thread being added */
+    SRE(linear_task)* stack;
+    Py_ssize_t stacksize;
+} SRE(linear_vm);
+
+LOCAL(int)
+SRE(linear_push)(SRE(linear_vm)* vm, Py_ssize_t* top,
+                 Py_ssize_t pc, Py_ssize_t slot, Py_ssize_t value)
+{
+    if (*top == vm->stacksize) {
+        Py_ssize_t size = vm->stacksize ? vm->stacksize * 2 : 64;
+        SRE(linear_task)* stack = PyMem_Resize(vm->stack,
+                                               SRE(linear_task), size);
+        if (stack == NULL)
+            return SRE_ERROR_MEMORY;
+        vm->stack = stack;
+        vm->stacksize = size;
+    }
+    vm->stack[*top].pc = pc;
+    vm->stack[*top].slot = slot;
+    vm->stack[*top].value = value;
+    (*top)++;
+    return 0;
+}
+
+/* Add the thread starting at pc, with the slots in vm->cur, to the list.
+   All instructions which don't consume a character are followed first, in
+   priority order, so only CHAR and MATCH instructions end up in the list.
+
+   An instruction already visited at this position is not followed again,
+   since a thread of higher priority got there first.  The future of a
+   thread also depends on whether the current iteration of its innermost
+   repeat started at this position (see SRE_LINEAR_LOOP), so instructions
+   are visited once for each case.  This lets a repeat match one more
+   empty iteration after a non-empty one, like the UNTIL operators do.
+   LOOP instructions themselves are always followed.  vm->cur is left
+   unchanged. */
+LOCAL(int)
+SRE(linear_add)(SRE_STATE* state, SRE(linear_vm)* vm,
+                SRE(linear_list)* list, Py_ssize_t pc, const SRE_CHAR* ptr)
+{
+    const SRE_CODE* code = vm->code;
+    Py_ssize_t* cur = vm->cur;
+    Py_ssize_t pos = ptr - (const SRE_CHAR *)state->beginning;
+    Py_ssize_t top = 0, slot;
+
+    for (;;) {
+        for (;;) {
+            if (code[pc] != SRE_LINEAR_LOOP) {
+                Py_ssize_t key = 2 * pc;
+                if (vm->scope[pc] && cur[vm->scope[pc] - 1] == pos)
+                    key++;
+                if (vm->seen[key] == vm->generation)
+                    break;
+                vm->seen[key] = vm->generation;
+            }
+            switch (code[pc]) {
+            case SRE_LINEAR_MATCH:
+            case SRE_LINEAR_CHAR:
+                list->pc[list->n] = pc;
+                memcpy(list->slots + list->n * vm->slots, cur,
+                       vm->slots * sizeof(Py_ssize_t));
+                list->n++;
+                break;
+            case SRE_LINEAR_AT:
+                if (!SRE(at)(state, ptr, code[pc+1]))
+                    break;
+                pc += 2;
+                continue;
+            case SRE_LINEAR_MARK:
+                /* <MARK> <gid> */
+                slot = 2 + code[pc+1];
+                if (code[pc+1] & 1) {
+                    if (SRE(linear_push)(vm, &top, -1, 1, cur[1]) < 0)
+                        return SRE_ERROR_MEMORY;
+                    cur[1] = code[pc+1] / 2 + 1;
+                }
+                if (SRE(linear_push)(vm, &top, -1, slot, cur[slot]) < 0)
+                    return SRE_ERROR_MEMORY;
+                cur[slot] = pos;
+                pc += 2;
+                continue;
+            case SRE_LINEAR_JUMP:
+                pc = code[pc+1];
+                continue;
+            case SRE_LINEAR_SPLIT:
+                if (SRE(linear_push)(vm, &top, code[pc+2], -1, 0) < 0)
+                    return SRE_ERROR_MEMORY;
+                pc = code[pc+1];
+                continue;
+            case SRE_LINEAR_CLEAR:
+                slot = code[pc+1];
+                if (SRE(linear_push)(vm, &top, -1, slot, cur[slot]) < 0)
+                    return SRE_ERROR_MEMORY;
+                cur[slot] = -1;
+                pc += 2;
+                continue;
+            case SRE_LINEAR_LOOP:
+                /* <LOOP> <slot> <greedy> <exit> item */
+                slot = code[pc+1];
+                if (cur[slot] == pos) {
+                    /* the last iteration matched an empty string */
+                    pc = code[pc+3];
+                    continue;
+                }
+                if (code[pc+2]) {
+                    if (SRE(linear_push)(vm, &top, code[pc+3],
+                                         slot, cur[slot]) < 0)
+                        return SRE_ERROR_MEMORY;
+                    cur[slot] = pos;
+                    pc += 4;
+                }
+                else {
+                    if (SRE(linear_push)(vm, &top, -1, slot, cur[slot]) < 0 ||
+                        SRE(linear_push)(vm, &top, pc + 4, slot, pos) < 0)
+                        return SRE_ERROR_MEMORY;
+                    pc = code[pc+3];
+                }
+                continue;
+            default:
+                return SRE_ERROR_ILLEGAL;
+            }
+            break;
+        }
+        /* continue with the next alternative */
+        for (;;) {
+            if (top == 0)
+                return 0;
+            top--;
+            if (vm->stack[top].slot >= 0)
+                cur[vm->stack[top].slot] = vm->stack[top].value;
+            if (vm->stack[top].pc >= 0) {
+                pc = vm->stack[top].pc;
+                break;
+            }
+        }
+    }
+}
+
+/* match (search == 0) or search the pattern with the linear-time engine
+   (a Pike VM).  returns <0 for error, 0 for failure, and 1 for success */
+LOCAL(Py_ssize_t)
+SRE(linear)(SRE_STATE* state, const SRE_CODE* pattern, int search)
+{
+    const SRE_LINEAR* prog = state->linear;
+    const SRE_CHAR* base = (const SRE_CHAR *)state->beginning;
+    const SRE_CHAR* start = (const SRE_CHAR *)state->start;
+    const SRE_CHAR* end = (const SRE_CHAR *)state->end;
+    const SRE_CHAR* ptr = start;
+    /* every instruction can be visited twice, see SRE(linear_add) */
+    Py_ssize_t size = 2 * prog->size, threads = 2 * prog->threads;
+    Py_ssize_t slots = prog->slots;
+    Py_ssize_t *block, *best, match_end = -1, i;
+    Py_ssize_t status = 0;
+    unsigned int sigcount = state->sigcount;
+    const SRE_CODE* prefix = NULL;
+    const SRE_CODE* charset = NULL;
+    SRE(linear_list) clist, nlist, tmp;
+    SRE(linear_vm) vm;
+
+    if (ptr > end)
+        return 0;
+
+    if (pattern[0] == SRE_OP_INFO) {
+        /* <INFO> <1=skip> <2=flags> <3=min> <4=max> <5=required info>
+           <prefix info> */
+        const SRE_CODE* info = pattern + 5;
+        if (pattern[3] && (uintptr_t)(end - ptr) < pattern[3])
+            return 0;
+        if (pattern[2] & SRE_INFO_REQUIRED)
+            info += 3 + info[0];
+        /* used to skip to the next possible start of a match */
+        if (pattern[2] & SRE_INFO_PREFIX)
+            prefix = info + 2;
+        else if (pattern[2] & SRE_INFO_CHARSET)
+            charset = info;
+    }
+
+    if (slots > (PY_SSIZE_T_MAX / (Py_ssize_t)sizeof(Py_ssize_t) - size) /
+                (threads + 1) / 2 - 1)
+        return SRE_ERROR_MEMORY;
+    block = PyMem_New(Py_ssize_t, size + 2 * threads * (slots + 1) + 2 * slots);
+    if (block == NULL)
+        return SRE_ERROR_MEMORY;
+    vm.code = prog->code;
+    vm.scope = prog->code + prog->size;
+    vm.slots = slots;
+    vm.seen = block;
+    memset(vm.seen, 0, size * sizeof(Py_ssize_t));
+    vm.generation = 0;
+    vm.cur = vm.seen + size;
+    vm.stack = NULL;
+    vm.stacksize = 0;
+    best = vm.cur + slots;
+    clist.n = nlist.n = 0;
+    clist.pc = best + slots;
+    nlist.pc = clist.pc + threads;
+    clist.slots = nlist.pc + threads;
+    nlist.slots = clist.slots + threads * slots;
+
+    for (;;) {
+        if (clist.n == 0 && match_end < 0 && search) {
+            if (prefix) {
+                while (ptr < end && (SRE_CODE)*ptr != prefix[0])
+                    ptr++;
+            }
+            else if (charset) {
+                while (ptr < end && !SRE(charset)(state, charset, *ptr))
+                    ptr++;
+            }
+        }
+        vm.generation++;
+        if (match_end < 0 && (search || ptr == start)) {
+            /* start a new thread, with the lowest priority */
+            for (i = 0; i < slots; i++)
+                vm.cur[i] = -1;
+            vm.cur[0] = ptr - base;
+            status = SRE(linear_add)(state, &vm, &clist, 0, ptr);
+            if (status < 0)
+                goto exit;
+        }
+        if (clist.n == 0 && (match_end >= 0 || !search || ptr >= end))
+            break;
+
+        nlist.n = 0;
+        vm.generation++;
+        for (i = 0; i < clist.n; i++) {
+            Py_ssize_t pc = clist.pc[i];
+            Py_ssize_t* ts = clist.slots + i * slots;
+            if (prog->code[pc] == SRE_LINEAR_MATCH) {
+                if ((state->match_all && ptr != end) ||
+                    (state->must_advance && ptr == start))
+                    continue;
+                /* threads of lower priority are dropped */
+                memcpy(best, ts, slots * sizeof(Py_ssize_t));
+                match_end = ptr - base;
+                break;
+            }
+            if (ptr < end &&
+                SRE(linear_char)(state, pattern + prog->code[pc+1], *ptr))
+            {
+                memcpy(vm.cur, ts, slots * sizeof(Py_ssize_t));
+                status = SRE(linear_add)(state, &vm, &nlist, pc + 2, ptr + 1);
+                if (status < 0)
+                    goto exit;
+            }
+        }
+        tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+        vm.generation--;
+
+        if (ptr >= end)
+            break;
+        ptr++;
+        if ((0 == (++sigcount & 0xfff)) && PyErr_CheckSignals()) {
+            status = SRE_ERROR_INTERRUPTED;
+            goto exit;
+        }
+    }
+
+    status = 0;
+    if (match_end >= 0) {
+        state->start = base + best[0];
+        state->ptr = base + match_end;
+        state->lastindex = (int)best[1];
+        state->lastmark = -1;
+        for (i = 0; i < prog->marks; i++) {
+            if (best[2 + i] >= 0) {
+                state->mark[i] = base + best[2 + i];
+                state->lastmark = (int)i;
+            }
+            else {
+                state->mark[i] = NULL;
+            }
+        }
+        status = 1;
+    }
+    state->must_advance = 0;
+
+exit:
+    state->sigcount = sigcount;
+    PyMem_Free(vm.stack);
+    PyMem_Free(block);
     return status;
 }
 
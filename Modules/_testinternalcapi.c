@@ -27,6 +27,7 @@
 #include "pycore_initconfig.h"    // _Py_GetConfigsAsDict()
 #include "pycore_instruction_sequence.h"  // _PyInstructionSequence_New()
 #include "pycore_interpframe.h"   // _PyFrame_GetFunction()
+#include "pycore_obmalloc.h"      // struct _obmalloc_numa_stats
 #include "pycore_object.h"        // _PyObject_IsFreed()
 #include "pycore_optimizer.h"     // _Py_Executor_DependsOn
 #include "pycore_pathconfig.h"    // _PyPathConfig_ClearGlobal()
@@ -2237,6 +2238,47 @@ get_tlbc_id(PyObject *Py_UNUSED(module), PyObject *obj)
     }
     return PyLong_FromVoidPtr(bc);
 }
+
+static PyObject *
+get_numa_heap_stats(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *result = PyDict_New();
+    if (result == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < _Py_NUMA_MAX_NODES; i++) {
+        struct _obmalloc_numa_stats *stats = &_PyRuntime.obmalloc.numa_stats[i];
+        Py_ssize_t total = _Py_atomic_load_ssize_relaxed(&stats->total_segments);
+        if (total == 0) {
+            continue;
+        }
+        PyObject *item = Py_BuildValue(
+            "{snsnsnsn}",
+            "segments", _Py_atomic_load_ssize_relaxed(&stats->segments),
+            "bytes", _Py_atomic_load_ssize_relaxed(&stats->bytes),
+            "total_segments", total,
+            "bind_failures", _Py_atomic_load_ssize_relaxed(&stats->bind_failures));
+        if (item == NULL) {
+            goto error;
+        }
+        PyObject *key = PyLong_FromLong(i);
+        if (key == NULL) {
+            Py_DECREF(item);
+            goto error;
+        }
+        int rc = PyDict_SetItem(result, key, item);
+        Py_DECREF(key);
+        Py_DECREF(item);
+        if (rc < 0) {
+            goto error;
+        }
+    }
+    return result;
+
+error:
+    Py_DECREF(result);
+    return NULL;
+}
 #endif
 
 static PyObject *
@@ -2435,6 +2477,7 @@ static PyMethodDef module_functions[] = {
     {"py_thread_id", get_py_thread_id, METH_NOARGS},
     {"get_tlbc", get_tlbc, METH_O, NULL},
     {"get_tlbc_id", get_tlbc_id, METH_O, NULL},
+    {"get_numa_heap_stats", get_numa_heap_stats, METH_NOARGS},
 #endif
 #ifdef _Py_TIER2
     {"uop_symbols_test", _Py_uop_symbols_test, METH_NOARGS},
@@ -0,0 +1,1388 @@
+/*
+ * Support for io_uring based I/O on Linux.
+ *
+ * A Ring wraps the submission and completion queues shared with the kernel.
+ * Methods such as Ring.recv() queue a request and return an Operation
+ * object which owns the buffers the kernel reads from or writes to.  Queued
+ * requests are handed to the kernel by the next Ring.wait() call, in the
+ * same io_uring_enter() system call that waits for completions, and
+ * Ring.wait() returns the operations that have completed.
+ *
+ * The ring holds a reference to every operation in flight, so that its
+ * buffers stay alive until the kernel has posted its completion.  Short
+ * sends and writes are resubmitted for the rest of the data, so that they
+ * complete once all data was transferred or an error occurred.
+ */
+
+#ifndef Py_BUILD_CORE_BUILTIN
+#  define Py_BUILD_CORE_MODULE 1
+#endif
+
+#include "Python.h"
+#include "pycore_time.h"          // _PyTime_FromSecondsObject()
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>               // close()
+
+
+/* Requested setup flags; they are dropped on kernels which reject them. */
+#ifdef IORING_SETUP_COOP_TASKRUN
+#  define URING_SETUP_FLAGS (IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN)
+#elif defined(IORING_SETUP_SUBMIT_ALL)
+#  define URING_SETUP_FLAGS IORING_SETUP_SUBMIT_ALL
+#else
+#  define URING_SETUP_FLAGS 0
+#endif
+
+/* Features the ring cannot work without: completions are never dropped,
+   requests on sockets are driven by internal polling rather than worker
+   threads, and io_uring_enter() accepts a timeout. */
+#define URING_REQUIRED_FEATURES \
+    (IORING_FEAT_NODROP | IORING_FEAT_FAST_POLL | IORING_FEAT_EXT_ARG)
+
+#define NS_PER_SEC (1000 * 1000 * 1000)
+
+enum {TYPE_RECV, TYPE_RECV_INTO, TYPE_SEND, TYPE_READ, TYPE_READ_INTO,
+      TYPE_WRITE, TYPE_ACCEPT, TYPE_POLL, TYPE_SPLICE};
+
+typedef struct {
+    PyTypeObject *ring_type;
+    PyTypeObject *operation_type;
+} uring_state;
+
+static inline uring_state *
+get_uring_state(PyObject *module)
+{
+    void *state = PyModule_GetState(module);
+    assert(state != NULL);
+    return (uring_state *)state;
+}
+
+typedef struct OperationObject OperationObject;
+
+typedef struct {
+    PyObject_HEAD
+    int fd;
+    unsigned int features;
+    /* Submission queue */
+    uint32_t *sq_head;
+    uint32_t *sq_tail;
+    uint32_t sq_mask;
+    uint32_t sq_entries;
+    uint32_t *sq_array;
+    struct io_uring_sqe *sqes;
+    /* Tail of the submission queue, as filled in by us */
+    uint32_t sqe_tail;
+    /* Completion queue */
+    uint32_t *cq_head;
+    uint32_t *cq_tail;
+    uint32_t cq_mask;
+    struct io_uring_cqe *cqes;
+    /* Mappings of the queues */
+    void *sq_ring;
+    size_t sq_ring_size;
+    void *cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+    /* Doubly linked list of the operations in flight */
+    OperationObject *inflight;
+    Py_ssize_t ninflight;
+} RingObject;
+
+struct OperationObject {
+    PyObject_HEAD
+    OperationObject *prev;
+    OperationObject *next;
+    /* The ring the operation was submitted to, while it is in flight */
+    RingObject *ring;
+    int type;
+    int pending;
+    int fd;
+    /* Result of the completion: a count, a descriptor or a negated errno */
+    int32_t res;
+    /* TYPE_SEND and TYPE_WRITE: flags, file offset and bytes transferred
+       so far */
+    int msg_flags;
+    long long offset;
+    Py_ssize_t done;
+    union {
+        /* Buffer allocated by us: TYPE_RECV and TYPE_READ */
+        PyObject *allocated_buffer;
+        /* Buffer passed by the user: TYPE_RECV_INTO, TYPE_READ_INTO,
+           TYPE_SEND and TYPE_WRITE */
+        Py_buffer user_buffer;
+    };
+};
+
+#define RingObject_CAST(op)         ((RingObject *)(op))
+#define OperationObject_CAST(op)    ((OperationObject *)(op))
+
+/*[clinic input]
+module _uring
+class _uring.Ring "RingObject *" "clinic_state()->ring_type"
+class _uring.Operation "OperationObject *" "clinic_state()->operation_type"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=f59b74e1328574bd]*/
+
+#define clinic_state() (get_uring_state(PyType_GetModule(Py_TYPE(self))))
+#include "clinic/_uringmodule.c.h"
+#undef clinic_state
+
+
+static int
+sys_io_uring_setup(unsigned int entries, struct io_uring_params *p)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int
+sys_io_uring_enter(int fd, unsigned int to_submit, unsigned int min_complete,
+                   unsigned int flags, void *arg, size_t argsz)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                        flags, arg, argsz);
+}
+
+static PyObject *
+ring_err_closed(void)
+{
+    PyErr_SetString(PyExc_ValueError, "I/O operation on closed ring");
+    return NULL;
+}
+
+static void
+ring_unmap(RingObject *self)
+{
+    if (self->sqes != NULL) {
+        munmap(self->sqes, self->sqes_size);
+        self->sqes = NULL;
+    }
+    if (self->cq_ring != NULL && self->cq_ring != self->sq_ring) {
+        munmap(self->cq_ring, self->cq_ring_size);
+    }
+    self->cq_ring = NULL;
+    if (self->sq_ring != NULL) {
+        munmap(self->sq_ring, self->sq_ring_size);
+        self->sq_ring = NULL;
+    }
+}
+
+/* Map the queues of the ring set up with *p.  Return -1 with errno set on
+   error. */
+static int
+ring_map(RingObject *self, struct io_uring_params *p)
+{
+    self->sq_ring_size = p->sq_off.array + p->sq_entries * sizeof(uint32_t);
+    self->cq_ring_size = p->cq_off.cqes +
+                         p->cq_entries * sizeof(struct io_uring_cqe);
+    if (p->features & IORING_FEAT_SINGLE_MMAP) {
+        self->sq_ring_size = Py_MAX(self->sq_ring_size, self->cq_ring_size);
+        self->cq_ring_size = self->sq_ring_size;
+    }
+
+    self->sq_ring = mmap(NULL, self->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, self->fd,
+                         IORING_OFF_SQ_RING);
+    if (self->sq_ring == MAP_FAILED) {
+        self->sq_ring = NULL;
+        return -1;
+    }
+    if (p->features & IORING_FEAT_SINGLE_MMAP) {
+        self->cq_ring = self->sq_ring;
+    }
+    else {
+        self->cq_ring = mmap(NULL, self->cq_ring_size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, self->fd,
+                             IORING_OFF_CQ_RING);
+        if (self->cq_ring == MAP_FAILED) {
+            self->cq_ring = NULL;
+            return -1;
+        }
+    }
+    self->sqes_size = p->sq_entries * sizeof(struct io_uring_sqe);
+    self->sqes = mmap(NULL, self->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, self->fd, IORING_OFF_SQES);
+    if (self->sqes == MAP_FAILED) {
+        self->sqes = NULL;
+        return -1;
+    }
+
+    char *sq = self->sq_ring;
+    self->sq_head = (uint32_t *)(sq + p->sq_off.head);
+    self->sq_tail = (uint32_t *)(sq + p->sq_off.tail);
+    self->sq_mask = *(uint32_t *)(sq + p->sq_off.ring_mask);
+    self->sq_entries = *(uint32_t *)(sq + p->sq_off.ring_entries);
+    self->sq_array = (uint32_t *)(sq + p->sq_off.array);
+    self->sqe_tail = *self->sq_tail;
+
+    char *cq = self->cq_ring;
+    self->cq_head = (uint32_t *)(cq + p->cq_off.head);
+    self->cq_tail = (uint32_t *)(cq + p->cq_off.tail);
+    self->cq_mask = *(uint32_t *)(cq + p->cq_off.ring_mask);
+    self->cqes = (struct io_uring_cqe *)(cq + p->cq_off.cqes);
+    return 0;
+}
+
+/* Number of queued requests not yet consumed by the kernel. */
+static inline uint32_t
+ring_sq_pending(RingObject *self)
+{
+    return self->sqe_tail - _Py_atomic_load_uint32_acquire(self->sq_head);
+}
+
+/* Hand the queued requests to the kernel without waiting for completions.
+   Return the number of requests consumed, or -1 with an exception set on
+   error. */
+static int
+ring_submit(RingObject *self)
+{
+    uint32_t to_submit = ring_sq_pending(self);
+    if (to_submit == 0) {
+        return 0;
+    }
+    int ret;
+    Py_BEGIN_ALLOW_THREADS
+    ret = sys_io_uring_enter(self->fd, to_submit, 0, 0, NULL, 0);
+    Py_END_ALLOW_THREADS
+    if (ret < 0) {
+        if (errno == EBUSY || errno == EAGAIN) {
+            /* Completions must be reaped before more requests can be
+               submitted; they are submitted by the next call. */
+            return 0;
+        }
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    return ret;
+}
+
+/* Return a zeroed submission queue entry, handing the queued requests to
+   the kernel first if the queue is full.  Return NULL with an exception set
+   on error. */
+static struct io_uring_sqe *
+ring_get_sqe(RingObject *self)
+{
+    if (ring_sq_pending(self) >= self->sq_entries) {
+        if (ring_submit(self) < 0) {
+            return NULL;
+        }
+        if (ring_sq_pending(self) >= self->sq_entries) {
+            /* The completion queue overflowed: completions must be
+               reaped before more requests can be submitted. */
+            errno = EBUSY;
+            PyErr_SetFromErrno(PyExc_OSError);
+            return NULL;
+        }
+    }
+    uint32_t index = self->sqe_tail & self->sq_mask;
+    struct io_uring_sqe *sqe = &self->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    self->sq_array[index] = index;
+    return sqe;
+}
+
+static inline void
+ring_commit_sqe(RingObject *self)
+{
+    self->sqe_tail++;
+    _Py_atomic_store_uint32_release(self->sq_tail, self->sqe_tail);
+}
+
+static OperationObject *
+operation_new(RingObject *self, int type, int fd)
+{
+    PyTypeObject *tp = get_uring_state(
+        PyType_GetModule(Py_TYPE(self)))->operation_type;
+    OperationObject *op = PyObject_GC_New(OperationObject, tp);
+    if (op == NULL) {
+        return NULL;
+    }
+    op->prev = op->next = NULL;
+    op->ring = NULL;
+    op->type = type;
+    op->pending = 0;
+    op->fd = fd;
+    op->res = 0;
+    op->msg_flags = 0;
+    op->offset = -1;
+    op->done = 0;
+    memset(&op->user_buffer, 0, sizeof(op->user_buffer));
+    op->allocated_buffer = NULL;
+    PyObject_GC_Track(op);
+    return op;
+}
+
+static inline int
+operation_has_user_buffer(OperationObject *op)
+{
+    return (op->type == TYPE_RECV_INTO || op->type == TYPE_READ_INTO ||
+            op->type == TYPE_SEND || op->type == TYPE_WRITE);
+}
+
+static inline int
+operation_has_allocated_buffer(OperationObject *op)
+{
+    return (op->type == TYPE_RECV || op->type == TYPE_READ);
+}
+
+/* Fill in sqe for a read or write of op's buffer. */
+static void
+prep_rw(struct io_uring_sqe *sqe, int opcode, OperationObject *op)
+{
+    sqe->opcode = opcode;
+    sqe->fd = op->fd;
+    sqe->off = (uint64_t)op->offset;
+    sqe->msg_flags = (uint32_t)op->msg_flags;
+    if (operation_has_allocated_buffer(op)) {
+        sqe->addr = (uint64_t)(uintptr_t)PyBytes_AS_STRING(op->allocated_buffer);
+        sqe->len = (uint32_t)PyBytes_GET_SIZE(op->allocated_buffer);
+    }
+    else {
+        sqe->addr = (uint64_t)(uintptr_t)op->user_buffer.buf + op->done;
+        sqe->len = (uint32_t)(op->user_buffer.len - op->done);
+    }
+}
+
+/* Queue the request filled in sqe on behalf of op.  The ring keeps op
+   alive until its completion is reaped. */
+static PyObject *
+ring_submit_operation(RingObject *self, struct io_uring_sqe *sqe,
+                      OperationObject *op)
+{
+    sqe->user_data = (uint64_t)(uintptr_t)op;
+    ring_commit_sqe(self);
+
+    op->pending = 1;
+    op->ring = (RingObject *)Py_NewRef(self);
+    op->prev = NULL;
+    op->next = self->inflight;
+    if (self->inflight != NULL) {
+        self->inflight->prev = op;
+    }
+    self->inflight = op;
+    self->ninflight++;
+    /* Reference owned by the ring */
+    Py_INCREF(op);
+    return (PyObject *)op;
+}
+
+static void
+ring_complete_operation(RingObject *self, OperationObject *op, int32_t res)
+{
+    assert(op->pending);
+    op->pending = 0;
+    op->res = res;
+    if (op->prev != NULL) {
+        op->prev->next = op->next;
+    }
+    else {
+        self->inflight = op->next;
+    }
+    if (op->next != NULL) {
+        op->next->prev = op->prev;
+    }
+    op->prev = op->next = NULL;
+    self->ninflight--;
+    if (operation_has_user_buffer(op) && op->user_buffer.obj != NULL) {
+        PyBuffer_Release(&op->user_buffer);
+    }
+    Py_CLEAR(op->ring);
+}
+
+/* Queue again a send or write which transferred only res bytes, for the
+   rest of its data.  Return -1 if the request cannot be queued. */
+static int
+ring_resubmit_partial(RingObject *self, OperationObject *op, int32_t res)
+{
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        /* Complete the operation with a short count instead. */
+        PyErr_Clear();
+        return -1;
+    }
+    op->done += res;
+    if (op->offset != -1) {
+        op->offset += res;
+    }
+    prep_rw(sqe, op->type == TYPE_SEND ? IORING_OP_SEND : IORING_OP_WRITE, op);
+    sqe->user_data = (uint64_t)(uintptr_t)op;
+    ring_commit_sqe(self);
+    return 0;
+}
+
+/* Reap all posted completions, appending the completed operations to
+   list if it is not NULL.  Return -1 with an exception set if appending
+   failed; the remaining completions are still reaped. */
+static int
+ring_reap(RingObject *self, PyObject *list)
+{
+    int result = 0;
+    uint32_t head = *self->cq_head;
+    uint32_t tail = _Py_atomic_load_uint32_acquire(self->cq_tail);
+
+    for (; head != tail; head++) {
+        struct io_uring_cqe *cqe = &self->cqes[head & self->cq_mask];
+        OperationObject *op = (OperationObject *)(uintptr_t)cqe->user_data;
+        if (op == NULL) {
+            /* Completion of a cancellation request */
+            continue;
+        }
+        int32_t res = cqe->res;
+        if (op->type == TYPE_SEND || op->type == TYPE_WRITE) {
+            if (res > 0 && op->done + res < op->user_buffer.len &&
+                ring_resubmit_partial(self, op, res) == 0)
+            {
+                continue;
+            }
+            if (op->done > 0) {
+                /* Report the data transferred before the error. */
+                res = (int32_t)(op->done + Py_MAX(res, 0));
+            }
+        }
+        ring_complete_operation(self, op, res);
+        if (list != NULL && result == 0 &&
+            PyList_Append(list, (PyObject *)op) < 0)
+        {
+            result = -1;
+        }
+        /* Drop the reference owned by the ring */
+        Py_DECREF(op);
+    }
+    _Py_atomic_store_uint32_release(self->cq_head, head);
+    return result;
+}
+
+/* Ask the kernel to cancel op.  Its completion is still posted. */
+static int
+ring_cancel_operation(RingObject *self, OperationObject *op)
+{
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        return -1;
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)op;
+    sqe->user_data = 0;
+    ring_commit_sqe(self);
+    return 0;
+}
+
+/* Cancel the operations in flight and wait for their completions, so
+   that no buffer is used by the kernel once the ring is closed. */
+static int
+ring_drain(RingObject *self)
+{
+    for (OperationObject *op = self->inflight; op != NULL; op = op->next) {
+        if (ring_cancel_operation(self, op) < 0) {
+            return -1;
+        }
+    }
+    while (self->ninflight > 0) {
+        int ret;
+        Py_BEGIN_ALLOW_THREADS
+        ret = sys_io_uring_enter(self->fd, ring_sq_pending(self), 1,
+                                 IORING_ENTER_GETEVENTS, NULL, 0);
+        Py_END_ALLOW_THREADS
+        if (ret < 0 && errno != EINTR && errno != EBUSY) {
+            PyErr_SetFromErrno(PyExc_OSError);
+            return -1;
+        }
+        (void)ring_reap(self, NULL);
+    }
+    return 0;
+}
+
+static int
+ring_internal_close(RingObject *self)
+{
+    int result = 0;
+    if (self->fd >= 0) {
+        if (self->ninflight > 0 && ring_drain(self) < 0) {
+            result = -1;
+        }
+        ring_unmap(self);
+        if (close(self->fd) < 0 && result == 0) {
+            PyErr_SetFromErrno(PyExc_OSError);
+            result = -1;
+        }
+        self->fd = -1;
+    }
+    return result;
+}
+
+
+/*[clinic input]
+@classmethod
+_uring.Ring.__new__
+
+    entries: unsigned_int(bitwise=False) = 256
+
+Create an io_uring instance whose submission queue holds entries requests.
+
+Raise OSError if io_uring is not available, for example on kernels older
+than Linux 5.11 or when the system call is blocked.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_impl(PyTypeObject *type, unsigned int entries)
+/*[clinic end generated code: output=ec37bfaec3b9f3e6 input=3acfe4d153f41f79]*/
+{
+    if (entries == 0) {
+        PyErr_SetString(PyExc_ValueError, "entries must be positive");
+        return NULL;
+    }
+
+    struct io_uring_params params;
+    int fd;
+    unsigned int flags = URING_SETUP_FLAGS;
+    do {
+        memset(&params, 0, sizeof(params));
+        params.flags = flags;
+        Py_BEGIN_ALLOW_THREADS
+        fd = sys_io_uring_setup(entries, &params);
+        Py_END_ALLOW_THREADS
+        if (fd >= 0 || errno != EINVAL || flags == 0) {
+            break;
+        }
+        /* Retry without the optional flags on older kernels. */
+        flags = 0;
+    } while (1);
+    if (fd < 0) {
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    if ((params.features & URING_REQUIRED_FEATURES) !=
+        URING_REQUIRED_FEATURES)
+    {
+        close(fd);
+        errno = EOPNOTSUPP;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+
+    RingObject *self = (RingObject *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        close(fd);
+        return NULL;
+    }
+    self->fd = fd;
+    self->features = params.features;
+    if (ring_map(self, &params) < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+static void
+Ring_dealloc(PyObject *op)
+{
+    RingObject *self = RingObject_CAST(op);
+    PyTypeObject *tp = Py_TYPE(self);
+    /* In-flight operations own a reference to the ring. */
+    assert(self->ninflight == 0);
+    if (ring_internal_close(self) < 0) {
+        PyErr_FormatUnraisable("Exception ignored while closing %R", op);
+    }
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.close
+
+Cancel the operations in flight, wait for them and close the ring.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_close_impl(RingObject *self)
+/*[clinic end generated code: output=447415269da3419f input=e146810367813652]*/
+{
+    if (ring_internal_close(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.fileno
+
+Return the file descriptor of the ring.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_fileno_impl(RingObject *self)
+/*[clinic end generated code: output=773263c5ad53ca3d input=ececdb4cb6c95cce]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    return PyLong_FromLong(self->fd);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.submit
+
+Submit the queued requests without waiting for completions.
+
+Requests are otherwise submitted by the next call to wait().  Return the
+number of requests submitted.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_submit_impl(RingObject *self)
+/*[clinic end generated code: output=f8036e3d35cb13e9 input=2375b5371f01edf4]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    int ret = ring_submit(self);
+    if (ret < 0) {
+        return NULL;
+    }
+    return PyLong_FromLong(ret);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.wait
+
+    timeout as timeout_obj: object = None
+    /
+
+Submit the queued requests and wait for completions.
+
+Wait at most timeout seconds, or forever if timeout is None, for at least
+one operation to complete.  Return the list of completed operations, which
+is empty on timeout.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_wait_impl(RingObject *self, PyObject *timeout_obj)
+/*[clinic end generated code: output=480a97563d86ffbc input=05c4b8d8bfb6f829]*/
+{
+    PyTime_t timeout = -1, deadline = 0;
+
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    if (timeout_obj != Py_None) {
+        if (_PyTime_FromSecondsObject(&timeout, timeout_obj,
+                                      _PyTime_ROUND_TIMEOUT) < 0) {
+            if (PyErr_ExceptionMatches(PyExc_TypeError)) {
+                PyErr_SetString(PyExc_TypeError,
+                                "timeout must be a number or None");
+            }
+            return NULL;
+        }
+        if (timeout < 0) {
+            timeout = 0;
+        }
+        deadline = _PyDeadline_Init(timeout);
+    }
+
+    do {
+        uint32_t to_submit = ring_sq_pending(self);
+        unsigned int min_complete = 0, flags = 0;
+        struct io_uring_getevents_arg arg;
+        struct __kernel_timespec ts;
+        void *argp = NULL;
+        size_t argsz = 0;
+
+        if (_Py_atomic_load_uint32_acquire(self->cq_tail) == *self->cq_head) {
+            /* Nothing to reap yet: also run pending task work, which posts
+               completions on rings set up with IORING_SETUP_COOP_TASKRUN. */
+            flags = IORING_ENTER_GETEVENTS;
+            if (timeout != 0) {
+                min_complete = 1;
+            }
+            if (timeout > 0) {
+                memset(&arg, 0, sizeof(arg));
+                ts.tv_sec = timeout / NS_PER_SEC;
+                ts.tv_nsec = timeout % NS_PER_SEC;
+                arg.ts = (uint64_t)(uintptr_t)&ts;
+                argp = &arg;
+                argsz = sizeof(arg);
+                flags |= IORING_ENTER_EXT_ARG;
+            }
+        }
+        else if (to_submit == 0) {
+            break;
+        }
+
+        int ret;
+        Py_BEGIN_ALLOW_THREADS
+        ret = sys_io_uring_enter(self->fd, to_submit, min_complete, flags,
+                                 argp, argsz);
+        Py_END_ALLOW_THREADS
+        if (ret >= 0 || errno == ETIME) {
+            break;
+        }
+        if (errno == EBUSY || errno == EAGAIN) {
+            /* Completions must be reaped before more requests can be
+               submitted; they are submitted by the next call. */
+            break;
+        }
+        if (errno != EINTR) {
+            return PyErr_SetFromErrno(PyExc_OSError);
+        }
+
+        /* io_uring_enter() was interrupted by a signal */
+        if (PyErr_CheckSignals()) {
+            return NULL;
+        }
+        if (timeout > 0) {
+            timeout = _PyDeadline_Get(deadline);
+            if (timeout < 0) {
+                timeout = 0;
+            }
+        }
+    } while (1);
+
+    PyObject *list = PyList_New(0);
+    if (list == NULL) {
+        /* Keep the completions for the next call. */
+        return NULL;
+    }
+    if (ring_reap(self, list) < 0) {
+        Py_DECREF(list);
+        return NULL;
+    }
+    return list;
+}
+
+static OperationObject *
+ring_prepare_buffer(RingObject *self, int type, int fd, Py_buffer *buffer)
+{
+    if (buffer->len > INT32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "buffer too large");
+        return NULL;
+    }
+    OperationObject *op = operation_new(self, type, fd);
+    if (op == NULL) {
+        return NULL;
+    }
+    memcpy(&op->user_buffer, buffer, sizeof(Py_buffer));
+    memset(buffer, 0, sizeof(Py_buffer));
+    return op;
+}
+
+static OperationObject *
+ring_prepare_allocated(RingObject *self, int type, int fd, Py_ssize_t size)
+{
+    if (size < 0) {
+        PyErr_SetString(PyExc_ValueError, "negative buffersize");
+        return NULL;
+    }
+    size = Py_MIN(size, INT32_MAX);
+    OperationObject *op = operation_new(self, type, fd);
+    if (op == NULL) {
+        return NULL;
+    }
+    op->allocated_buffer = PyBytes_FromStringAndSize(NULL, size);
+    if (op->allocated_buffer == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    return op;
+}
+
+static PyObject *
+ring_prepare_rw(RingObject *self, OperationObject *op, int opcode,
+                long long offset, int msg_flags)
+{
+    if (op == NULL) {
+        return NULL;
+    }
+    if (self->fd < 0) {
+        Py_DECREF(op);
+        return ring_err_closed();
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    op->offset = offset;
+    op->msg_flags = msg_flags;
+    prep_rw(sqe, opcode, op);
+    return ring_submit_operation(self, sqe, op);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.recv
+
+    fd: int
+    size: Py_ssize_t
+    flags: int = 0
+    /
+
+Queue a recv() of up to size bytes from the socket fd.
+
+The result of the operation is the bytes object received.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_recv_impl(RingObject *self, int fd, Py_ssize_t size, int flags)
+/*[clinic end generated code: output=cbef43e2fa71bec0 input=b623cf789036e60e]*/
+{
+    OperationObject *op = ring_prepare_allocated(self, TYPE_RECV, fd, size);
+    return ring_prepare_rw(self, op, IORING_OP_RECV, 0, flags);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.recv_into
+
+    fd: int
+    buffer: Py_buffer(accept={rwbuffer})
+    flags: int = 0
+    /
+
+Queue a recv() from the socket fd into buffer.
+
+The result of the operation is the number of bytes received.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_recv_into_impl(RingObject *self, int fd, Py_buffer *buffer,
+                           int flags)
+/*[clinic end generated code: output=1ad2535142116400 input=27323f480ecc6140]*/
+{
+    OperationObject *op = ring_prepare_buffer(self, TYPE_RECV_INTO, fd,
+                                              buffer);
+    return ring_prepare_rw(self, op, IORING_OP_RECV, 0, flags);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.send
+
+    fd: int
+    data: Py_buffer
+    flags: int = 0
+    /
+
+Queue a send() of data on the socket fd.
+
+The result of the operation is the number of bytes sent.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_send_impl(RingObject *self, int fd, Py_buffer *data, int flags)
+/*[clinic end generated code: output=15b343a5d9b2604e input=b2708cc8d33ce7c2]*/
+{
+    OperationObject *op = ring_prepare_buffer(self, TYPE_SEND, fd, data);
+    return ring_prepare_rw(self, op, IORING_OP_SEND, 0, flags);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.read
+
+    fd: int
+    size: Py_ssize_t
+    offset: long_long = -1
+    /
+
+Queue a read of up to size bytes from fd at offset.
+
+An offset of -1 reads from the current file position.  The result of the
+operation is the bytes object read.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_read_impl(RingObject *self, int fd, Py_ssize_t size,
+                      long long offset)
+/*[clinic end generated code: output=c840d95f497055bb input=4e29023a719953cc]*/
+{
+    OperationObject *op = ring_prepare_allocated(self, TYPE_READ, fd, size);
+    return ring_prepare_rw(self, op, IORING_OP_READ, offset, 0);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.read_into
+
+    fd: int
+    buffer: Py_buffer(accept={rwbuffer})
+    offset: long_long = -1
+    /
+
+Queue a read from fd at offset into buffer.
+
+An offset of -1 reads from the current file position.  The result of the
+operation is the number of bytes read.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_read_into_impl(RingObject *self, int fd, Py_buffer *buffer,
+                           long long offset)
+/*[clinic end generated code: output=fc9242df8d1988d9 input=1af9036b5fd107c9]*/
+{
+    OperationObject *op = ring_prepare_buffer(self, TYPE_READ_INTO, fd,
+                                              buffer);
+    return ring_prepare_rw(self, op, IORING_OP_READ, offset, 0);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.write
+
+    fd: int
+    data: Py_buffer
+    offset: long_long = -1
+    /
+
+Queue a write of data to fd at offset.
+
+An offset of -1 writes at the current file position.  The result of the
+operation is the number of bytes written.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_write_impl(RingObject *self, int fd, Py_buffer *data,
+                       long long offset)
+/*[clinic end generated code: output=61d8b3d620a6c4da input=fce1f013149561f9]*/
+{
+    OperationObject *op = ring_prepare_buffer(self, TYPE_WRITE, fd, data);
+    return ring_prepare_rw(self, op, IORING_OP_WRITE, offset, 0);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.accept
+
+    fd: int
+    flags: int = 0
+    /
+
+Queue an accept4() on the listening socket fd.
+
+The accepted socket is always close-on-exec.  The result of the operation
+is its file descriptor.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_accept_impl(RingObject *self, int fd, int flags)
+/*[clinic end generated code: output=a3c369f202fa044b input=16adde452d9295d1]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    OperationObject *op = operation_new(self, TYPE_ACCEPT, fd);
+    if (op == NULL) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = fd;
+    sqe->accept_flags = (uint32_t)(flags | SOCK_CLOEXEC);
+    return ring_submit_operation(self, sqe, op);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.poll
+
+    fd: int
+    events: unsigned_short(bitwise=True)
+    /
+
+Queue a one-shot wait for any of the poll events on fd.
+
+The result of the operation is the mask of the events which occurred.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_poll_impl(RingObject *self, int fd, unsigned short events)
+/*[clinic end generated code: output=e7533bc04fea1688 input=b869ee26257035de]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    OperationObject *op = operation_new(self, TYPE_POLL, fd);
+    if (op == NULL) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = events;
+    return ring_submit_operation(self, sqe, op);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.splice
+
+    fd_in: int
+    offset_in: long_long
+    fd_out: int
+    offset_out: long_long
+    size: unsigned_int(bitwise=False)
+    flags: unsigned_int(bitwise=True) = 0
+    /
+
+Queue a splice() of up to size bytes from fd_in to fd_out.
+
+One of the descriptors must refer to a pipe.  An offset of -1 uses the
+current file position, and must be used for the pipe.  The result of the
+operation is the number of bytes moved.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_splice_impl(RingObject *self, int fd_in, long long offset_in,
+                        int fd_out, long long offset_out, unsigned int size,
+                        unsigned int flags)
+/*[clinic end generated code: output=4820d913f2da09cb input=ac541abab5511e29]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    if (size > INT32_MAX) {
+        size = INT32_MAX;
+    }
+    OperationObject *op = operation_new(self, TYPE_SPLICE, fd_out);
+    if (op == NULL) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_SPLICE;
+    sqe->fd = fd_out;
+    sqe->off = (uint64_t)offset_out;
+    sqe->splice_fd_in = fd_in;
+    sqe->splice_off_in = (uint64_t)offset_in;
+    sqe->len = size;
+    sqe->splice_flags = flags;
+    return ring_submit_operation(self, sqe, op);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.cancel
+
+    operation as op: object(subclass_of='clinic_state()->operation_type', type='OperationObject *')
+    /
+
+Ask the kernel to cancel operation if it is still in flight.
+
+The queued requests are submitted right away.  The operation still
+completes, with an ECANCELED error if it was cancelled before it could
+finish.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_cancel_impl(RingObject *self, OperationObject *op)
+/*[clinic end generated code: output=2ace9e9201be0844 input=6afca0d69e93c5d9]*/
+{
+    if (self->fd < 0) {
+        return ring_err_closed();
+    }
+    if (op->ring != self) {
+        if (op->pending) {
+            PyErr_SetString(PyExc_ValueError,
+                            "operation belongs to another ring");
+            return NULL;
+        }
+        Py_RETURN_NONE;
+    }
+    if (ring_cancel_operation(self, op) < 0) {
+        return NULL;
+    }
+    /* Submit now: the caller is likely to close the file descriptor next,
+       and a request still queued would look it up only when submitted. */
+    if (ring_submit(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+Ring_get_closed(PyObject *op, void *Py_UNUSED(closure))
+{
+    return PyBool_FromLong(RingObject_CAST(op)->fd < 0);
+}
+
+static PyObject *
+Ring_get_pending(PyObject *op, void *Py_UNUSED(closure))
+{
+    return PyLong_FromSsize_t(RingObject_CAST(op)->ninflight);
+}
+
+static PyObject *
+Ring_repr(PyObject *op)
+{
+    RingObject *self = RingObject_CAST(op);
+    if (self->fd < 0) {
+        return PyUnicode_FromFormat("<%s closed>", _PyType_Name(Py_TYPE(op)));
+    }
+    return PyUnicode_FromFormat("<%s fd=%d pending=%zd>",
+                                _PyType_Name(Py_TYPE(op)), self->fd,
+                                self->ninflight);
+}
+
+
+/*[clinic input]
+@critical_section
+_uring.Operation.getresult
+
+Return the result of the completed operation.
+
+Raise OSError if the operation failed.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Operation_getresult_impl(OperationObject *self)
+/*[clinic end generated code: output=b8998020ec1f6bd2 input=cc12cdb6f696590a]*/
+{
+    if (self->pending) {
+        PyErr_SetString(PyExc_ValueError, "operation is still pending");
+        return NULL;
+    }
+    if (self->res < 0) {
+        errno = -self->res;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    if (operation_has_allocated_buffer(self)) {
+        assert(self->allocated_buffer != NULL);
+        if (PyBytes_GET_SIZE(self->allocated_buffer) != self->res &&
+            _PyBytes_Resize(&self->allocated_buffer, self->res) < 0)
+        {
+            /* The buffer was freed: report the failure from now on. */
+            self->res = -ENOMEM;
+            return NULL;
+        }
+        return Py_NewRef(self->allocated_buffer);
+    }
+    return PyLong_FromLong(self->res);
+}
+
+static PyObject *
+Operation_get_pending(PyObject *op, void *Py_UNUSED(closure))
+{
+    return PyBool_FromLong(OperationObject_CAST(op)->pending);
+}
+
+static PyObject *
+Operation_get_fd(PyObject *op, void *Py_UNUSED(closure))
+{
+    return PyLong_FromLong(OperationObject_CAST(op)->fd);
+}
+
+static int
+Operation_traverse(PyObject *op, visitproc visit, void *arg)
+{
+    OperationObject *self = OperationObject_CAST(op);
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->ring);
+    if (operation_has_allocated_buffer(self)) {
+        Py_VISIT(self->allocated_buffer);
+    }
+    else if (operation_has_user_buffer(self)) {
+        Py_VISIT(self->user_buffer.obj);
+    }
+    return 0;
+}
+
+static void
+Operation_dealloc(PyObject *op)
+{
+    OperationObject *self = OperationObject_CAST(op);
+    PyTypeObject *tp = Py_TYPE(self);
+    /* The ring owns a reference to the operations in flight. */
+    assert(!self->pending);
+    PyObject_GC_UnTrack(self);
+    if (operation_has_allocated_buffer(self)) {
+        Py_CLEAR(self->allocated_buffer);
+    }
+    else if (operation_has_user_buffer(self) &&
+             self->user_buffer.obj != NULL)
+    {
+        PyBuffer_Release(&self->user_buffer);
+    }
+    Py_CLEAR(self->ring);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static PyObject *
+Operation_repr(PyObject *op)
+{
+    static const char *names[] = {"recv", "recv_into", "send", "read",
+                                  "read_into", "write", "accept", "poll",
+                                  "splice"};
+    OperationObject *self = OperationObject_CAST(op);
+    if (self->pending) {
+        return PyUnicode_FromFormat("<%s %s fd=%d pending>",
+                                    _PyType_Name(Py_TYPE(op)),
+                                    names[self->type], self->fd);
+    }
+    return PyUnicode_FromFormat("<%s %s fd=%d result=%d>",
+                                _PyType_Name(Py_TYPE(op)),
+                                names[self->type], self->fd, (int)self->res);
+}
+
+
+static PyMethodDef Ring_methods[] = {
+    _URING_RING_CLOSE_METHODDEF
+    _URING_RING_FILENO_METHODDEF
+    _URING_RING_SUBMIT_METHODDEF
+    _URING_RING_WAIT_METHODDEF
+    _URING_RING_RECV_METHODDEF
+    _URING_RING_RECV_INTO_METHODDEF
+    _URING_RING_SEND_METHODDEF
+    _URING_RING_READ_METHODDEF
+    _URING_RING_READ_INTO_METHODDEF
+    _URING_RING_WRITE_METHODDEF
+    _URING_RING_ACCEPT_METHODDEF
+    _URING_RING_POLL_METHODDEF
+    _URING_RING_SPLICE_METHODDEF
+    _URING_RING_CANCEL_METHODDEF
+    {NULL, NULL}
+};
+
+static PyGetSetDef Ring_getsets[] = {
+    {"closed", Ring_get_closed, NULL,
+     "True if the ring is closed."},
+    {"pending", Ring_get_pending, NULL,
+     "Number of operations in flight."},
+    {NULL},
+};
+
+static PyType_Slot ring_type_slots[] = {
+    {Py_tp_dealloc, Ring_dealloc},
+    {Py_tp_repr, Ring_repr},
+    {Py_tp_doc, (char *)_uring_Ring__doc__},
+    {Py_tp_methods, Ring_methods},
+    {Py_tp_getset, Ring_getsets},
+    {Py_tp_new, _uring_Ring},
+    {0, 0}
+};
+
+static PyType_Spec ring_type_spec = {
+    .name = "_uring.Ring",
+    .basicsize = sizeof(RingObject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = ring_type_slots
+};
+
+static PyMethodDef Operation_methods[] = {
+    _URING_OPERATION_GETRESULT_METHODDEF
+    {NULL, NULL}
+};
+
+static PyGetSetDef Operation_getsets[] = {
+    {"pending", Operation_get_pending, NULL,
+     "True if the operation has not completed yet."},
+    {"fd", Operation_get_fd, NULL,
+     "File descriptor the operation was submitted for."},
+    {NULL},
+};
+
+static PyType_Slot operation_type_slots[] = {
+    {Py_tp_dealloc, Operation_dealloc},
+    {Py_tp_repr, Operation_repr},
+    {Py_tp_doc, "Operation submitted to a Ring."},
+    {Py_tp_traverse, Operation_traverse},
+    {Py_tp_methods, Operation_methods},
+    {Py_tp_getset, Operation_getsets},
+    {0, 0}
+};
+
+static PyType_Spec operation_type_spec = {
+    .name = "_uring.Operation",
+    .basicsize = sizeof(OperationObject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+              Py_TPFLAGS_IMMUTABLETYPE | Py_TPFLAGS_DISALLOW_INSTANTIATION),
+    .slots = operation_type_slots
+};
+
+
+static int
+uring_exec(PyObject *module)
+{
+    uring_state *state = get_uring_state(module);
+
+    state->ring_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &ring_type_spec, NULL);
+    if (PyModule_AddType(module, state->ring_type) < 0) {
+        return -1;
+    }
+    state->operation_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &operation_type_spec, NULL);
+    if (PyModule_AddType(module, state->operation_type) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static int
+uring_traverse(PyObject *module, visitproc visit, void *arg)
+{
+    uring_state *state = get_uring_state(module);
+    Py_VISIT(state->ring_type);
+    Py_VISIT(state->operation_type);
+    return 0;
+}
+
+static int
+uring_clear(PyObject *module)
+{
+    uring_state *state = get_uring_state(module);
+    Py_CLEAR(state->ring_type);
+    Py_CLEAR(state->operation_type);
+    return 0;
+}
+
+static void
+uring_free(void *module)
+{
+    (void)uring_clear((PyObject *)module);
+}
+
+static PyModuleDef_Slot uring_slots[] = {
+    {Py_mod_exec, uring_exec},
+    {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+    {Py_mod_gil, Py_MOD_GIL_NOT_USED},
+    {0, NULL}
+};
+
+static struct PyModuleDef uring_module = {
+    .m_base = PyModuleDef_HEAD_INIT,
+    .m_name = "_uring",
+    .m_doc = "Support for io_uring based I/O on Linux.",
+    .m_size = sizeof(uring_state),
+    .m_slots = uring_slots,
+    .m_traverse = uring_traverse,
+    .m_clear = uring_clear,
+    .m_free = uring_free,
+};
+
+PyMODINIT_FUNC
+PyInit__uring(void)
+{
+    return PyModuleDef_Init(&uring_module);
+}
@@ -2112,10 +2112,45 @@ array__array_reconstructor_impl(PyObject *module, PyTypeObject *arraytype,
         return NULL;
     }
     if (!PyBytes_Check(items)) {
-        PyErr_Format(PyExc_TypeError,
-            "fourth argument should be bytes, not %.200s",
-            Py_TYPE(items)->tp_name);
-        return NULL;
+        /* Pickles written with a buffer_threshold pass a PickleBuffer or
+           any other out-of-band buffer instead of bytes. */
+        if (!PyObject_CheckBuffer(items)) {
+            PyErr_Format(PyExc_TypeError,
+                "fourth argument should be a bytes-like object, not %.200s",
+                Py_TYPE(items)->tp_name);
+            return NULL;
+        }
+        Py_buffer view;
+        if (PyObject_GetBuffer(items, &view, PyBUF_SIMPLE) < 0) {
+            return NULL;
+        }
+        if (mformat_code == typecode_to_mformat_code((char)typecode) ||
+            mformat_code == UNKNOWN_FORMAT)
+        {
+            /* Copy the data once, straight into the new array. */
+            if (view.len % descr->itemsize != 0) {
+                PyBuffer_Release(&view);
+                PyErr_SetString(PyExc_ValueError,
+                                "bytes length not a multiple of item size");
+                return NULL;
+            }
+            result = newarrayobject(arraytype, view.len / descr->itemsize,
+                                    descr);
+            if (result != NULL && view.len > 0) {
+                memcpy(((arrayobject *)result)->ob_item, view.buf, view.len);
+            }
+            PyBuffer_Release(&view);
+            return result;
+        }
+        PyObject *bytes = PyBytes_FromStringAndSize(view.buf, view.len);
+        PyBuffer_Release(&view);
+        if (bytes == NULL) {
+            return NULL;
+        }
+        result = array__array_reconstructor_impl(module, arraytype, typecode,
+                                                 mformat_code, bytes);
+        Py_DECREF(bytes);
+        return result;
     }
 
     /* Fast path: No decoding has to be done. */
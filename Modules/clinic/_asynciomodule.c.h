@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_critical_section.h"// Py_BEGIN_CRITICAL_SECTION()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
@@ -1537,6 +1538,371 @@ _asyncio_Task_set_name(PyObject *self, PyObject *value)
     return return_value;
 }
 
+PyDoc_STRVAR(stream_buffer_new__doc__,
+"_StreamBuffer()\n"
+"--\n"
+"\n"
+"Buffer of asyncio.StreamReader.");
+
+static PyObject *
+stream_buffer_new_impl(PyTypeObject *type);
+
+static PyObject *
+stream_buffer_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    PyTypeObject *base_tp = get_asyncio_state_by_cls(type)->StreamBufferType;
+
+    if ((type == base_tp || type->tp_init == base_tp->tp_init) &&
+        !_PyArg_NoPositional("_StreamBuffer", args)) {
+        goto exit;
+    }
+    if ((type == base_tp || type->tp_init == base_tp->tp_init) &&
+        !_PyArg_NoKeywords("_StreamBuffer", kwargs)) {
+        goto exit;
+    }
+    return_value = stream_buffer_new_impl(type);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_extend__doc__,
+"extend($self, data, /)\n"
+"--\n"
+"\n"
+"Append data to the end of the buffer.");
+
+#define _ASYNCIO__STREAMBUFFER_EXTEND_METHODDEF    \
+    {"extend", (PyCFunction)_asyncio__StreamBuffer_extend, METH_O, _asyncio__StreamBuffer_extend__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_extend_impl(StreamBufferObj *self, Py_buffer *data);
+
+static PyObject *
+_asyncio__StreamBuffer_extend(PyObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer data = {NULL, NULL};
+
+    if (PyObject_GetBuffer(arg, &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer_extend_impl((StreamBufferObj *)self, &data);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_get_buffer__doc__,
+"get_buffer($self, sizehint, /)\n"
+"--\n"
+"\n"
+"Return a writable memoryview of the free space after the data.\n"
+"\n"
+"Like BufferedProtocol.get_buffer(), the memoryview has at least sizehint\n"
+"bytes, or a default size if sizehint is not positive.  Bytes written to it\n"
+"are added to the buffer by buffer_updated().");
+
+#define _ASYNCIO__STREAMBUFFER_GET_BUFFER_METHODDEF    \
+    {"get_buffer", (PyCFunction)_asyncio__StreamBuffer_get_buffer, METH_O, _asyncio__StreamBuffer_get_buffer__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_get_buffer_impl(StreamBufferObj *self,
+                                       Py_ssize_t sizehint);
+
+static PyObject *
+_asyncio__StreamBuffer_get_buffer(PyObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t sizehint;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        sizehint = ival;
+    }
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer_get_buffer_impl((StreamBufferObj *)self, sizehint);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_buffer_updated__doc__,
+"buffer_updated($self, nbytes, /)\n"
+"--\n"
+"\n"
+"Add the first nbytes bytes of the last get_buffer() result to the buffer.");
+
+#define _ASYNCIO__STREAMBUFFER_BUFFER_UPDATED_METHODDEF    \
+    {"buffer_updated", (PyCFunction)_asyncio__StreamBuffer_buffer_updated, METH_O, _asyncio__StreamBuffer_buffer_updated__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_buffer_updated_impl(StreamBufferObj *self,
+                                           Py_ssize_t nbytes);
+
+static PyObject *
+_asyncio__StreamBuffer_buffer_updated(PyObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t nbytes;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        nbytes = ival;
+    }
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer_buffer_updated_impl((StreamBufferObj *)self, nbytes);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_take__doc__,
+"take($self, n, /)\n"
+"--\n"
+"\n"
+"Remove up to n bytes from the start of the buffer and return them.");
+
+#define _ASYNCIO__STREAMBUFFER_TAKE_METHODDEF    \
+    {"take", (PyCFunction)_asyncio__StreamBuffer_take, METH_O, _asyncio__StreamBuffer_take__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_take_impl(StreamBufferObj *self, Py_ssize_t n);
+
+static PyObject *
+_asyncio__StreamBuffer_take(PyObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t n;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        n = ival;
+    }
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer_take_impl((StreamBufferObj *)self, n);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_clear__doc__,
+"clear($self, /)\n"
+"--\n"
+"\n"
+"Remove all data from the buffer.");
+
+#define _ASYNCIO__STREAMBUFFER_CLEAR_METHODDEF    \
+    {"clear", (PyCFunction)_asyncio__StreamBuffer_clear, METH_NOARGS, _asyncio__StreamBuffer_clear__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_clear_impl(StreamBufferObj *self);
+
+static PyObject *
+_asyncio__StreamBuffer_clear(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer_clear_impl((StreamBufferObj *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_find__doc__,
+"find($self, sub, start=0, /)\n"
+"--\n"
+"\n"
+"Return the lowest index of sub in the data, or -1 if it is not found.");
+
+#define _ASYNCIO__STREAMBUFFER_FIND_METHODDEF    \
+    {"find", _PyCFunction_CAST(_asyncio__StreamBuffer_find), METH_FASTCALL, _asyncio__StreamBuffer_find__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_find_impl(StreamBufferObj *self, Py_buffer *sub,
+                                 Py_ssize_t start);
+
+static PyObject *
+_asyncio__StreamBuffer_find(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer sub = {NULL, NULL};
+    Py_ssize_t start = 0;
+
+    if (!_PyArg_CheckPositional("find", nargs, 1, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &sub, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        start = ival;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer_find_impl((StreamBufferObj *)self, &sub, start);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for sub */
+    if (sub.obj) {
+       PyBuffer_Release(&sub);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_startswith__doc__,
+"startswith($self, prefix, start=0, /)\n"
+"--\n"
+"\n"
+"Return True if the data at start begins with prefix.");
+
+#define _ASYNCIO__STREAMBUFFER_STARTSWITH_METHODDEF    \
+    {"startswith", _PyCFunction_CAST(_asyncio__StreamBuffer_startswith), METH_FASTCALL, _asyncio__StreamBuffer_startswith__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_startswith_impl(StreamBufferObj *self,
+                                       Py_buffer *prefix, Py_ssize_t start);
+
+static PyObject *
+_asyncio__StreamBuffer_startswith(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer prefix = {NULL, NULL};
+    Py_ssize_t start = 0;
+
+    if (!_PyArg_CheckPositional("startswith", nargs, 1, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &prefix, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        start = ival;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer_startswith_impl((StreamBufferObj *)self, &prefix, start);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for prefix */
+    if (prefix.obj) {
+       PyBuffer_Release(&prefix);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer___bytes____doc__,
+"__bytes__($self, /)\n"
+"--\n"
+"\n"
+"Return a copy of the data.");
+
+#define _ASYNCIO__STREAMBUFFER___BYTES___METHODDEF    \
+    {"__bytes__", (PyCFunction)_asyncio__StreamBuffer___bytes__, METH_NOARGS, _asyncio__StreamBuffer___bytes____doc__},
+
+static PyObject *
+_asyncio__StreamBuffer___bytes___impl(StreamBufferObj *self);
+
+static PyObject *
+_asyncio__StreamBuffer___bytes__(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer___bytes___impl((StreamBufferObj *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer___sizeof____doc__,
+"__sizeof__($self, /)\n"
+"--\n"
+"\n"
+"Return the size of the buffer in memory, in bytes.");
+
+#define _ASYNCIO__STREAMBUFFER___SIZEOF___METHODDEF    \
+    {"__sizeof__", (PyCFunction)_asyncio__StreamBuffer___sizeof__, METH_NOARGS, _asyncio__StreamBuffer___sizeof____doc__},
+
+static PyObject *
+_asyncio__StreamBuffer___sizeof___impl(StreamBufferObj *self);
+
+static PyObject *
+_asyncio__StreamBuffer___sizeof__(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _asyncio__StreamBuffer___sizeof___impl((StreamBufferObj *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_asyncio__get_running_loop__doc__,
 "_get_running_loop($module, /)\n"
 "--\n"
@@ -2046,6 +2412,186 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_asyncio__schedule_timer__doc__,
+"_schedule_timer($module, scheduled, timer, /)\n"
+"--\n"
+"\n"
+"Push a TimerHandle onto the heap of scheduled timers.");
+
+#define _ASYNCIO__SCHEDULE_TIMER_METHODDEF    \
+    {"_schedule_timer", _PyCFunction_CAST(_asyncio__schedule_timer), METH_FASTCALL, _asyncio__schedule_timer__doc__},
+
+static PyObject *
+_asyncio__schedule_timer_impl(PyObject *module, PyObject *scheduled,
+                              PyObject *timer);
+
+static PyObject *
+_asyncio__schedule_timer(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *scheduled;
+    PyObject *timer;
+
+    if (!_PyArg_CheckPositional("_schedule_timer", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (!PyList_Check(args[0])) {
+        _PyArg_BadArgument("_schedule_timer", "argument 1", "list", args[0]);
+        goto exit;
+    }
+    scheduled = args[0];
+    timer = args[1];
+    return_value = _asyncio__schedule_timer_impl(module, scheduled, timer);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__pop_cancelled_timers__doc__,
+"_pop_cancelled_timers($module, scheduled, /)\n"
+"--\n"
+"\n"
+"Pop the cancelled timers at the head of the heap.\n"
+"\n"
+"Returns the number of timers removed.");
+
+#define _ASYNCIO__POP_CANCELLED_TIMERS_METHODDEF    \
+    {"_pop_cancelled_timers", (PyCFunction)_asyncio__pop_cancelled_timers, METH_O, _asyncio__pop_cancelled_timers__doc__},
+
+static Py_ssize_t
+_asyncio__pop_cancelled_timers_impl(PyObject *module, PyObject *scheduled);
+
+static PyObject *
+_asyncio__pop_cancelled_timers(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyObject *scheduled;
+    Py_ssize_t _return_value;
+
+    if (!PyList_Check(arg)) {
+        _PyArg_BadArgument("_pop_cancelled_timers", "argument", "list", arg);
+        goto exit;
+    }
+    scheduled = arg;
+    _return_value = _asyncio__pop_cancelled_timers_impl(module, scheduled);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__remove_cancelled_timers__doc__,
+"_remove_cancelled_timers($module, scheduled, /)\n"
+"--\n"
+"\n"
+"Remove all cancelled timers from the heap of scheduled timers.");
+
+#define _ASYNCIO__REMOVE_CANCELLED_TIMERS_METHODDEF    \
+    {"_remove_cancelled_timers", (PyCFunction)_asyncio__remove_cancelled_timers, METH_O, _asyncio__remove_cancelled_timers__doc__},
+
+static PyObject *
+_asyncio__remove_cancelled_timers_impl(PyObject *module, PyObject *scheduled);
+
+static PyObject *
+_asyncio__remove_cancelled_timers(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyObject *scheduled;
+
+    if (!PyList_Check(arg)) {
+        _PyArg_BadArgument("_remove_cancelled_timers", "argument", "list", arg);
+        goto exit;
+    }
+    scheduled = arg;
+    return_value = _asyncio__remove_cancelled_timers_impl(module, scheduled);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__pop_due_timers__doc__,
+"_pop_due_timers($module, scheduled, ready, end_time, /)\n"
+"--\n"
+"\n"
+"Move the timers due before end_time from the heap to the ready queue.");
+
+#define _ASYNCIO__POP_DUE_TIMERS_METHODDEF    \
+    {"_pop_due_timers", _PyCFunction_CAST(_asyncio__pop_due_timers), METH_FASTCALL, _asyncio__pop_due_timers__doc__},
+
+static PyObject *
+_asyncio__pop_due_timers_impl(PyObject *module, PyObject *scheduled,
+                              PyObject *ready, PyObject *end_time);
+
+static PyObject *
+_asyncio__pop_due_timers(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *scheduled;
+    PyObject *ready;
+    PyObject *end_time;
+
+    if (!_PyArg_CheckPositional("_pop_due_timers", nargs, 3, 3)) {
+        goto exit;
+    }
+    if (!PyList_Check(args[0])) {
+        _PyArg_BadArgument("_pop_due_timers", "argument 1", "list", args[0]);
+        goto exit;
+    }
+    scheduled = args[0];
+    ready = args[1];
+    end_time = args[2];
+    return_value = _asyncio__pop_due_timers_impl(module, scheduled, ready, end_time);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__run_ready__doc__,
+"_run_ready($module, ready, ntodo, /)\n"
+"--\n"
+"\n"
+"Pop the first ntodo handles of the ready queue and run them.\n"
+"\n"
+"Cancelled handles are skipped.");
+
+#define _ASYNCIO__RUN_READY_METHODDEF    \
+    {"_run_ready", _PyCFunction_CAST(_asyncio__run_ready), METH_FASTCALL, _asyncio__run_ready__doc__},
+
+static PyObject *
+_asyncio__run_ready_impl(PyObject *module, PyObject *ready, Py_ssize_t ntodo);
+
+static PyObject *
+_asyncio__run_ready(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *ready;
+    Py_ssize_t ntodo;
+
+    if (!_PyArg_CheckPositional("_run_ready", nargs, 2, 2)) {
+        goto exit;
+    }
+    ready = args[0];
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        ntodo = ival;
+    }
+    return_value = _asyncio__run_ready_impl(module, ready, ntodo);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(_asyncio_current_task__doc__,
 "current_task($module, /, loop=None)\n"
 "--\n"
@@ -2232,4 +2778,4 @@ _asyncio_future_discard_from_awaited_by(PyObject *module, PyObject *const *args,
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=b69948ed810591d9 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=a7ca7d5e32c1de84 input=a9049054013a1b77]*/
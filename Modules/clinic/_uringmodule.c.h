@@ -0,0 +1,741 @@
+/*[clinic input]
+preserve
+[clinic start generated code]*/
+
+#if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+#  include "pycore_gc.h"          // PyGC_Head
+#  include "pycore_runtime.h"     // _Py_ID()
+#endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
+#include "pycore_critical_section.h"// Py_BEGIN_CRITICAL_SECTION()
+#include "pycore_long.h"          // _PyLong_UnsignedInt_Converter()
+#include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
+
+PyDoc_STRVAR(_uring_Ring__doc__,
+"Ring(entries=256)\n"
+"--\n"
+"\n"
+"Create an io_uring instance whose submission queue holds entries requests.\n"
+"\n"
+"Raise OSError if io_uring is not available, for example on kernels older\n"
+"than Linux 5.11 or when the system call is blocked.");
+
+static PyObject *
+_uring_Ring_impl(PyTypeObject *type, unsigned int entries);
+
+static PyObject *
+_uring_Ring(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(entries), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"entries", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "Ring",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
+    unsigned int entries = 256;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (!_PyLong_UnsignedInt_Converter(fastargs[0], &entries)) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = _uring_Ring_impl(type, entries);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_close__doc__,
+"close($self, /)\n"
+"--\n"
+"\n"
+"Cancel the operations in flight, wait for them and close the ring.");
+
+#define _URING_RING_CLOSE_METHODDEF    \
+    {"close", (PyCFunction)_uring_Ring_close, METH_NOARGS, _uring_Ring_close__doc__},
+
+static PyObject *
+_uring_Ring_close_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_close(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_close_impl((RingObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_fileno__doc__,
+"fileno($self, /)\n"
+"--\n"
+"\n"
+"Return the file descriptor of the ring.");
+
+#define _URING_RING_FILENO_METHODDEF    \
+    {"fileno", (PyCFunction)_uring_Ring_fileno, METH_NOARGS, _uring_Ring_fileno__doc__},
+
+static PyObject *
+_uring_Ring_fileno_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_fileno(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_fileno_impl((RingObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_submit__doc__,
+"submit($self, /)\n"
+"--\n"
+"\n"
+"Submit the queued requests without waiting for completions.\n"
+"\n"
+"Requests are otherwise submitted by the next call to wait().  Return the\n"
+"number of requests submitted.");
+
+#define _URING_RING_SUBMIT_METHODDEF    \
+    {"submit", (PyCFunction)_uring_Ring_submit, METH_NOARGS, _uring_Ring_submit__doc__},
+
+static PyObject *
+_uring_Ring_submit_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_submit(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_submit_impl((RingObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_wait__doc__,
+"wait($self, timeout=None, /)\n"
+"--\n"
+"\n"
+"Submit the queued requests and wait for completions.\n"
+"\n"
+"Wait at most timeout seconds, or forever if timeout is None, for at least\n"
+"one operation to complete.  Return the list of completed operations, which\n"
+"is empty on timeout.");
+
+#define _URING_RING_WAIT_METHODDEF    \
+    {"wait", _PyCFunction_CAST(_uring_Ring_wait), METH_FASTCALL, _uring_Ring_wait__doc__},
+
+static PyObject *
+_uring_Ring_wait_impl(RingObject *self, PyObject *timeout_obj);
+
+static PyObject *
+_uring_Ring_wait(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *timeout_obj = Py_None;
+
+    if (!_PyArg_CheckPositional("wait", nargs, 0, 1)) {
+        goto exit;
+    }
+    if (nargs < 1) {
+        goto skip_optional;
+    }
+    timeout_obj = args[0];
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_wait_impl((RingObject *)self, timeout_obj);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_recv__doc__,
+"recv($self, fd, size, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a recv() of up to size bytes from the socket fd.\n"
+"\n"
+"The result of the operation is the bytes object received.");
+
+#define _URING_RING_RECV_METHODDEF    \
+    {"recv", _PyCFunction_CAST(_uring_Ring_recv), METH_FASTCALL, _uring_Ring_recv__doc__},
+
+static PyObject *
+_uring_Ring_recv_impl(RingObject *self, int fd, Py_ssize_t size, int flags);
+
+static PyObject *
+_uring_Ring_recv(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_ssize_t size;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recv", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        size = ival;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_recv_impl((RingObject *)self, fd, size, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_recv_into__doc__,
+"recv_into($self, fd, buffer, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a recv() from the socket fd into buffer.\n"
+"\n"
+"The result of the operation is the number of bytes received.");
+
+#define _URING_RING_RECV_INTO_METHODDEF    \
+    {"recv_into", _PyCFunction_CAST(_uring_Ring_recv_into), METH_FASTCALL, _uring_Ring_recv_into__doc__},
+
+static PyObject *
+_uring_Ring_recv_into_impl(RingObject *self, int fd, Py_buffer *buffer,
+                           int flags);
+
+static PyObject *
+_uring_Ring_recv_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer buffer = {NULL, NULL};
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recv_into", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("recv_into", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_recv_into_impl((RingObject *)self, fd, &buffer, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_send__doc__,
+"send($self, fd, data, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a send() of data on the socket fd.\n"
+"\n"
+"The result of the operation is the number of bytes sent.");
+
+#define _URING_RING_SEND_METHODDEF    \
+    {"send", _PyCFunction_CAST(_uring_Ring_send), METH_FASTCALL, _uring_Ring_send__doc__},
+
+static PyObject *
+_uring_Ring_send_impl(RingObject *self, int fd, Py_buffer *data, int flags);
+
+static PyObject *
+_uring_Ring_send(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer data = {NULL, NULL};
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("send", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_send_impl((RingObject *)self, fd, &data, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_read__doc__,
+"read($self, fd, size, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a read of up to size bytes from fd at offset.\n"
+"\n"
+"An offset of -1 reads from the current file position.  The result of the\n"
+"operation is the bytes object read.");
+
+#define _URING_RING_READ_METHODDEF    \
+    {"read", _PyCFunction_CAST(_uring_Ring_read), METH_FASTCALL, _uring_Ring_read__doc__},
+
+static PyObject *
+_uring_Ring_read_impl(RingObject *self, int fd, Py_ssize_t size,
+                      long long offset);
+
+static PyObject *
+_uring_Ring_read(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_ssize_t size;
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("read", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        size = ival;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_read_impl((RingObject *)self, fd, size, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_read_into__doc__,
+"read_into($self, fd, buffer, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a read from fd at offset into buffer.\n"
+"\n"
+"An offset of -1 reads from the current file position.  The result of the\n"
+"operation is the number of bytes read.");
+
+#define _URING_RING_READ_INTO_METHODDEF    \
+    {"read_into", _PyCFunction_CAST(_uring_Ring_read_into), METH_FASTCALL, _uring_Ring_read_into__doc__},
+
+static PyObject *
+_uring_Ring_read_into_impl(RingObject *self, int fd, Py_buffer *buffer,
+                           long long offset);
+
+static PyObject *
+_uring_Ring_read_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer buffer = {NULL, NULL};
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("read_into", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("read_into", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_read_into_impl((RingObject *)self, fd, &buffer, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_write__doc__,
+"write($self, fd, data, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a write of data to fd at offset.\n"
+"\n"
+"An offset of -1 writes at the current file position.  The result of the\n"
+"operation is the number of bytes written.");
+
+#define _URING_RING_WRITE_METHODDEF    \
+    {"write", _PyCFunction_CAST(_uring_Ring_write), METH_FASTCALL, _uring_Ring_write__doc__},
+
+static PyObject *
+_uring_Ring_write_impl(RingObject *self, int fd, Py_buffer *data,
+                       long long offset);
+
+static PyObject *
+_uring_Ring_write(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer data = {NULL, NULL};
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("write", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_write_impl((RingObject *)self, fd, &data, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_accept__doc__,
+"accept($self, fd, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue an accept4() on the listening socket fd.\n"
+"\n"
+"The accepted socket is always close-on-exec.  The result of the operation\n"
+"is its file descriptor.");
+
+#define _URING_RING_ACCEPT_METHODDEF    \
+    {"accept", _PyCFunction_CAST(_uring_Ring_accept), METH_FASTCALL, _uring_Ring_accept__doc__},
+
+static PyObject *
+_uring_Ring_accept_impl(RingObject *self, int fd, int flags);
+
+static PyObject *
+_uring_Ring_accept(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("accept", nargs, 1, 2)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_accept_impl((RingObject *)self, fd, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_poll__doc__,
+"poll($self, fd, events, /)\n"
+"--\n"
+"\n"
+"Queue a one-shot wait for any of the poll events on fd.\n"
+"\n"
+"The result of the operation is the mask of the events which occurred.");
+
+#define _URING_RING_POLL_METHODDEF    \
+    {"poll", _PyCFunction_CAST(_uring_Ring_poll), METH_FASTCALL, _uring_Ring_poll__doc__},
+
+static PyObject *
+_uring_Ring_poll_impl(RingObject *self, int fd, unsigned short events);
+
+static PyObject *
+_uring_Ring_poll(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    unsigned short events;
+
+    if (!_PyArg_CheckPositional("poll", nargs, 2, 2)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    events = (unsigned short)PyLong_AsUnsignedLongMask(args[1]);
+    if (events == (unsigned short)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_poll_impl((RingObject *)self, fd, events);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_splice__doc__,
+"splice($self, fd_in, offset_in, fd_out, offset_out, size, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a splice() of up to size bytes from fd_in to fd_out.\n"
+"\n"
+"One of the descriptors must refer to a pipe.  An offset of -1 uses the\n"
+"current file position, and must be used for the pipe.  The result of the\n"
+"operation is the number of bytes moved.");
+
+#define _URING_RING_SPLICE_METHODDEF    \
+    {"splice", _PyCFunction_CAST(_uring_Ring_splice), METH_FASTCALL, _uring_Ring_splice__doc__},
+
+static PyObject *
+_uring_Ring_splice_impl(RingObject *self, int fd_in, long long offset_in,
+                        int fd_out, long long offset_out, unsigned int size,
+                        unsigned int flags);
+
+static PyObject *
+_uring_Ring_splice(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd_in;
+    long long offset_in;
+    int fd_out;
+    long long offset_out;
+    unsigned int size;
+    unsigned int flags = 0;
+
+    if (!_PyArg_CheckPositional("splice", nargs, 5, 6)) {
+        goto exit;
+    }
+    fd_in = PyLong_AsInt(args[0]);
+    if (fd_in == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    offset_in = PyLong_AsLongLong(args[1]);
+    if (offset_in == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    fd_out = PyLong_AsInt(args[2]);
+    if (fd_out == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    offset_out = PyLong_AsLongLong(args[3]);
+    if (offset_out == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (!_PyLong_UnsignedInt_Converter(args[4], &size)) {
+        goto exit;
+    }
+    if (nargs < 6) {
+        goto skip_optional;
+    }
+    flags = (unsigned int)PyLong_AsUnsignedLongMask(args[5]);
+    if (flags == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_splice_impl((RingObject *)self, fd_in, offset_in, fd_out, offset_out, size, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_cancel__doc__,
+"cancel($self, operation, /)\n"
+"--\n"
+"\n"
+"Ask the kernel to cancel operation if it is still in flight.\n"
+"\n"
+"The queued requests are submitted right away.  The operation still\n"
+"completes, with an ECANCELED error if it was cancelled before it could\n"
+"finish.");
+
+#define _URING_RING_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_uring_Ring_cancel, METH_O, _uring_Ring_cancel__doc__},
+
+static PyObject *
+_uring_Ring_cancel_impl(RingObject *self, OperationObject *op);
+
+static PyObject *
+_uring_Ring_cancel(PyObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    OperationObject *op;
+
+    if (!PyObject_TypeCheck(arg, clinic_state()->operation_type)) {
+        _PyArg_BadArgument("cancel", "argument", (clinic_state()->operation_type)->tp_name, arg);
+        goto exit;
+    }
+    op = (OperationObject *)arg;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_cancel_impl((RingObject *)self, op);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Operation_getresult__doc__,
+"getresult($self, /)\n"
+"--\n"
+"\n"
+"Return the result of the completed operation.\n"
+"\n"
+"Raise OSError if the operation failed.");
+
+#define _URING_OPERATION_GETRESULT_METHODDEF    \
+    {"getresult", (PyCFunction)_uring_Operation_getresult, METH_NOARGS, _uring_Operation_getresult__doc__},
+
+static PyObject *
+_uring_Operation_getresult_impl(OperationObject *self);
+
+static PyObject *
+_uring_Operation_getresult(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Operation_getresult_impl((OperationObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+/*[clinic end generated code: output=b3ccc68c22bfbbfb input=a9049054013a1b77]*/
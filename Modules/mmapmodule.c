@@ -25,6 +25,7 @@
 #include <Python.h>
 #include "pycore_bytesobject.h"   // _PyBytes_Find()
 #include "pycore_fileutils.h"     // _Py_stat_struct
+#include "pycore_memoryobject.h"  // _PyMemoryView_GetSlice()
 
 #include <stddef.h>               // offsetof()
 #ifndef MS_WINDOWS
@@ -1184,6 +1185,148 @@ mmap_madvise_method(PyObject *op, PyObject *args)
 }
 #endif // HAVE_MADVISE
 
+typedef struct {
+    PyTypeObject *mmap_lines_type;
+} mmap_state;
+
+static struct PyModuleDef mmapmodule;
+
+static inline mmap_state *
+get_mmap_state(PyObject *module)
+{
+    void *state = PyModule_GetState(module);
+    assert(state != NULL);
+    return (mmap_state *)state;
+}
+
+/* Iterator over the lines of a mapping.  It keeps a memoryview of the whole
+   mapping and yields slices of it, so no data is copied. */
+typedef struct {
+    PyObject_HEAD
+    PyObject *view;     /* NULL once exhausted */
+    Py_ssize_t pos;
+    Py_ssize_t end;
+} mmap_lines_object;
+
+#define mmap_lines_object_CAST(op)  ((mmap_lines_object *)(op))
+
+static int
+mmap_lines_traverse(PyObject *op, visitproc visit, void *arg)
+{
+    mmap_lines_object *it = mmap_lines_object_CAST(op);
+    Py_VISIT(Py_TYPE(it));
+    Py_VISIT(it->view);
+    return 0;
+}
+
+static int
+mmap_lines_clear(PyObject *op)
+{
+    mmap_lines_object *it = mmap_lines_object_CAST(op);
+    Py_CLEAR(it->view);
+    return 0;
+}
+
+static void
+mmap_lines_dealloc(PyObject *op)
+{
+    PyTypeObject *tp = Py_TYPE(op);
+    PyObject_GC_UnTrack(op);
+    (void)mmap_lines_clear(op);
+    tp->tp_free(op);
+    Py_DECREF(tp);
+}
+
+static PyObject *
+mmap_lines_next(PyObject *op)
+{
+    mmap_lines_object *it = mmap_lines_object_CAST(op);
+    if (it->view == NULL) {
+        return NULL;
+    }
+    if (it->pos >= it->end) {
+        /* Release the mapping as soon as possible. */
+        Py_CLEAR(it->view);
+        return NULL;
+    }
+    char *data = PyMemoryView_GET_BUFFER(it->view)->buf;
+    char *start = data + it->pos;
+    char *eol;
+    if (safe_memchr(&eol, start, '\n', it->end - it->pos) < 0) {
+        return NULL;
+    }
+    Py_ssize_t next = eol ? eol - data + 1 : it->end;
+    PyObject *line = _PyMemoryView_GetSlice(it->view, it->pos, next);
+    if (line != NULL) {
+        it->pos = next;
+    }
+    return line;
+}
+
+static PyType_Slot mmap_lines_slots[] = {
+    {Py_tp_dealloc, mmap_lines_dealloc},
+    {Py_tp_traverse, mmap_lines_traverse},
+    {Py_tp_clear, mmap_lines_clear},
+    {Py_tp_iter, PyObject_SelfIter},
+    {Py_tp_iternext, mmap_lines_next},
+    {0, NULL},
+};
+
+static PyType_Spec mmap_lines_spec = {
+    .name = "mmap.mmap_lines_iterator",
+    .basicsize = sizeof(mmap_lines_object),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+              Py_TPFLAGS_IMMUTABLETYPE | Py_TPFLAGS_DISALLOW_INSTANTIATION),
+    .slots = mmap_lines_slots,
+};
+
+static PyObject *
+mmap_iterlines_method(PyObject *op, PyObject *args)
+{
+    mmap_object *self = mmap_object_CAST(op);
+    Py_ssize_t start = 0;
+    Py_ssize_t end = PY_SSIZE_T_MAX;
+
+    CHECK_VALID(NULL);
+    if (!PyArg_ParseTuple(args, "|nn:iterlines", &start, &end)) {
+        return NULL;
+    }
+    CHECK_VALID(NULL);
+    if (start < 0)
+        start += self->size;
+    if (start < 0)
+        start = 0;
+    else if (start > self->size)
+        start = self->size;
+
+    if (end < 0)
+        end += self->size;
+    if (end < 0)
+        end = 0;
+    else if (end > self->size)
+        end = self->size;
+
+    PyObject *module = PyType_GetModuleByDef(Py_TYPE(self), &mmapmodule);
+    if (module == NULL) {
+        return NULL;
+    }
+    mmap_state *state = get_mmap_state(module);
+    mmap_lines_object *it = PyObject_GC_New(mmap_lines_object,
+                                            state->mmap_lines_type);
+    if (it == NULL) {
+        return NULL;
+    }
+    it->pos = start;
+    it->end = end;
+    it->view = PyMemoryView_FromObject(op);
+    if (it->view == NULL) {
+        Py_DECREF(it);
+        return NULL;
+    }
+    PyObject_GC_Track(it);
+    return (PyObject *)it;
+}
+
 static struct PyMemberDef mmap_object_members[] = {
     {"__weaklistoffset__", Py_T_PYSSIZET, offsetof(mmap_object, weakreflist), Py_READONLY},
     {NULL},
@@ -1194,6 +1337,7 @@ static struct PyMethodDef mmap_object_methods[] = {
     {"find",            mmap_find_method,         METH_VARARGS},
     {"rfind",           mmap_rfind_method,        METH_VARARGS},
     {"flush",           mmap_flush_method,        METH_VARARGS},
+    {"iterlines",       mmap_iterlines_method,    METH_VARARGS},
 #ifdef HAVE_MADVISE
     {"madvise",         mmap_madvise_method,      METH_VARARGS},
 #endif
@@ -1915,6 +2059,13 @@ mmap_exec(PyObject *module)
         return -1;
     }
 
+    mmap_state *state = get_mmap_state(module);
+    state->mmap_lines_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &mmap_lines_spec, NULL);
+    if (state->mmap_lines_type == NULL) {
+        return -1;
+    }
+
     PyObject *mmap_object_type = PyType_FromModuleAndSpec(module,
                                                   &mmap_object_spec, NULL);
     if (mmap_object_type == NULL) {
@@ -2112,11 +2263,36 @@ static PyModuleDef_Slot mmap_slots[] = {
     {0, NULL}
 };
 
+static int
+mmap_traverse(PyObject *module, visitproc visit, void *arg)
+{
+    mmap_state *state = get_mmap_state(module);
+    Py_VISIT(state->mmap_lines_type);
+    return 0;
+}
+
+static int
+mmap_clear(PyObject *module)
+{
+    mmap_state *state = get_mmap_state(module);
+    Py_CLEAR(state->mmap_lines_type);
+    return 0;
+}
+
+static void
+mmap_free(void *module)
+{
+    (void)mmap_clear((PyObject *)module);
+}
+
 static struct PyModuleDef mmapmodule = {
     .m_base = PyModuleDef_HEAD_INIT,
     .m_name = "mmap",
-    .m_size = 0,
+    .m_size = sizeof(mmap_state),
     .m_slots = mmap_slots,
+    .m_traverse = mmap_traverse,
+    .m_clear = mmap_clear,
+    .m_free = mmap_free,
 };
 
 PyMODINIT_FUNC
@@ -1558,33 +1558,26 @@ select_epoll_unregister_impl(pyEpoll_Object *self, int fd)
     return pyepoll_internal_ctl(self->epfd, EPOLL_CTL_DEL, fd, 0);
 }
 
-/*[clinic input]
-select.epoll.poll
-
-    timeout as timeout_obj: object = None
-      the maximum time to wait in seconds (as float);
-      a timeout of None or -1 makes poll wait indefinitely
-    maxevents: int = -1
-      the maximum number of events returned; -1 means no limit
-
-Wait for events on the epoll file descriptor.
-
-Returns a list containing any descriptors that have events to report,
-as a list of (fd, events) 2-tuples.
-[clinic start generated code]*/
+/* Number of events which select.epoll.poll() and poll_mapped() can
+   receive without allocating a buffer */
+#define EPOLL_SMALL_EVENTS 64
 
-static PyObject *
-select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
-                       int maxevents)
-/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+/* Wait for events on the epoll object.  Return the number of events stored
+   in *pevs, or -1 on error.  *pevs is set to small_evs if maxevents is
+   small enough, or to a new buffer which must be freed with PyMem_Free(). */
+static int
+pyepoll_wait(pyEpoll_Object *self, PyObject *timeout_obj, int maxevents,
+             struct epoll_event *small_evs, struct epoll_event **pevs)
 {
-    int nfds, i;
-    PyObject *elist = NULL, *etuple = NULL;
-    struct epoll_event *evs = NULL;
+    int nfds;
+    struct epoll_event *evs;
     PyTime_t timeout = -1, ms = -1, deadline = 0;
 
-    if (self->epfd < 0)
-        return pyepoll_err_closed();
+    *pevs = small_evs;
+    if (self->epfd < 0) {
+        pyepoll_err_closed();
+        return -1;
+    }
 
     if (timeout_obj != Py_None) {
         /* epoll_wait() has a resolution of 1 millisecond, round towards
@@ -1595,13 +1588,13 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
                 PyErr_SetString(PyExc_TypeError,
                                 "timeout must be an integer or None");
             }
-            return NULL;
+            return -1;
         }
 
         ms = _PyTime_AsMilliseconds(timeout, _PyTime_ROUND_CEILING);
         if (ms < INT_MIN || ms > INT_MAX) {
             PyErr_SetString(PyExc_OverflowError, "timeout is too large");
-            return NULL;
+            return -1;
         }
         /* epoll_wait(2) treats all arbitrary negative numbers the same
            for the timeout argument, but -1 is the documented way to block
@@ -1626,13 +1619,19 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
         PyErr_Format(PyExc_ValueError,
                      "maxevents must be greater than 0, got %d",
                      maxevents);
-        return NULL;
+        return -1;
     }
 
-    evs = PyMem_New(struct epoll_event, maxevents);
-    if (evs == NULL) {
-        PyErr_NoMemory();
-        return NULL;
+    if (maxevents <= EPOLL_SMALL_EVENTS) {
+        evs = small_evs;
+    }
+    else {
+        evs = PyMem_New(struct epoll_event, maxevents);
+        if (evs == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        *pevs = evs;
     }
 
     do {
@@ -1646,7 +1645,7 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
         /* poll() was interrupted by a signal */
         if (PyErr_CheckSignals())
-            goto error;
+            return -1;
 
         if (timeout >= 0) {
             timeout = _PyDeadline_Get(deadline);
@@ -1661,6 +1660,38 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
     if (nfds < 0) {
         PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    return nfds;
+}
+
+/*[clinic input]
+select.epoll.poll
+
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+    maxevents: int = -1
+      the maximum number of events returned; -1 means no limit
+
+Wait for events on the epoll file descriptor.
+
+Returns a list containing any descriptors that have events to report,
+as a list of (fd, events) 2-tuples.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
+                       int maxevents)
+/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+{
+    int nfds, i;
+    PyObject *elist = NULL, *etuple = NULL;
+    struct epoll_event small_evs[EPOLL_SMALL_EVENTS];
+    struct epoll_event *evs;
+
+    nfds = pyepoll_wait(self, timeout_obj, maxevents, small_evs, &evs);
+    if (nfds < 0) {
         goto error;
     }
 
@@ -1679,10 +1710,91 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
     }
 
     error:
-    PyMem_Free(evs);
+    if (evs != small_evs) {
+        PyMem_Free(evs);
+    }
     return elist;
 }
 
+/*[clinic input]
+select.epoll.poll_mapped
+
+    mapping: object
+      a mapping of file descriptors to objects
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+    maxevents: int = -1
+      the maximum number of events returned; -1 means no limit
+
+Wait for events on the epoll file descriptor and map them to objects.
+
+Like poll(), but returns a list of (mapping[fd], events) 2-tuples.
+Events of descriptors which are not in the mapping are skipped.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_mapped_impl(pyEpoll_Object *self, PyObject *mapping,
+                              PyObject *timeout_obj, int maxevents)
+/*[clinic end generated code: output=52f0989afd6b265a input=9587777136bd9981]*/
+{
+    int nfds, i;
+    PyObject *elist = NULL;
+    struct epoll_event small_evs[EPOLL_SMALL_EVENTS];
+    struct epoll_event *evs;
+
+    nfds = pyepoll_wait(self, timeout_obj, maxevents, small_evs, &evs);
+    if (nfds < 0) {
+        goto done;
+    }
+
+    elist = PyList_New(0);
+    if (elist == NULL) {
+        goto done;
+    }
+
+    for (i = 0; i < nfds; i++) {
+        PyObject *fd = PyLong_FromLong(evs[i].data.fd);
+        if (fd == NULL) {
+            goto error_list;
+        }
+        PyObject *obj;
+        int found;
+        if (PyDict_CheckExact(mapping)) {
+            found = PyDict_GetItemRef(mapping, fd, &obj);
+        }
+        else {
+            found = PyMapping_GetOptionalItem(mapping, fd, &obj);
+        }
+        Py_DECREF(fd);
+        if (found < 0) {
+            goto error_list;
+        }
+        if (found == 0) {
+            continue;
+        }
+        PyObject *etuple = Py_BuildValue("NI", obj, evs[i].events);
+        if (etuple == NULL) {
+            goto error_list;
+        }
+        int res = PyList_Append(elist, etuple);
+        Py_DECREF(etuple);
+        if (res < 0) {
+            goto error_list;
+        }
+    }
+
+    done:
+    if (evs != small_evs) {
+        PyMem_Free(evs);
+    }
+    return elist;
+
+    error_list:
+    Py_CLEAR(elist);
+    goto done;
+}
+
 
 /*[clinic input]
 select.epoll.__enter__
@@ -2510,6 +2622,7 @@ static PyMethodDef pyepoll_methods[] = {
     SELECT_EPOLL_REGISTER_METHODDEF
     SELECT_EPOLL_UNREGISTER_METHODDEF
     SELECT_EPOLL_POLL_METHODDEF
+    SELECT_EPOLL_POLL_MAPPED_METHODDEF
     SELECT_EPOLL___ENTER___METHODDEF
     SELECT_EPOLL___EXIT___METHODDEF
     {NULL,      NULL},
@@ -259,6 +259,15 @@ shutdown(how) -- shut down traffic in one or both directions\n\
 #include <net/ethernet.h>
 #endif
 
+#ifdef __linux__
+#include <netinet/udp.h>          // UDP_SEGMENT, UDP_GRO
+#endif
+
+#if defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY) && defined(HAVE_LINUX_ERRQUEUE_H)
+#include <linux/errqueue.h>       // struct sock_extended_err
+#define HAVE_SEND_ZEROCOPY 1
+#endif
+
 /* Generic socket object definitions and includes */
 #define PySocket_BUILDING_SOCKET
 #include "socketmodule.h"
@@ -3549,6 +3558,12 @@ sockets the address is a tuple (ifname, proto [,pkttype [,hatype [,addr]]])");
    Set the file descriptor to -1 so operations tried subsequently
    will surely fail. */
 
+#ifdef HAVE_SEND_ZEROCOPY
+static Py_ssize_t sock_zerocopy_pending(PySocketSockObject *s);
+static Py_ssize_t sock_zerocopy_drain(PySocketSockObject *s);
+static void sock_zerocopy_clear(PySocketSockObject *s);
+#endif
+
 /*[clinic input]
 _socket.socket.close
     self as s: self(type="PySocketSockObject *")
@@ -3565,6 +3580,13 @@ _socket_socket_close_impl(PySocketSockObject *s)
     SOCKET_T fd;
     int res;
 
+#ifdef HAVE_SEND_ZEROCOPY
+    /* Release the buffers of the sends which are already complete.  The
+       kernel may still be reading from the others. */
+    if (sock_zerocopy_pending(s) > 0 && sock_zerocopy_drain(s) < 0) {
+        PyErr_Clear();
+    }
+#endif
     fd = get_sock_fd(s);
     if (fd != INVALID_SOCKET) {
         set_sock_fd(s, INVALID_SOCKET);
@@ -3582,6 +3604,9 @@ _socket_socket_close_impl(PySocketSockObject *s)
             return s->errorhandler();
         }
     }
+#ifdef HAVE_SEND_ZEROCOPY
+    sock_zerocopy_clear(s);
+#endif
     Py_RETURN_NONE;
 }
 
@@ -4248,6 +4273,91 @@ Like recv_into(buffer[, nbytes[, flags]]) but also return the sender's address i
 /* The sendmsg() and recvmsg[_into]() methods require a working
    CMSG_LEN().  See the comment near get_CMSG_LEN(). */
 #ifdef CMSG_LEN
+/* Make a list of (level, type, data) tuples from the control messages
+   received in msg.  Returns NULL with an exception set on error. */
+static PyObject *
+make_cmsg_list(struct msghdr *msg)
+{
+    PyObject *cmsg_list;
+    struct cmsghdr *cmsgh;
+    size_t cmsgdatalen = 0;
+    int cmsg_status;
+
+    if ((cmsg_list = PyList_New(0)) == NULL)
+        return NULL;
+    /* Check for empty ancillary data as old CMSG_FIRSTHDR()
+       implementations didn't do so. */
+    for (cmsgh = ((msg->msg_controllen > 0) ? CMSG_FIRSTHDR(msg) : NULL);
+         cmsgh != NULL; cmsgh = CMSG_NXTHDR(msg, cmsgh)) {
+        PyObject *bytes, *tuple;
+        int tmp;
+
+        cmsg_status = get_cmsg_data_len(msg, cmsgh, &cmsgdatalen);
+        if (cmsg_status != 0) {
+            if (PyErr_WarnEx(PyExc_RuntimeWarning,
+                             "received malformed or improperly-truncated "
+                             "ancillary data", 1) == -1)
+                goto error;
+        }
+        if (cmsg_status < 0)
+            break;
+        if (cmsgdatalen > PY_SSIZE_T_MAX) {
+            PyErr_SetString(PyExc_OSError, "control message too long");
+            goto error;
+        }
+
+        bytes = PyBytes_FromStringAndSize((char *)CMSG_DATA(cmsgh),
+                                          cmsgdatalen);
+        tuple = Py_BuildValue("iiN", (int)cmsgh->cmsg_level,
+                              (int)cmsgh->cmsg_type, bytes);
+        if (tuple == NULL)
+            goto error;
+        tmp = PyList_Append(cmsg_list, tuple);
+        Py_DECREF(tuple);
+        if (tmp != 0)
+            goto error;
+
+        if (cmsg_status != 0)
+            break;
+    }
+    return cmsg_list;
+
+error:
+    Py_DECREF(cmsg_list);
+    return NULL;
+}
+
+/* Close all descriptors received in msg via SCM_RIGHTS, so they don't
+   leak when the received data cannot be returned. */
+static void
+close_cmsg_fds(struct msghdr *msg)
+{
+#ifdef SCM_RIGHTS
+    struct cmsghdr *cmsgh;
+    size_t cmsgdatalen = 0;
+    int cmsg_status;
+
+    for (cmsgh = ((msg->msg_controllen > 0) ? CMSG_FIRSTHDR(msg) : NULL);
+         cmsgh != NULL; cmsgh = CMSG_NXTHDR(msg, cmsgh)) {
+        cmsg_status = get_cmsg_data_len(msg, cmsgh, &cmsgdatalen);
+        if (cmsg_status < 0)
+            break;
+        if (cmsgh->cmsg_level == SOL_SOCKET &&
+            cmsgh->cmsg_type == SCM_RIGHTS) {
+            size_t numfds;
+            int *fdp;
+
+            numfds = cmsgdatalen / sizeof(int);
+            fdp = (int *)CMSG_DATA(cmsgh);
+            while (numfds-- > 0)
+                close(*fdp++);
+        }
+        if (cmsg_status != 0)
+            break;
+    }
+#endif /* SCM_RIGHTS */
+}
+
 struct sock_recvmsg {
     struct msghdr *msg;
     int flags;
@@ -4283,9 +4393,6 @@ sock_recvmsg_guts(PySocketSockObject *s, struct iovec *iov, int iovlen,
     struct msghdr msg = {0};
     PyObject *cmsg_list = NULL, *retval = NULL;
     void *controlbuf = NULL;
-    struct cmsghdr *cmsgh;
-    size_t cmsgdatalen = 0;
-    int cmsg_status;
     struct sock_recvmsg ctx;
 
     /* XXX: POSIX says that msg_name and msg_namelen "shall be
@@ -4326,43 +4433,8 @@ sock_recvmsg_guts(PySocketSockObject *s, struct iovec *iov, int iovlen,
         goto finally;
 
     /* Make list of (level, type, data) tuples from control messages. */
-    if ((cmsg_list = PyList_New(0)) == NULL)
+    if ((cmsg_list = make_cmsg_list(&msg)) == NULL)
         goto err_closefds;
-    /* Check for empty ancillary data as old CMSG_FIRSTHDR()
-       implementations didn't do so. */
-    for (cmsgh = ((msg.msg_controllen > 0) ? CMSG_FIRSTHDR(&msg) : NULL);
-         cmsgh != NULL; cmsgh = CMSG_NXTHDR(&msg, cmsgh)) {
-        PyObject *bytes, *tuple;
-        int tmp;
-
-        cmsg_status = get_cmsg_data_len(&msg, cmsgh, &cmsgdatalen);
-        if (cmsg_status != 0) {
-            if (PyErr_WarnEx(PyExc_RuntimeWarning,
-                             "received malformed or improperly-truncated "
-                             "ancillary data", 1) == -1)
-                goto err_closefds;
-        }
-        if (cmsg_status < 0)
-            break;
-        if (cmsgdatalen > PY_SSIZE_T_MAX) {
-            PyErr_SetString(PyExc_OSError, "control message too long");
-            goto err_closefds;
-        }
-
-        bytes = PyBytes_FromStringAndSize((char *)CMSG_DATA(cmsgh),
-                                          cmsgdatalen);
-        tuple = Py_BuildValue("iiN", (int)cmsgh->cmsg_level,
-                              (int)cmsgh->cmsg_type, bytes);
-        if (tuple == NULL)
-            goto err_closefds;
-        tmp = PyList_Append(cmsg_list, tuple);
-        Py_DECREF(tuple);
-        if (tmp != 0)
-            goto err_closefds;
-
-        if (cmsg_status != 0)
-            break;
-    }
 
     retval = Py_BuildValue("NOiN",
                            (*makeval)(ctx.result, makeval_data),
@@ -4381,27 +4453,7 @@ sock_recvmsg_guts(PySocketSockObject *s, struct iovec *iov, int iovlen,
     return retval;
 
 err_closefds:
-#ifdef SCM_RIGHTS
-    /* Close all descriptors coming from SCM_RIGHTS, so they don't leak. */
-    for (cmsgh = ((msg.msg_controllen > 0) ? CMSG_FIRSTHDR(&msg) : NULL);
-         cmsgh != NULL; cmsgh = CMSG_NXTHDR(&msg, cmsgh)) {
-        cmsg_status = get_cmsg_data_len(&msg, cmsgh, &cmsgdatalen);
-        if (cmsg_status < 0)
-            break;
-        if (cmsgh->cmsg_level == SOL_SOCKET &&
-            cmsgh->cmsg_type == SCM_RIGHTS) {
-            size_t numfds;
-            int *fdp;
-
-            numfds = cmsgdatalen / sizeof(int);
-            fdp = (int *)CMSG_DATA(cmsgh);
-            while (numfds-- > 0)
-                close(*fdp++);
-        }
-        if (cmsg_status != 0)
-            break;
-    }
-#endif /* SCM_RIGHTS */
+    close_cmsg_fds(&msg);
     goto finally;
 }
 
@@ -4573,6 +4625,190 @@ its value is unspecified.\n\
 If recvmsg_into() raises an exception after the system call returns,\n\
 it will first attempt to close any file descriptors received via the\n\
 SCM_RIGHTS mechanism.");
+
+#ifdef HAVE_RECVMMSG
+struct sock_recvmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_recvmmsg *ctx = data;
+
+    ctx->result = recvmmsg(get_sock_fd(s), ctx->msgvec, ctx->vlen,
+                           ctx->flags, NULL);
+    return (ctx->result >= 0);
+}
+
+/* s.recvmmsg_into(buffers[, ancbufsize[, flags]]) method */
+
+static PyObject *
+sock_recvmmsg_into(PyObject *self, PyObject *args)
+{
+    PySocketSockObject *s = _PySocketSockObject_CAST(self);
+
+    Py_ssize_t ancbufsize = 0, ancstride;
+    int flags = 0;
+    Py_ssize_t i, nitems, nbufs = 0, nreceived = 0;
+    Py_buffer *bufs = NULL;
+    struct iovec *iovs = NULL;
+    struct mmsghdr *msgvec = NULL;
+    sock_addr_t *addrbufs = NULL;
+    socklen_t addrbuflen;
+    char *controlbuf = NULL;
+    PyObject *buffers_arg, *fast, *list = NULL, *retval = NULL;
+    struct sock_recvmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|ni:recvmmsg_into",
+                          &buffers_arg, &ancbufsize, &flags))
+        return NULL;
+
+    if (!getsockaddrlen(s, &addrbuflen))
+        return NULL;
+    if (ancbufsize < 0 || ancbufsize > SOCKLEN_T_LIMIT) {
+        PyErr_SetString(PyExc_ValueError,
+                        "invalid ancillary data buffer length");
+        return NULL;
+    }
+    /* Every message gets its own ancillary data buffer; keep them
+       aligned for struct cmsghdr. */
+    ancstride = (Py_ssize_t)_Py_SIZE_ROUND_UP(ancbufsize, SIZEOF_SIZE_T);
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "recvmmsg_into() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError,
+                        "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyList_New(0);
+        goto finally;
+    }
+    if (ancstride > 0 && nitems > PY_SSIZE_T_MAX / ancstride) {
+        PyErr_SetString(PyExc_OSError, "too much ancillary data");
+        goto finally;
+    }
+
+    /* Set up a message header with a single iovec for each item, and
+       save the Py_buffer structs to release afterwards. */
+    if ((iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL ||
+        (msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (addrbufs = PyMem_New(sock_addr_t, nitems)) == NULL ||
+        (ancstride > 0 &&
+         (controlbuf = PyMem_Malloc(nitems * ancstride)) == NULL))
+    {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        struct msghdr *msg = &msgvec[nbufs].msg_hdr;
+
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+
+        /* See the comment in sock_recvmsg_guts() about msg_name. */
+        memset(&addrbufs[nbufs], 0, addrbuflen);
+        SAS2SA(&addrbufs[nbufs])->sa_family = AF_UNSPEC;
+        msg->msg_name = SAS2SA(&addrbufs[nbufs]);
+        msg->msg_namelen = addrbuflen;
+        msg->msg_iov = &iovs[nbufs];
+        msg->msg_iovlen = 1;
+        if (ancstride > 0) {
+            msg->msg_control = controlbuf + nbufs * ancstride;
+            msg->msg_controllen = ancbufsize;
+        }
+    }
+
+    /* Make the system call. */
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    /* Only wait for the first message; return whatever else is queued
+       without blocking again. */
+    ctx.flags = flags | MSG_WAITFORONE;
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+    nreceived = ctx.result;
+
+    if ((list = PyList_New(nreceived)) == NULL)
+        goto err_closefds;
+    for (i = 0; i < nreceived; i++) {
+        struct msghdr *msg = &msgvec[i].msg_hdr;
+        PyObject *cmsg_list, *item;
+
+        if ((cmsg_list = make_cmsg_list(msg)) == NULL)
+            goto err_closefds;
+        item = Py_BuildValue("nOiN",
+                             (Py_ssize_t)msgvec[i].msg_len,
+                             cmsg_list,
+                             (int)msg->msg_flags,
+                             makesockaddr(get_sock_fd(s), msg->msg_name,
+                                          ((msg->msg_namelen > addrbuflen) ?
+                                           addrbuflen : msg->msg_namelen),
+                                          s->sock_proto));
+        Py_DECREF(cmsg_list);
+        if (item == NULL)
+            goto err_closefds;
+        PyList_SET_ITEM(list, i, item);
+    }
+    retval = Py_NewRef(list);
+
+finally:
+    Py_XDECREF(list);
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(controlbuf);
+    PyMem_Free(addrbufs);
+    PyMem_Free(msgvec);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    Py_DECREF(fast);
+    return retval;
+
+err_closefds:
+    for (i = 0; i < nreceived; i++)
+        close_cmsg_fds(&msgvec[i].msg_hdr);
+    goto finally;
+}
+
+PyDoc_STRVAR(recvmmsg_into_doc,
+"recvmmsg_into(buffers[, ancbufsize[, flags]]) -> list of (nbytes, ancdata, msg_flags, address)\n\
+\n\
+Receive several messages from the socket with a single system call.\n\
+The buffers argument must be an iterable of objects that export\n\
+writable buffers (e.g. bytearray objects); each message is received\n\
+into the next buffer.  The call waits only for the first message,\n\
+then returns the messages which are already queued, up to the number\n\
+of buffers.  The ancbufsize and flags arguments have the same meaning\n\
+as for recvmsg_into(); each message gets an ancillary data buffer of\n\
+ancbufsize bytes.\n\
+\n\
+The return value is a list with a 4-tuple (nbytes, ancdata, msg_flags,\n\
+address) for each message received, as returned by recvmsg_into().\n\
+\n\
+If recvmmsg_into() raises an exception after the system call returns,\n\
+it will first attempt to close any file descriptors received via the\n\
+SCM_RIGHTS mechanism.");
+#endif    /* HAVE_RECVMMSG */
 #endif    /* CMSG_LEN */
 
 
@@ -4716,6 +4952,322 @@ until all data is sent.  If an error occurs, it's impossible\n\
 to tell how much data has been sent.");
 
 
+#ifdef HAVE_SEND_ZEROCOPY
+/* Buffers passed to send_zerocopy() which the kernel may still read
+   from.  The kernel numbers the successful MSG_ZEROCOPY sends on a
+   socket consecutively from 0 and reports ranges of completed ids on
+   the socket error queue; the buffer exports are kept until then. */
+struct zerocopy_buf {
+    uint32_t id;
+    Py_buffer view;
+};
+
+struct _sock_zerocopy {
+    uint32_t next_id;           /* Id of the next successful send */
+    Py_ssize_t len;
+    Py_ssize_t allocated;
+    struct zerocopy_buf *bufs;  /* Pending sends, oldest first */
+};
+
+/* Make room for one more pending send, enabling SO_ZEROCOPY on the
+   first call.  The caller must hold the critical section of s. */
+static int
+sock_zerocopy_reserve(PySocketSockObject *s)
+{
+    struct _sock_zerocopy *zc = s->zerocopy;
+
+    if (zc == NULL) {
+        int on = 1;
+
+        if (setsockopt(get_sock_fd(s), SOL_SOCKET, SO_ZEROCOPY,
+                       &on, sizeof(on)) < 0) {
+            s->errorhandler();
+            return -1;
+        }
+        zc = PyMem_Calloc(1, sizeof(*zc));
+        if (zc == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        s->zerocopy = zc;
+    }
+    if (zc->len == zc->allocated) {
+        Py_ssize_t allocated = zc->allocated ? zc->allocated * 2 : 8;
+        struct zerocopy_buf *bufs = zc->bufs;
+
+        PyMem_Resize(bufs, struct zerocopy_buf, allocated);
+        if (bufs == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        zc->bufs = bufs;
+        zc->allocated = allocated;
+    }
+    return 0;
+}
+
+/* Release the buffers of the sends with ids in [lo, hi].  They are
+   released outside of the critical section, since releasing a buffer
+   can run arbitrary code. */
+static void
+sock_zerocopy_complete(PySocketSockObject *s, uint32_t lo, uint32_t hi)
+{
+    struct _sock_zerocopy *zc;
+    Py_buffer *done = NULL;
+    Py_ssize_t i, j = 0, ndone = 0;
+
+#define IN_RANGE(id) ((uint32_t)((id) - lo) <= (uint32_t)(hi - lo))
+    Py_BEGIN_CRITICAL_SECTION(s);
+    zc = s->zerocopy;
+    if (zc != NULL) {
+        for (i = 0; i < zc->len; i++) {
+            ndone += IN_RANGE(zc->bufs[i].id);
+        }
+        /* On memory error, the buffers stay pinned until the socket is
+           closed. */
+        if (ndone > 0 && (done = PyMem_New(Py_buffer, ndone)) != NULL) {
+            ndone = 0;
+            for (i = 0; i < zc->len; i++) {
+                if (IN_RANGE(zc->bufs[i].id)) {
+                    done[ndone++] = zc->bufs[i].view;
+                }
+                else {
+                    zc->bufs[j++] = zc->bufs[i];
+                }
+            }
+            zc->len = j;
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+#undef IN_RANGE
+
+    if (done != NULL) {
+        for (i = 0; i < ndone; i++) {
+            PyBuffer_Release(&done[i]);
+        }
+        PyMem_Free(done);
+    }
+}
+
+/* Release all pinned buffers, e.g. when the socket is closed. */
+static void
+sock_zerocopy_clear(PySocketSockObject *s)
+{
+    struct _sock_zerocopy *zc;
+
+    Py_BEGIN_CRITICAL_SECTION(s);
+    zc = s->zerocopy;
+    s->zerocopy = NULL;
+    Py_END_CRITICAL_SECTION();
+    if (zc != NULL) {
+        for (Py_ssize_t i = 0; i < zc->len; i++) {
+            PyBuffer_Release(&zc->bufs[i].view);
+        }
+        PyMem_Free(zc->bufs);
+        PyMem_Free(zc);
+    }
+}
+
+/* s.send_zerocopy(data [,flags]) method */
+
+static PyObject *
+sock_send_zerocopy(PyObject *self, PyObject *args)
+{
+    PySocketSockObject *s = _PySocketSockObject_CAST(self);
+
+    int flags = 0, res;
+    Py_buffer pbuf;
+    struct sock_send ctx;
+
+    if (!PyArg_ParseTuple(args, "y*|i:send_zerocopy", &pbuf, &flags))
+        return NULL;
+
+    if (!IS_SELECTABLE(s)) {
+        PyBuffer_Release(&pbuf);
+        return select_error();
+    }
+    /* The kernel numbers the sends in the order in which they complete:
+       the lock is held from the send to the assignment of its id, so that
+       the ids match.  A critical section would not be held while the
+       thread is blocked in the send. */
+    PyMutex_Lock(&s->zerocopy_send_lock);
+    Py_BEGIN_CRITICAL_SECTION(s);
+    res = sock_zerocopy_reserve(s);
+    Py_END_CRITICAL_SECTION();
+    if (res < 0) {
+        goto error;
+    }
+
+    ctx.buf = pbuf.buf;
+    ctx.len = pbuf.len;
+    /* An empty send does not take an id, nothing needs to be pinned. */
+    ctx.flags = pbuf.len > 0 ? flags | MSG_ZEROCOPY : flags;
+    if (sock_call(s, 1, sock_send_impl, &ctx) < 0) {
+        goto error;
+    }
+    if (pbuf.len == 0) {
+        PyMutex_Unlock(&s->zerocopy_send_lock);
+        PyBuffer_Release(&pbuf);
+        return PyLong_FromSsize_t(ctx.result);
+    }
+
+    /* The send took the next id: keep the buffer exported until the
+       kernel reports its completion. */
+    Py_BEGIN_CRITICAL_SECTION(s);
+    res = sock_zerocopy_reserve(s);
+    if (res == 0) {
+        struct _sock_zerocopy *zc = s->zerocopy;
+
+        zc->bufs[zc->len].id = zc->next_id++;
+        zc->bufs[zc->len].view = pbuf;
+        zc->len++;
+    }
+    else if (s->zerocopy != NULL) {
+        s->zerocopy->next_id++;
+    }
+    Py_END_CRITICAL_SECTION();
+    if (res < 0) {
+        goto error;
+    }
+    PyMutex_Unlock(&s->zerocopy_send_lock);
+    return PyLong_FromSsize_t(ctx.result);
+
+  error:
+    PyMutex_Unlock(&s->zerocopy_send_lock);
+    PyBuffer_Release(&pbuf);
+    return NULL;
+}
+
+PyDoc_STRVAR(send_zerocopy_doc,
+"send_zerocopy(data[, flags]) -> count\n\
+\n\
+Like send(data[, flags]), but use MSG_ZEROCOPY so that the kernel\n\
+reads the data directly from the buffer instead of copying it.  The\n\
+buffer is kept exported, and must not be modified, until the kernel\n\
+reports that it no longer uses it; call zerocopy_completions() to\n\
+process these reports.  Closing the socket releases the buffers of\n\
+the sends which are not complete: they must still not be modified\n\
+until the data has been sent.  Concurrent calls are serialized.");
+
+
+/* Process the completion reports queued on the error queue of s, without
+   blocking.  Return the number of completed sends, or -1 on error.
+
+   A message of the error queue cannot be peeked at, so any other message,
+   such as an error queued with IP_RECVERR, is reported by raising OSError
+   for it.  The reports read before it stay processed. */
+static Py_ssize_t
+sock_zerocopy_drain(PySocketSockObject *s)
+{
+    /* Room for a few control messages, in case other options, such as
+       SO_TIMESTAMPING, add some next to the extended error. */
+    union {
+        struct cmsghdr align;
+        char buf[4 * CMSG_SPACE(sizeof(struct sock_extended_err) +
+                                sizeof(struct sockaddr_in6))];
+    } control;
+    Py_ssize_t completed = 0;
+
+    for (;;) {
+        struct msghdr msg = {0};
+        struct cmsghdr *cmsgh;
+        struct sock_extended_err serr;
+        int found = 0;
+        ssize_t n;
+
+        msg.msg_control = control.buf;
+        msg.msg_controllen = sizeof(control.buf);
+        Py_BEGIN_ALLOW_THREADS
+        n = recvmsg(get_sock_fd(s), &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+        Py_END_ALLOW_THREADS
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            if (errno == EINTR) {
+                if (PyErr_CheckSignals()) {
+                    return -1;
+                }
+                continue;
+            }
+            s->errorhandler();
+            return -1;
+        }
+
+        for (cmsgh = CMSG_FIRSTHDR(&msg); cmsgh != NULL;
+             cmsgh = CMSG_NXTHDR(&msg, cmsgh)) {
+            if (((cmsgh->cmsg_level == SOL_IP &&
+                  cmsgh->cmsg_type == IP_RECVERR) ||
+                 (cmsgh->cmsg_level == SOL_IPV6 &&
+                  cmsgh->cmsg_type == IPV6_RECVERR)) &&
+                cmsgh->cmsg_len >= CMSG_LEN(sizeof(serr)))
+            {
+                memcpy(&serr, CMSG_DATA(cmsgh), sizeof(serr));
+                found = 1;
+                break;
+            }
+        }
+        if (!found) {
+            PyErr_SetString(PyExc_OSError,
+                            (msg.msg_flags & MSG_CTRUNC)
+                            ? "control data of the error queue truncated"
+                            : "unexpected message on the error queue");
+            return -1;
+        }
+        if (serr.ee_origin != SO_EE_ORIGIN_ZEROCOPY || serr.ee_errno != 0) {
+            errno = serr.ee_errno ? (int)serr.ee_errno : EIO;
+            s->errorhandler();
+            return -1;
+        }
+        completed += (uint32_t)(serr.ee_data - serr.ee_info) + 1;
+        sock_zerocopy_complete(s, serr.ee_info, serr.ee_data);
+    }
+    return completed;
+}
+
+/* s.zerocopy_completions() method */
+
+static PyObject *
+sock_zerocopy_completions(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    Py_ssize_t completed;
+
+    completed = sock_zerocopy_drain(_PySocketSockObject_CAST(self));
+    if (completed < 0) {
+        return NULL;
+    }
+    return PyLong_FromSsize_t(completed);
+}
+
+PyDoc_STRVAR(zerocopy_completions_doc,
+"zerocopy_completions() -> count\n\
+\n\
+Process the completion notifications of send_zerocopy() calls queued\n\
+on the socket error queue without blocking, and release the buffers\n\
+of the completed sends.  Return the number of completed sends.\n\
+Raise OSError for any other error found on the queue.");
+
+
+static Py_ssize_t
+sock_zerocopy_pending(PySocketSockObject *s)
+{
+    Py_ssize_t pending;
+
+    Py_BEGIN_CRITICAL_SECTION(s);
+    pending = s->zerocopy ? s->zerocopy->len : 0;
+    Py_END_CRITICAL_SECTION();
+    return pending;
+}
+
+static PyObject *
+sock_zerocopy_pending_getter(PyObject *self, void *Py_UNUSED(closure))
+{
+    PySocketSockObject *s = _PySocketSockObject_CAST(self);
+    return PyLong_FromSsize_t(sock_zerocopy_pending(s));
+}
+#endif    /* HAVE_SEND_ZEROCOPY */
+
+
 #ifdef HAVE_SENDTO
 struct sock_sendto {
     char *buf;
@@ -5096,6 +5648,158 @@ the message.  The return value is the number of bytes of non-ancillary\n\
 data sent.");
 #endif    /* CMSG_LEN */
 
+#ifdef HAVE_SENDMMSG
+struct sock_sendmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_sendmmsg *ctx = data;
+
+    ctx->result = sendmmsg(get_sock_fd(s), ctx->msgvec, ctx->vlen,
+                           ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/* s.sendmmsg(buffers[, flags[, addresses]]) method */
+
+static PyObject *
+sock_sendmmsg(PyObject *self, PyObject *args)
+{
+    PySocketSockObject *s = _PySocketSockObject_CAST(self);
+
+    Py_ssize_t i, nitems, nbufs = 0;
+    Py_buffer *bufs = NULL;
+    struct iovec *iovs = NULL;
+    struct mmsghdr *msgvec = NULL;
+    sock_addr_t *addrbufs = NULL;
+    int flags = 0;
+    PyObject *data_arg, *addrs_arg = NULL, *data_fast, *addrs_fast = NULL,
+        *retval = NULL;
+    struct sock_sendmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|iO:sendmmsg",
+                          &data_arg, &flags, &addrs_arg)) {
+        return NULL;
+    }
+    if (addrs_arg == Py_None) {
+        addrs_arg = NULL;
+    }
+
+    data_fast = PySequence_Fast(data_arg,
+                                "sendmmsg() argument 1 must be an iterable");
+    if (data_fast == NULL) {
+        return NULL;
+    }
+    nitems = PySequence_Fast_GET_SIZE(data_fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+    if (addrs_arg != NULL) {
+        addrs_fast = PySequence_Fast(addrs_arg,
+                                     "sendmmsg() argument 3 must be an "
+                                     "iterable");
+        if (addrs_fast == NULL) {
+            goto finally;
+        }
+        if (PySequence_Fast_GET_SIZE(addrs_fast) != nitems) {
+            PyErr_SetString(PyExc_ValueError,
+                            "sendmmsg() needs one address per buffer");
+            goto finally;
+        }
+    }
+    if (PySys_Audit("socket.sendmmsg", "OO", s,
+                    addrs_fast ? addrs_fast : Py_None) < 0) {
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    /* Set up a message header with a single iovec for each item, and
+       save the Py_buffer structs to release afterwards. */
+    if ((iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL ||
+        (msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (addrs_fast != NULL &&
+         (addrbufs = PyMem_New(sock_addr_t, nitems)) == NULL))
+    {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        struct msghdr *msg = &msgvec[nbufs].msg_hdr;
+
+        if (addrs_fast != NULL) {
+            int addrlen;
+
+            if (!getsockaddrarg(s, PySequence_Fast_GET_ITEM(addrs_fast, nbufs),
+                                &addrbufs[nbufs], &addrlen, "sendmmsg"))
+            {
+                goto finally;
+            }
+            msg->msg_name = &addrbufs[nbufs];
+            msg->msg_namelen = addrlen;
+        }
+
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(data_fast, nbufs),
+                         "y*;sendmmsg() argument 1 must be an iterable of "
+                         "bytes-like objects",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        msg->msg_iov = &iovs[nbufs];
+        msg->msg_iovlen = 1;
+    }
+
+    /* Make the system call. */
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++) {
+        PyBuffer_Release(&bufs[i]);
+    }
+    PyMem_Free(addrbufs);
+    PyMem_Free(msgvec);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    Py_XDECREF(addrs_fast);
+    Py_DECREF(data_fast);
+    return retval;
+}
+
+PyDoc_STRVAR(sendmmsg_doc,
+"sendmmsg(buffers[, flags[, addresses]]) -> count\n\
+\n\
+Send several messages to the socket with a single system call.  The\n\
+buffers argument must be an iterable of bytes-like objects; each one\n\
+is sent as a separate message.  The flags argument defaults to 0 and\n\
+has the same meaning as for send().  If addresses is supplied and not\n\
+None, it must be an iterable with a destination address for each\n\
+message.  The return value is the number of messages sent, which may\n\
+be less than the number of buffers.");
+#endif    /* HAVE_SENDMMSG */
+
 #ifdef HAVE_SOCKADDR_ALG
 static PyObject*
 sock_sendmsg_afalg(PyObject *s, PyObject *args, PyObject *kwds)
@@ -5432,6 +6136,11 @@ static PyMethodDef sock_methods[] = {
 #endif
     {"send", sock_send, METH_VARARGS, send_doc},
     {"sendall", sock_sendall, METH_VARARGS, sendall_doc},
+#ifdef HAVE_SEND_ZEROCOPY
+    {"send_zerocopy", sock_send_zerocopy, METH_VARARGS, send_zerocopy_doc},
+    {"zerocopy_completions", sock_zerocopy_completions, METH_NOARGS,
+     zerocopy_completions_doc},
+#endif
 #ifdef HAVE_SENDTO
     {"sendto", sock_sendto, METH_VARARGS, sendto_doc},
 #endif
@@ -5453,6 +6162,12 @@ static PyMethodDef sock_methods[] = {
     {"recvmsg_into", sock_recvmsg_into, METH_VARARGS, recvmsg_into_doc},
     {"sendmsg", sock_sendmsg, METH_VARARGS, sendmsg_doc},
 #endif
+#if defined(HAVE_RECVMMSG) && defined(CMSG_LEN)
+    {"recvmmsg_into", sock_recvmmsg_into, METH_VARARGS, recvmmsg_into_doc},
+#endif
+#ifdef HAVE_SENDMMSG
+    {"sendmmsg", sock_sendmmsg, METH_VARARGS, sendmmsg_doc},
+#endif
 #ifdef HAVE_SOCKADDR_ALG
     {
         "sendmsg_afalg",
@@ -5474,6 +6189,10 @@ static PyMemberDef sock_memberlist[] = {
 
 static PyGetSetDef sock_getsetlist[] = {
     {"timeout", sock_gettimeout_getter, NULL, PyDoc_STR("the socket timeout")},
+#ifdef HAVE_SEND_ZEROCOPY
+    {"zerocopy_pending", sock_zerocopy_pending_getter, NULL,
+     PyDoc_STR("the number of send_zerocopy() calls not completed yet")},
+#endif
     {NULL} /* sentinel */
 };
 
@@ -5531,6 +6250,9 @@ sock_dealloc(PyObject *s)
     }
     PyTypeObject *tp = Py_TYPE(s);
     PyObject_GC_UnTrack(s);
+#ifdef HAVE_SEND_ZEROCOPY
+    sock_zerocopy_clear(_PySocketSockObject_CAST(s));
+#endif
     tp->tp_free(s);
     Py_DECREF(tp);
 }
@@ -8180,6 +8902,9 @@ socket_exec(PyObject *m)
 #ifdef SO_INCOMING_CPU
     ADD_INT_MACRO(m, SO_INCOMING_CPU);
 #endif
+#ifdef SO_ZEROCOPY
+    ADD_INT_MACRO(m, SO_ZEROCOPY);
+#endif
 
 #ifdef  SO_KEEPALIVE
     ADD_INT_MACRO(m, SO_KEEPALIVE);
@@ -8369,6 +9094,9 @@ socket_exec(PyObject *m)
 #ifdef MSG_FASTOPEN
     ADD_INT_MACRO(m, MSG_FASTOPEN);
 #endif
+#ifdef MSG_ZEROCOPY
+    ADD_INT_MACRO(m, MSG_ZEROCOPY);
+#endif
 
     /* Protocol level and numbers, usable for [gs]etsockopt */
 #ifdef  SOL_SOCKET
@@ -9019,6 +9747,17 @@ socket_exec(PyObject *m)
     ADD_INT_MACRO(m, TCP_TX_DELAY);
 #endif
 
+    /* UDP options */
+#ifdef  UDP_CORK
+    ADD_INT_MACRO(m, UDP_CORK);
+#endif
+#ifdef  UDP_SEGMENT
+    ADD_INT_MACRO(m, UDP_SEGMENT);
+#endif
+#ifdef  UDP_GRO
+    ADD_INT_MACRO(m, UDP_GRO);
+#endif
+
     /* IPX options */
 #ifdef  IPX_TYPE
     ADD_INT_MACRO(m, IPX_TYPE);
@@ -339,6 +339,10 @@ typedef struct {
 #ifdef MS_WINDOWS
     int quickack;
 #endif
+#ifdef MSG_ZEROCOPY
+    struct _sock_zerocopy *zerocopy; /* Buffers pinned by send_zerocopy() */
+    PyMutex zerocopy_send_lock; /* Serializes send_zerocopy() calls */
+#endif
 } PySocketSockObject;
 
 /* --- C API ----------------------------------------------------*/
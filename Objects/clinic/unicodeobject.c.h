@@ -27,6 +27,60 @@ EncodingMap_size(PyObject *self, PyObject *Py_UNUSED(ignored))
     return EncodingMap_size_impl((struct encoding_map *)self);
 }
 
+PyDoc_STRVAR(translationtable_new__doc__,
+"TranslationTable(x, y=<unrepresentable>, z=<unrepresentable>, /)\n"
+"--\n"
+"\n"
+"Compiled translation table for str.translate().\n"
+"\n"
+"The arguments are the same as for str.maketrans().  The mapping is\n"
+"validated and compiled into lookup tables once, so that translating\n"
+"strings with the table is faster than with a dictionary.");
+
+static PyObject *
+translationtable_new_impl(PyTypeObject *type, PyObject *x, PyObject *y,
+                          PyObject *z);
+
+static PyObject *
+translationtable_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    PyTypeObject *base_tp = &TranslationTableType;
+    PyObject *x;
+    PyObject *y = NULL;
+    PyObject *z = NULL;
+
+    if ((type == base_tp || type->tp_init == base_tp->tp_init) &&
+        !_PyArg_NoKeywords("TranslationTable", kwargs)) {
+        goto exit;
+    }
+    if (!_PyArg_CheckPositional("TranslationTable", PyTuple_GET_SIZE(args), 1, 3)) {
+        goto exit;
+    }
+    x = PyTuple_GET_ITEM(args, 0);
+    if (PyTuple_GET_SIZE(args) < 2) {
+        goto skip_optional;
+    }
+    if (!PyUnicode_Check(PyTuple_GET_ITEM(args, 1))) {
+        _PyArg_BadArgument("TranslationTable", "argument 2", "str", PyTuple_GET_ITEM(args, 1));
+        goto exit;
+    }
+    y = PyTuple_GET_ITEM(args, 1);
+    if (PyTuple_GET_SIZE(args) < 3) {
+        goto skip_optional;
+    }
+    if (!PyUnicode_Check(PyTuple_GET_ITEM(args, 2))) {
+        _PyArg_BadArgument("TranslationTable", "argument 3", "str", PyTuple_GET_ITEM(args, 2));
+        goto exit;
+    }
+    z = PyTuple_GET_ITEM(args, 2);
+skip_optional:
+    return_value = translationtable_new_impl(type, x, y, z);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(unicode_title__doc__,
 "title($self, /)\n"
 "--\n"
@@ -1908,4 +1962,4 @@ skip_optional_pos:
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=238917fe66120bde input=a9049054013a1b77]*/
+/*[clinic end generated code: output=bf3f0e285f8a3318 input=a9049054013a1b77]*/
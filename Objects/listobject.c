@@ -2871,6 +2871,206 @@ unsafe_tuple_compare(PyObject *v, PyObject *w, MergeState *ms)
         return PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_LT);
 }
 
+/* Lists of at least this many int, float or latin string keys are sorted
+ * with a stable LSD radix sort of the keys converted to unsigned 64-bit
+ * integers, instead of by comparisons: it does a fixed number of linear
+ * passes over the data, one per byte in which the keys differ.  Below the
+ * threshold, the setup costs more than the comparisons it saves.
+ *
+ * Strings are sorted by 8 of their characters, from the first one which
+ * differs between them.  The merge sort then orders the strings which
+ * share these characters, and finds long runs everywhere else.
+ */
+#define RADIX_SORT_THRESHOLD 256
+
+/* The merge sort is kept for keys with few ascents, or few descents, in
+ * their initial order (at most one per this many keys): it takes advantage
+ * of the long runs, which the radix sort cannot do.
+ */
+#define RADIX_SORT_MIN_DISORDER 64
+
+/* Ints with up to this many digits fit in 63 bits and get a radix key */
+#define RADIX_MAX_DIGITS (63 / PyLong_SHIFT)
+
+/* Kind of the keys, for radix_sort() */
+#define RADIX_NONE  0
+#define RADIX_LONG  1   /* ints of at most RADIX_MAX_DIGITS digits */
+#define RADIX_FLOAT 2
+#define RADIX_LATIN 3   /* strings of kind PyUnicode_1BYTE_KIND */
+
+typedef struct {
+    uint64_t key;       /* the key as an unsigned integer, same order */
+    Py_ssize_t index;   /* index of the key in the slice */
+} radix_item;
+
+#define RADIX_SIGN_BIT ((uint64_t)1 << 63)
+
+/* Set *key to the radix key of v, which is of the given kind.  For strings,
+   the key is made of the 8 characters from offset.  Return -1 if there is
+   none: v is a NaN, which compares neither lower nor greater than
+   anything. */
+static inline int
+radix_key(PyObject *v, int kind, Py_ssize_t offset, uint64_t *key)
+{
+    if (kind == RADIX_LATIN) {
+        const Py_UCS1 *p = PyUnicode_1BYTE_DATA(v);
+        Py_ssize_t len = PyUnicode_GET_LENGTH(v);
+        uint64_t k = 0;
+
+        /* Big-endian, padded with zeros */
+        for (Py_ssize_t i = offset; i < offset + 8; i++) {
+            k = (k << 8) | (i < len ? p[i] : 0);
+        }
+        *key = k;
+    }
+    else if (kind == RADIX_LONG) {
+        int64_t x;
+        if (_PyLong_IsCompact((PyLongObject *)v)) {
+            x = _PyLong_CompactValue((PyLongObject *)v);
+        }
+        else {
+            const digit *d = ((PyLongObject *)v)->long_value.ob_digit;
+            Py_ssize_t i = _PyLong_DigitCount((PyLongObject *)v);
+            uint64_t u = 0;
+
+            assert(i <= RADIX_MAX_DIGITS);
+            while (--i >= 0) {
+                u = (u << PyLong_SHIFT) | d[i];
+            }
+            x = _PyLong_IsNegative((PyLongObject *)v) ? -(int64_t)u
+                                                      : (int64_t)u;
+        }
+        /* Flipping the sign bit maps signed order to unsigned order */
+        *key = (uint64_t)x ^ RADIX_SIGN_BIT;
+    }
+    else {
+        double d = PyFloat_AS_DOUBLE(v);
+        uint64_t bits;
+
+        assert(kind == RADIX_FLOAT);
+        if (isnan(d))
+            return -1;
+        if (d == 0.0)
+            d = 0.0;    /* -0.0 == 0.0: give them the same key */
+        memcpy(&bits, &d, sizeof(bits));
+        /* Negative floats sort in reverse order of their bit patterns */
+        *key = (bits & RADIX_SIGN_BIT) ? ~bits : bits | RADIX_SIGN_BIT;
+    }
+    return 0;
+}
+
+/* Sort the n keys of the slice, all of the given kind, and permute its
+ * values in lockstep.  Strings are only sorted by their radix keys.  Return
+ * 1 if sorted, or 0 if the slice was left untouched, and the merge sort
+ * should be used: the keys are nearly sorted, or there is a NaN, or memory
+ * is short.
+ */
+static int
+radix_sort(sortslice *ss, Py_ssize_t n, int kind)
+{
+    Py_ssize_t counts[8][256];
+    Py_ssize_t ascents = 0, descents = 0;
+    radix_item *items, *tmp, *src, *dst;
+    PyObject **objs;
+    uint64_t prev, key;
+    Py_ssize_t i, offset = 0;
+    int byte;
+
+    assert(n >= 2);
+    if (kind == RADIX_LATIN) {
+        /* Skip the prefix common to all strings */
+        const Py_UCS1 *first = PyUnicode_1BYTE_DATA(ss->keys[0]);
+        offset = PyUnicode_GET_LENGTH(ss->keys[0]);
+        for (i = 1; i < n && offset > 0; i++) {
+            const Py_UCS1 *p = PyUnicode_1BYTE_DATA(ss->keys[i]);
+            Py_ssize_t j = 0, m;
+
+            m = Py_MIN(offset, PyUnicode_GET_LENGTH(ss->keys[i]));
+            while (j < m && p[j] == first[j]) {
+                j++;
+            }
+            offset = j;
+        }
+    }
+
+    /* Measure the disorder before allocating anything */
+    if (radix_key(ss->keys[0], kind, offset, &prev) < 0)
+        return 0;
+    for (i = 1; i < n; i++) {
+        if (radix_key(ss->keys[i], kind, offset, &key) < 0)
+            return 0;
+        ascents += key > prev;
+        descents += key < prev;
+        prev = key;
+    }
+    if (ascents <= n / RADIX_SORT_MIN_DISORDER ||
+        descents <= n / RADIX_SORT_MIN_DISORDER)
+        return 0;
+
+    /* One allocation for the items, the scratch items, and the objects
+       in their new order */
+    if ((size_t)n > PY_SSIZE_T_MAX / (2 * sizeof(radix_item) +
+                                      sizeof(PyObject *)))
+        return 0;
+    items = PyMem_Malloc(n * (2 * sizeof(radix_item) + sizeof(PyObject *)));
+    if (items == NULL)
+        return 0;
+    tmp = items + n;
+    objs = (PyObject **)(tmp + n);
+
+    /* Extract the keys, and count the occurrences of each value of each
+       of their bytes */
+    memset(counts, 0, sizeof(counts));
+    for (i = 0; i < n; i++) {
+        (void)radix_key(ss->keys[i], kind, offset, &key);
+        items[i].key = key;
+        items[i].index = i;
+        for (byte = 0; byte < 8; byte++) {
+            counts[byte][key & 0xff]++;
+            key >>= 8;
+        }
+    }
+
+    /* Stable counting sort by each byte, least significant first.  Bytes
+       with the same value in all keys are skipped. */
+    src = items;
+    dst = tmp;
+    for (byte = 0; byte < 8; byte++) {
+        Py_ssize_t *count = counts[byte];
+        int shift = byte * 8;
+        Py_ssize_t pos = 0;
+
+        if (count[(src[0].key >> shift) & 0xff] == n)
+            continue;
+        for (i = 0; i < 256; i++) {
+            Py_ssize_t c = count[i];
+            count[i] = pos;
+            pos += c;
+        }
+        for (i = 0; i < n; i++) {
+            dst[count[(src[i].key >> shift) & 0xff]++] = src[i];
+        }
+        radix_item *t = src;
+        src = dst;
+        dst = t;
+    }
+
+    /* Permute the keys, then the values, following the sorted items */
+    for (i = 0; i < n; i++) {
+        objs[i] = ss->keys[src[i].index];
+    }
+    memcpy(ss->keys, objs, n * sizeof(PyObject *));
+    if (ss->values != NULL) {
+        for (i = 0; i < n; i++) {
+            objs[i] = ss->values[src[i].index];
+        }
+        memcpy(ss->values, objs, n * sizeof(PyObject *));
+    }
+
+    PyMem_Free(items);
+    return 1;
+}
+
 /* An adaptive, stable, natural mergesort.  See listsort.txt.
  * Returns Py_None on success, NULL on error.  Even in case of error, the
  * list will be some permutation of its input state (nothing is lost or
@@ -2909,6 +3109,7 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
     PyObject *result = NULL;            /* guilty until proved innocent */
     Py_ssize_t i;
     PyObject **keys;
+    int radix_kind = RADIX_NONE;
 
     assert(self != NULL);
     assert(PyList_Check(self));
@@ -2976,6 +3177,7 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         int keys_are_all_same_type = 1;
         int strings_are_latin = 1;
         int ints_are_bounded = 1;
+        int ints_fit_radix = 1;
 
         /* Prove that assumption by checking every key. */
         for (i=0; i < saved_ob_size; i++) {
@@ -3005,10 +3207,14 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
 
             if (keys_are_all_same_type) {
                 if (key_type == &PyLong_Type &&
-                    ints_are_bounded &&
+                    ints_fit_radix &&
                     !_PyLong_IsCompact((PyLongObject *)key)) {
 
                     ints_are_bounded = 0;
+                    if (_PyLong_DigitCount((PyLongObject *)key) >
+                        RADIX_MAX_DIGITS) {
+                        ints_fit_radix = 0;
+                    }
                 }
                 else if (key_type == &PyUnicode_Type &&
                          strings_are_latin &&
@@ -3037,6 +3243,18 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
             else {
                 ms.key_compare = safe_object_compare;
             }
+
+            if (!keys_are_in_tuples) {
+                if (key_type == &PyLong_Type && ints_fit_radix) {
+                    radix_kind = RADIX_LONG;
+                }
+                else if (key_type == &PyUnicode_Type && strings_are_latin) {
+                    radix_kind = RADIX_LATIN;
+                }
+                else if (key_type == &PyFloat_Type) {
+                    radix_kind = RADIX_FLOAT;
+                }
+            }
         }
         else {
             ms.key_compare = safe_object_compare;
@@ -3071,6 +3289,14 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
+    /* Strings sorted by their radix keys still need the merge sort, which
+       then mostly finds long runs. */
+    if (radix_kind != RADIX_NONE && nremaining >= RADIX_SORT_THRESHOLD &&
+        radix_sort(&lo, nremaining, radix_kind) && radix_kind != RADIX_LATIN)
+    {
+        goto succeed;
+    }
+
     /* March over the array once, left to right, finding natural runs,
      * and extending short natural runs to minrun elements.
      */
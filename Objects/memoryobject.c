@@ -2636,6 +2636,30 @@ memory_subscript(PyObject *_self, PyObject *key)
     return NULL;
 }
 
+/* Fast path for mv[start:stop] on a one-dimensional memoryview.  The
+   indices must already be adjusted to the bounds of the view. */
+PyObject *
+_PyMemoryView_GetSlice(PyObject *op, Py_ssize_t start, Py_ssize_t stop)
+{
+    PyMemoryViewObject *self = (PyMemoryViewObject *)op;
+    Py_buffer *view = &self->view;
+    PyMemoryViewObject *sliced;
+
+    CHECK_RELEASED(self);
+    CHECK_RESTRICTED(self);
+    assert(view->ndim == 1);
+    assert(0 <= start && start <= stop && stop <= view->shape[0]);
+
+    sliced = (PyMemoryViewObject *)mbuf_add_view(self->mbuf, view);
+    if (sliced == NULL)
+        return NULL;
+    sliced->view.buf = (char *)sliced->view.buf + view->strides[0] * start;
+    sliced->view.shape[0] = stop - start;
+    init_len(&sliced->view);
+    init_flags(sliced);
+    return (PyObject *)sliced;
+}
+
 static int
 memory_ass_sub(PyObject *_self, PyObject *key, PyObject *value)
 {
@@ -545,6 +545,28 @@ size_t _mi_prim_numa_node_count(void) {
 
 #endif
 
+#if defined(__linux__) && defined(MI_HAS_SYSCALL_H) && defined(SYS_mbind)
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node) {
+  if (numa_node < 0 || numa_node >= 8*MI_INTPTR_SIZE) return EINVAL; // at most 64 nodes
+  unsigned long numa_mask = (1UL << numa_node);
+  long err = syscall(SYS_mbind, addr, size, MPOL_PREFERRED, &numa_mask, 8*MI_INTPTR_SIZE, 0);
+  return (err == 0 ? 0 : errno);
+}
+
+#else
+
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node) {
+  MI_UNUSED(addr); MI_UNUSED(size); MI_UNUSED(numa_node);
+  return ENOSYS;
+}
+
+#endif
+
 // ----------------------------------------------------------------
 // Clock
 // ----------------------------------------------------------------
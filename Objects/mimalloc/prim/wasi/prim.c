@@ -171,6 +171,11 @@ size_t _mi_prim_numa_node_count(void) {
   return 1;
 }
 
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node) {
+  MI_UNUSED(addr); MI_UNUSED(size); MI_UNUSED(numa_node);
+  return ENOSYS;
+}
+
 
 //----------------------------------------------------------------
 // Clock
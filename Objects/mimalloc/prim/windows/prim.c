@@ -401,6 +401,13 @@ size_t _mi_prim_numa_node_count(void) {
   return ((size_t)numa_max + 1);
 }
 
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node) {
+  // Windows only supports choosing a preferred node at allocation time
+  // (`VirtualAllocExNuma`), not for an already reserved range.
+  MI_UNUSED(addr); MI_UNUSED(size); MI_UNUSED(numa_node);
+  return ERROR_NOT_SUPPORTED;
+}
+
 
 //----------------------------------------------------------------
 // Clock
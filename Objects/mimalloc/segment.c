@@ -377,6 +377,7 @@ static void mi_segments_track_size(long segment_size, mi_segments_tld_t* tld) {
 }
 
 static void mi_segment_os_free(mi_segment_t* segment, mi_segments_tld_t* tld) {
+  _PyMem_mi_segment_freed(segment);
   segment->thread_id = 0;
   _mi_segment_map_freed_at(segment);
   mi_segments_track_size(-((long)mi_segment_size(segment)),tld);
@@ -854,6 +855,7 @@ static mi_segment_t* mi_segment_os_alloc( size_t required, size_t page_alignment
 
   mi_segments_track_size((long)(segment_size), tld);
   _mi_segment_map_allocated_at(segment);
+  _PyMem_mi_segment_allocated(segment, os_tld);
   return segment;
 }
 
@@ -19,6 +19,8 @@ static bool _PyMem_mi_page_is_safe_to_free(mi_page_t *page);
 static bool _PyMem_mi_page_maybe_free(mi_page_t *page, mi_page_queue_t *pq, bool force);
 static void _PyMem_mi_page_reclaimed(mi_page_t *page);
 static void _PyMem_mi_heap_collect_qsbr(mi_heap_t *heap);
+static void _PyMem_mi_segment_allocated(mi_segment_t *segment, mi_os_tld_t *os_tld);
+static void _PyMem_mi_segment_freed(mi_segment_t *segment);
 #  include "pycore_mimalloc.h"
 #  include "mimalloc/static.c"
 #  include "mimalloc/internal.h"  // for stats
@@ -200,6 +202,58 @@ _PyMem_mi_heap_collect_qsbr(mi_heap_t *heap)
 #endif
 }
 
+#ifdef Py_GIL_DISABLED
+// PyPreConfig.numa_heaps binds the segments backing the per-thread heaps to
+// the NUMA node of the allocating thread and keeps per-node statistics.
+// It is set by _PyPreConfig_Write() before any thread state exists.
+static int
+numa_heaps_enabled(void)
+{
+    return _Py_atomic_load_int_relaxed(&_PyRuntime.obmalloc.numa_heaps);
+}
+#endif
+
+static void
+_PyMem_mi_segment_allocated(mi_segment_t *segment, mi_os_tld_t *os_tld)
+{
+#ifdef Py_GIL_DISABLED
+    segment->numa_node = -1;
+    if (!numa_heaps_enabled()) {
+        return;
+    }
+
+    int node = _mi_os_numa_node(os_tld);
+    struct _obmalloc_numa_stats *stats =
+        &_PyRuntime.obmalloc.numa_stats[node % _Py_NUMA_MAX_NODES];
+    if (_mi_os_numa_node_count() > 1) {
+        // Only affects pages that are faulted in after this call, which is
+        // all of the segment except for its (already committed) header.
+        if (_mi_prim_numa_bind(segment, segment->segment_size, node) != 0) {
+            _Py_atomic_add_ssize(&stats->bind_failures, 1);
+        }
+    }
+    segment->numa_node = node;
+    _Py_atomic_add_ssize(&stats->segments, 1);
+    _Py_atomic_add_ssize(&stats->total_segments, 1);
+    _Py_atomic_add_ssize(&stats->bytes, (Py_ssize_t)segment->segment_size);
+#endif
+}
+
+static void
+_PyMem_mi_segment_freed(mi_segment_t *segment)
+{
+#ifdef Py_GIL_DISABLED
+    int node = segment->numa_node;
+    if (node < 0) {
+        return;
+    }
+    struct _obmalloc_numa_stats *stats =
+        &_PyRuntime.obmalloc.numa_stats[node % _Py_NUMA_MAX_NODES];
+    _Py_atomic_add_ssize(&stats->segments, -1);
+    _Py_atomic_add_ssize(&stats->bytes, -(Py_ssize_t)segment->segment_size);
+#endif
+}
+
 void *
 _PyMem_MiMalloc(void *ctx, size_t size)
 {
@@ -3359,6 +3413,25 @@ py_mimalloc_print_stats(FILE *out)
     fprintf(out, "Large object max size = %zu\n",
             (size_t)MI_LARGE_OBJ_SIZE_MAX);
 
+#ifdef Py_GIL_DISABLED
+    if (_Py_atomic_load_int_relaxed(&_PyRuntime.obmalloc.numa_heaps) == 1) {
+        fprintf(out, "\nNUMA nodes = %zu\n", _mi_os_numa_node_count());
+        for (int i = 0; i < _Py_NUMA_MAX_NODES; i++) {
+            struct _obmalloc_numa_stats *stats = &_PyRuntime.obmalloc.numa_stats[i];
+            Py_ssize_t total = _Py_atomic_load_ssize_relaxed(&stats->total_segments);
+            if (total == 0) {
+                continue;
+            }
+            fprintf(out, "node %d: %zd segments (%zd bytes) in use, "
+                    "%zd allocated, %zd bind failures\n", i,
+                    _Py_atomic_load_ssize_relaxed(&stats->segments),
+                    _Py_atomic_load_ssize_relaxed(&stats->bytes),
+                    total,
+                    _Py_atomic_load_ssize_relaxed(&stats->bind_failures));
+        }
+    }
+#endif
+
     mi_heap_t *heap = mi_heap_get_default();
     struct _alloc_stats stats;
     memset(&stats, 0, sizeof(stats));
@@ -686,6 +686,114 @@ STRINGLIB(adaptive_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
 }
 
 
+#if STRINGLIB_SIZEOF_CHAR == 1
+
+/* For short needles on 1-byte characters, filter candidate positions
+   a machine word at a time: compare SIZEOF_SIZE_T haystack bytes against
+   the first character of the needle and, in the same step, the bytes
+   m-1 positions further against its last character.  Only positions
+   where both match are verified with memcmp().  This is the "generic
+   SIMD" approach of Wojciech Mula's SIMD-friendly substring search,
+   written with portable word arithmetic. */
+
+#define WORD_FIND_MAX_NEEDLE 24
+
+#if SIZEOF_SIZE_T == 8
+#  define WORD_FIND_0101 0x0101010101010101ULL
+#else
+#  define WORD_FIND_0101 0x01010101U
+#endif
+#define WORD_FIND_7F7F (WORD_FIND_0101 * 0x7F)
+#define WORD_FIND_8080 (WORD_FIND_0101 * 0x80)
+
+/* Clear the high bit of exactly the zero bytes of x (and set it for
+   all other bytes).  Unlike the classic haszero() trick, this is exact
+   for every byte, since no carry crosses byte boundaries. */
+#define WORD_FIND_NONZERO(x) \
+    ((((x) & WORD_FIND_7F7F) + WORD_FIND_7F7F) | (x))
+
+static Py_ssize_t
+STRINGLIB(word_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                     const STRINGLIB_CHAR* p, Py_ssize_t m,
+                     Py_ssize_t maxcount, int mode)
+{
+    const Py_ssize_t w = n - m;
+    const Py_ssize_t mlast = m - 1;
+    const STRINGLIB_CHAR first = p[0], last = p[mlast];
+    const size_t vfirst = WORD_FIND_0101 * (unsigned char)first;
+    const size_t vlast = WORD_FIND_0101 * (unsigned char)last;
+    Py_ssize_t i = 0, next = 0, count = 0, misses = 0, res;
+
+    for (; i + SIZEOF_SIZE_T - 1 <= w; i += SIZEOF_SIZE_T) {
+        size_t a, b;
+        memcpy(&a, s + i, SIZEOF_SIZE_T);
+        memcpy(&b, s + i + mlast, SIZEOF_SIZE_T);
+        size_t nomatch = WORD_FIND_NONZERO(a ^ vfirst)
+                         | WORD_FIND_NONZERO(b ^ vlast);
+        if ((nomatch & WORD_FIND_8080) == WORD_FIND_8080) {
+            continue;
+        }
+        /* At least one candidate in this word. */
+        for (Py_ssize_t j = Py_MAX(i, next); j < i + SIZEOF_SIZE_T; j++) {
+            if (s[j] != first || s[j + mlast] != last) {
+                continue;
+            }
+            if (memcmp(s + j + 1, p + 1, mlast) == 0) {
+                if (mode != FAST_COUNT) {
+                    return j;
+                }
+                count++;
+                if (count == maxcount) {
+                    return maxcount;
+                }
+                j = j + mlast;
+                next = j + 1;
+                continue;
+            }
+            /* As in adaptive_find(), switch to the two-way algorithm
+               if false positives are frequent, to keep the worst case
+               linear. */
+            misses++;
+            if (misses > (j >> 4) + 64 && w - j > 2000) {
+                if (mode == FAST_SEARCH) {
+                    res = STRINGLIB(_two_way_find)(s + j, n - j, p, m);
+                    return res == -1 ? -1 : res + j;
+                }
+                else {
+                    res = STRINGLIB(_two_way_count)(s + j, n - j, p, m,
+                                                    maxcount - count);
+                    return res + count;
+                }
+            }
+        }
+    }
+
+    /* Fewer than SIZEOF_SIZE_T candidate positions are left. */
+    for (i = Py_MAX(i, next); i <= w; i++) {
+        if (s[i] == first && s[i + mlast] == last
+            && memcmp(s + i + 1, p + 1, mlast) == 0)
+        {
+            if (mode != FAST_COUNT) {
+                return i;
+            }
+            count++;
+            if (count == maxcount) {
+                return maxcount;
+            }
+            i = i + mlast;
+        }
+    }
+    return mode == FAST_COUNT ? count : -1;
+}
+
+#undef WORD_FIND_0101
+#undef WORD_FIND_7F7F
+#undef WORD_FIND_8080
+#undef WORD_FIND_NONZERO
+
+#endif /* STRINGLIB_SIZEOF_CHAR == 1 */
+
+
 static Py_ssize_t
 STRINGLIB(default_rfind)(const STRINGLIB_CHAR* s, Py_ssize_t n,
                          const STRINGLIB_CHAR* p, Py_ssize_t m,
@@ -797,6 +905,11 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 
     if (mode != FAST_RSEARCH) {
+#if STRINGLIB_SIZEOF_CHAR == 1
+        if (m <= WORD_FIND_MAX_NEEDLE) {
+            return STRINGLIB(word_find)(s, n, p, m, maxcount, mode);
+        }
+#endif
         if (n < 2500 || (m < 100 && n < 30000) || m < 6) {
             return STRINGLIB(default_find)(s, n, p, m, maxcount, mode);
         }
@@ -828,3 +941,5 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 }
 
+
+#undef WORD_FIND_MAX_NEEDLE
@@ -7678,6 +7678,12 @@ _PyObject_GetState(PyObject *obj)
     return object_getstate(obj, 0);
 }
 
+PyObject *
+_PyObject_GetStateEx(PyObject *obj, int required)
+{
+    return object_getstate(obj, required);
+}
+
 /*[clinic input]
 object.__getstate__
 
@@ -554,6 +554,7 @@ static const unsigned char ascii_linebreak[] = {
 static int convert_uc(PyObject *obj, void *addr);
 
 struct encoding_map;
+static PyTypeObject TranslationTableType;
 #include "clinic/unicodeobject.c.h"
 
 _Py_error_handler
@@ -5199,16 +5200,34 @@ vector_utf8_start_chars(size_t v)
     return ((~v >> 7) | (v >> 6)) & VECTOR_0101;
 }
 
+// Set the high bit of the non-ASCII bytes not smaller than the given byte
+// value (0x81-0xFF).  The addition can't carry into the next byte since the
+// high bits are masked out first.
+static inline size_t
+vector_utf8_bytes_at_least(size_t v, unsigned char min)
+{
+    return v & ((v & ~ASCII_CHAR_MASK) + VECTOR_0101 * (0x100 - min));
+}
+
 
-// Count the number of UTF-8 code points in a given byte sequence.
+// Count the number of UTF-8 code points in a given byte sequence, and
+// compute the maximum character of the string kind needed to store them
+// (127, 0xff, 0xffff or 0x10ffff).  The maximum character is exact
+// for valid UTF-8 since continuation bytes are always below 0xC0.
 static Py_ssize_t
-utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
+utf8_count_codepoints(const unsigned char *s, const unsigned char *end,
+                      Py_UCS4 *maxchar)
 {
     Py_ssize_t len = 0;
+    size_t nonascii = 0, ucs2 = 0, ucs4 = 0;
 
     if (end - s >= SIZEOF_SIZE_T) {
         while (!_Py_IS_ALIGNED(s, ALIGNOF_SIZE_T)) {
-            len += scalar_utf8_start_char(*s++);
+            unsigned char ch = *s++;
+            len += scalar_utf8_start_char(ch);
+            nonascii |= ch;
+            ucs2 |= (ch >= 0xC4) << 7;
+            ucs4 |= (ch >= 0xF0) << 7;
         }
 
         while (s + SIZEOF_SIZE_T <= end) {
@@ -5221,6 +5240,11 @@ utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
                 size_t v = *(size_t*)s;
                 size_t vs = vector_utf8_start_chars(v);
                 vstart += vs;
+                nonascii |= v;
+                // Lead bytes 0xC4 and up start a code point above U+00FF,
+                // lead bytes 0xF0 and up one above U+FFFF.
+                ucs2 |= vector_utf8_bytes_at_least(v, 0xC4);
+                ucs4 |= vector_utf8_bytes_at_least(v, 0xF0);
                 s += SIZEOF_SIZE_T;
             }
             vstart = (vstart & VECTOR_00FF) + ((vstart >> 8) & VECTOR_00FF);
@@ -5232,7 +5256,24 @@ utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
         }
     }
     while (s < end) {
-        len += scalar_utf8_start_char(*s++);
+        unsigned char ch = *s++;
+        len += scalar_utf8_start_char(ch);
+        nonascii |= ch;
+        ucs2 |= (ch >= 0xC4) << 7;
+        ucs4 |= (ch >= 0xF0) << 7;
+    }
+
+    if (ucs4 & ASCII_CHAR_MASK) {
+        *maxchar = MAX_UNICODE;
+    }
+    else if (ucs2 & ASCII_CHAR_MASK) {
+        *maxchar = 0xffff;
+    }
+    else if (nonascii & ASCII_CHAR_MASK) {
+        *maxchar = 0xff;
+    }
+    else {
+        *maxchar = 127;
     }
     return len;
 }
@@ -5436,31 +5477,22 @@ unicode_decode_utf8(const char *s, Py_ssize_t size,
         return u;
     }
 
-    int maxchr = 127;
+    Py_UCS4 maxchr = 127;
     Py_ssize_t maxsize = size;
 
     unsigned char ch = (unsigned char)(s[pos]);
     // error handler other than strict may remove/replace the invalid byte.
     // consumed != NULL allows 1~3 bytes remainings.
     // 0x80 <= ch < 0xc2 is invalid start byte that cause UnicodeDecodeError.
-    // otherwise: check the input and decide the maxchr and maxsize to reduce
+    // otherwise: check the input and decide the maxchr and maxsize to avoid
     // reallocation and copy.
     if (error_handler == _Py_ERROR_STRICT && !consumed && ch >= 0xc2) {
-        // we only calculate the number of codepoints and don't determine the exact maxchr.
-        // This is because writing fast and portable SIMD code to find maxchr is difficult.
-        // If reallocation occurs for a larger maxchar, knowing the exact number of codepoints
-        // means that it is no longer necessary to allocate several times the required amount
-        // of memory.
-        maxsize = utf8_count_codepoints((const unsigned char *)s, (const unsigned char *)end);
-        if (ch < 0xc4) { // latin1
-            maxchr = 0xff;
-        }
-        else if (ch < 0xf0) { // ucs2
-            maxchr = 0xffff;
-        }
-        else { // ucs4
-            maxchr = 0x10ffff;
-        }
+        // A single word-at-a-time pass over the input computes both the
+        // number of code points and the kind of the result, so valid input
+        // is decoded directly into a string of the final size and kind.
+        maxsize = utf8_count_codepoints((const unsigned char *)s + pos,
+                                        (const unsigned char *)end, &maxchr);
+        maxsize += pos;
     }
     PyObject *u = PyUnicode_New(maxsize, maxchr);
     if (!u) {
@@ -5472,10 +5504,18 @@ unicode_decode_utf8(const char *s, Py_ssize_t size,
     _PyUnicodeWriter_InitWithBuffer(&writer, u);
     if (maxchr <= 255) {
         memcpy(PyUnicode_1BYTE_DATA(u), s, pos);
-        s += pos;
-        size -= pos;
-        writer.pos = pos;
     }
+    else if (maxchr <= 0xffff) {
+        _PyUnicode_CONVERT_BYTES(Py_UCS1, Py_UCS2, s, s + pos,
+                                 PyUnicode_2BYTE_DATA(u));
+    }
+    else {
+        _PyUnicode_CONVERT_BYTES(Py_UCS1, Py_UCS4, s, s + pos,
+                                 PyUnicode_4BYTE_DATA(u));
+    }
+    s += pos;
+    size -= pos;
+    writer.pos = pos;
 
     if (unicode_decode_utf8_impl(&writer, starts, s, end,
                                  error_handler, errors,
@@ -9457,6 +9497,438 @@ unicode_fast_translate(PyObject *input, PyObject *mapping,
     return res;
 }
 
+/* Compiled translation tables (string.TranslationTable) */
+
+/*[clinic input]
+class TranslationTable "struct translation_table *" "&TranslationTableType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=5b626bd3fa01589f]*/
+
+/* Table entries which don't replace a character with a single character */
+#define TRANSLATE_DELETE 0xFFFFFFFFU
+#define TRANSLATE_STRING 0x80000000U    /* | index in the strings tuple */
+
+struct translation_table {
+    PyObject_HEAD
+    PyObject *mapping;      /* dict built by str.maketrans() */
+    PyObject *strings;      /* tuple of the replacement strings which are
+                               not exactly one character long */
+    int ascii_only;         /* ASCII characters are mapped to ASCII
+                               characters or deleted */
+    Py_UCS1 ascii[128];     /* valid if ascii_only, 0x80 means deletion */
+    Py_UCS4 *blocks[256];   /* entries for U+0000-U+FFFF by blocks of 256
+                               characters, NULL if no character of the
+                               block is mapped */
+};
+
+static inline Py_UCS4
+translation_table_get(const struct translation_table *tt, Py_UCS4 ch)
+{
+    assert(ch <= 0xFFFF);
+    const Py_UCS4 *block = tt->blocks[ch >> 8];
+    return block == NULL ? ch : block[ch & 0xFF];
+}
+
+static Py_UCS4 *
+translation_table_block(struct translation_table *tt, Py_UCS4 ch)
+{
+    Py_UCS4 *block = tt->blocks[ch >> 8];
+    if (block == NULL) {
+        block = PyMem_New(Py_UCS4, 256);
+        if (block == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        Py_UCS4 first = ch & ~0xFFU;
+        for (Py_UCS4 i = 0; i < 256; i++) {
+            block[i] = first + i;
+        }
+        tt->blocks[ch >> 8] = block;
+    }
+    return block;
+}
+
+/* Fill the tables from tt->mapping. The values are checked the same way as
+   by charmaptranslate_lookup(). Characters outside the BMP are only looked
+   up in the mapping. */
+static int
+translation_table_fill(struct translation_table *tt)
+{
+    PyObject *key, *value;
+    Py_ssize_t pos = 0;
+    PyObject *strings = PyList_New(0);
+    if (strings == NULL) {
+        return -1;
+    }
+    /* Latin-1 input is always looked up in the first block */
+    if (translation_table_block(tt, 0) == NULL) {
+        goto error;
+    }
+
+    while (PyDict_Next(tt->mapping, &pos, &key, &value)) {
+        Py_UCS4 entry;
+        if (value == Py_None) {
+            entry = TRANSLATE_DELETE;
+        }
+        else if (PyLong_Check(value)) {
+            long v = PyLong_AsLong(value);
+            if (v == -1 && PyErr_Occurred()) {
+                goto error;
+            }
+            if (v < 0 || v > MAX_UNICODE) {
+                PyErr_Format(PyExc_ValueError,
+                             "character mapping must be in range(0x%x)",
+                             MAX_UNICODE+1);
+                goto error;
+            }
+            entry = (Py_UCS4)v;
+        }
+        else if (PyUnicode_Check(value)) {
+            if (PyUnicode_GET_LENGTH(value) == 1) {
+                entry = PyUnicode_READ_CHAR(value, 0);
+            }
+            else {
+                entry = TRANSLATE_STRING | (Py_UCS4)PyList_GET_SIZE(strings);
+                if (PyList_Append(strings, value) < 0) {
+                    goto error;
+                }
+            }
+        }
+        else {
+            PyErr_SetString(PyExc_TypeError,
+                            "character mapping must return integer, None or str");
+            goto error;
+        }
+
+        int overflow;
+        long ch = PyLong_AsLongAndOverflow(key, &overflow);
+        if (ch == -1 && PyErr_Occurred()) {
+            goto error;
+        }
+        if (overflow || ch < 0 || ch > 0xFFFF) {
+            continue;
+        }
+        Py_UCS4 *block = translation_table_block(tt, (Py_UCS4)ch);
+        if (block == NULL) {
+            goto error;
+        }
+        block[ch & 0xFF] = entry;
+    }
+
+    Py_SETREF(strings, PyList_AsTuple(strings));
+    if (strings == NULL) {
+        return -1;
+    }
+    tt->strings = strings;
+
+    tt->ascii_only = 1;
+    for (Py_UCS4 ch = 0; ch < 128; ch++) {
+        Py_UCS4 entry = tt->blocks[0][ch];
+        if (entry < 128) {
+            tt->ascii[ch] = (Py_UCS1)entry;
+        }
+        else if (entry == TRANSLATE_DELETE
+                 || (entry >= TRANSLATE_STRING
+                     && PyUnicode_GET_LENGTH(PyTuple_GET_ITEM(
+                            strings, entry & ~TRANSLATE_STRING)) == 0)) {
+            tt->ascii[ch] = 0x80;
+        }
+        else {
+            tt->ascii_only = 0;
+            break;
+        }
+    }
+    return 0;
+
+error:
+    Py_DECREF(strings);
+    return -1;
+}
+
+/*[clinic input]
+@classmethod
+TranslationTable.__new__ as translationtable_new
+
+    x: object
+    y: unicode = NULL
+    z: unicode = NULL
+    /
+
+Compiled translation table for str.translate().
+
+The arguments are the same as for str.maketrans().  The mapping is
+validated and compiled into lookup tables once, so that translating
+strings with the table is faster than with a dictionary.
+[clinic start generated code]*/
+
+static PyObject *
+translationtable_new_impl(PyTypeObject *type, PyObject *x, PyObject *y,
+                          PyObject *z)
+/*[clinic end generated code: output=29fb653dc4097df0 input=01673c84a7b1d0aa]*/
+{
+    PyObject *mapping = unicode_maketrans_impl(x, y, z);
+    if (mapping == NULL) {
+        return NULL;
+    }
+    struct translation_table *tt = (struct translation_table *)type->tp_alloc(type, 0);
+    if (tt == NULL) {
+        Py_DECREF(mapping);
+        return NULL;
+    }
+    tt->mapping = mapping;
+    if (translation_table_fill(tt) < 0) {
+        Py_DECREF(tt);
+        return NULL;
+    }
+    return (PyObject *)tt;
+}
+
+static void
+translationtable_dealloc(PyObject *op)
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    for (int i = 0; i < 256; i++) {
+        PyMem_Free(tt->blocks[i]);
+    }
+    Py_XDECREF(tt->mapping);
+    Py_XDECREF(tt->strings);
+    Py_TYPE(op)->tp_free(op);
+}
+
+static Py_ssize_t
+translationtable_length(PyObject *op)
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    return PyDict_GET_SIZE(tt->mapping);
+}
+
+static PyObject *
+translationtable_subscript(PyObject *op, PyObject *key)
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    return PyObject_GetItem(tt->mapping, key);
+}
+
+static int
+translationtable_contains(PyObject *op, PyObject *key)
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    return PyDict_Contains(tt->mapping, key);
+}
+
+static PyObject *
+translationtable_iter(PyObject *op)
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    return PyObject_GetIter(tt->mapping);
+}
+
+static PyObject *
+translationtable_keys(PyObject *op, PyObject *Py_UNUSED(ignored))
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    return PyDict_Keys(tt->mapping);
+}
+
+static PyObject *
+translationtable_values(PyObject *op, PyObject *Py_UNUSED(ignored))
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    return PyDict_Values(tt->mapping);
+}
+
+static PyObject *
+translationtable_items(PyObject *op, PyObject *Py_UNUSED(ignored))
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    return PyDict_Items(tt->mapping);
+}
+
+static PyObject *
+translationtable_get(PyObject *op, PyObject *const *args, Py_ssize_t nargs)
+{
+    struct translation_table *tt = (struct translation_table *)op;
+    PyObject *value;
+    if (!_PyArg_CheckPositional("get", nargs, 1, 2)) {
+        return NULL;
+    }
+    if (PyDict_GetItemRef(tt->mapping, args[0], &value) != 0) {
+        return value;
+    }
+    return Py_NewRef(nargs > 1 ? args[1] : Py_None);
+}
+
+static PyMethodDef translationtable_methods[] = {
+    {"keys", translationtable_keys, METH_NOARGS,
+     PyDoc_STR("keys($self, /)\n--\n\n"
+               "Return a list of the mapped ordinals.")},
+    {"values", translationtable_values, METH_NOARGS,
+     PyDoc_STR("values($self, /)\n--\n\n"
+               "Return a list of the replacements.")},
+    {"items", translationtable_items, METH_NOARGS,
+     PyDoc_STR("items($self, /)\n--\n\n"
+               "Return a list of (ordinal, replacement) pairs.")},
+    {"get", _PyCFunction_CAST(translationtable_get), METH_FASTCALL,
+     PyDoc_STR("get($self, key, default=None, /)\n--\n\n"
+               "Return the replacement for key if it is mapped, "
+               "else default.")},
+    {NULL, NULL}
+};
+
+static PyMappingMethods translationtable_as_mapping = {
+    .mp_length = translationtable_length,
+    .mp_subscript = translationtable_subscript,
+};
+
+static PySequenceMethods translationtable_as_sequence = {
+    .sq_contains = translationtable_contains,
+};
+
+static PyTypeObject TranslationTableType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "string.TranslationTable",
+    .tp_basicsize = sizeof(struct translation_table),
+    .tp_dealloc = translationtable_dealloc,
+    .tp_as_sequence = &translationtable_as_sequence,
+    .tp_as_mapping = &translationtable_as_mapping,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_MAPPING,
+    .tp_doc = translationtable_new__doc__,
+    .tp_iter = translationtable_iter,
+    .tp_methods = translationtable_methods,
+    .tp_new = translationtable_new,
+};
+
+/* Translate ASCII input with a table mapping ASCII to ASCII: the result
+   is at most as long as the input, deleted characters are skipped without
+   branching. */
+static PyObject *
+translation_table_translate_ascii(const struct translation_table *tt,
+                                  const Py_UCS1 *in, Py_ssize_t size)
+{
+    PyObject *result = PyUnicode_New(size, 127);
+    if (result == NULL) {
+        return NULL;
+    }
+    Py_UCS1 *start = PyUnicode_1BYTE_DATA(result);
+    Py_UCS1 *out = start;
+    const Py_UCS1 *end = in + size;
+    for (; in < end; in++) {
+        Py_UCS1 ch = tt->ascii[*in];
+        *out = ch;
+        out += (ch < 0x80);
+    }
+    if (out - start != size) {
+        PyObject *resized = resize_compact(result, out - start);
+        if (resized == NULL) {
+            Py_DECREF(result);
+            return NULL;
+        }
+        result = resized;
+    }
+    return unicode_result(result);
+}
+
+/* Compute the length and the maximum character of the translation of a
+   UCS1 or UCS2 string, return -1 on overflow. */
+static Py_ALWAYS_INLINE inline Py_ssize_t
+translation_table_measure(const struct translation_table *tt, int kind,
+                          const void *data, Py_ssize_t size,
+                          Py_UCS4 *pmaxchar)
+{
+    Py_ssize_t length = 0;
+    Py_UCS4 maxchar = 0;
+    for (Py_ssize_t i = 0; i < size; i++) {
+        Py_UCS4 entry = translation_table_get(tt, PyUnicode_READ(kind, data, i));
+        if (entry < TRANSLATE_STRING) {
+            maxchar = Py_MAX(maxchar, entry);
+            length++;
+        }
+        else if (entry != TRANSLATE_DELETE) {
+            PyObject *str = PyTuple_GET_ITEM(tt->strings,
+                                             entry & ~TRANSLATE_STRING);
+            Py_ssize_t len = PyUnicode_GET_LENGTH(str);
+            if (len > PY_SSIZE_T_MAX - length) {
+                return -1;
+            }
+            /* the replacement strings are canonical: the bound of their
+               maximum character gives the right kind of the result */
+            maxchar = Py_MAX(maxchar, PyUnicode_MAX_CHAR_VALUE(str));
+            length += len;
+        }
+    }
+    *pmaxchar = maxchar;
+    return length;
+}
+
+static Py_ALWAYS_INLINE inline void
+translation_table_write(const struct translation_table *tt, int kind,
+                        const void *data, Py_ssize_t size, PyObject *result)
+{
+    int out_kind = PyUnicode_KIND(result);
+    void *out = PyUnicode_DATA(result);
+    Py_ssize_t pos = 0;
+    for (Py_ssize_t i = 0; i < size; i++) {
+        Py_UCS4 entry = translation_table_get(tt, PyUnicode_READ(kind, data, i));
+        if (entry < TRANSLATE_STRING) {
+            PyUnicode_WRITE(out_kind, out, pos, entry);
+            pos++;
+        }
+        else if (entry != TRANSLATE_DELETE) {
+            PyObject *str = PyTuple_GET_ITEM(tt->strings,
+                                             entry & ~TRANSLATE_STRING);
+            Py_ssize_t len = PyUnicode_GET_LENGTH(str);
+            _PyUnicode_FastCopyCharacters(result, pos, str, 0, len);
+            pos += len;
+        }
+    }
+    assert(pos == PyUnicode_GET_LENGTH(result));
+}
+
+/* Translate a UCS1 or UCS2 string, deleting the characters mapped to None */
+static PyObject *
+translation_table_translate(const struct translation_table *tt,
+                            PyObject *input)
+{
+    int kind = PyUnicode_KIND(input);
+    const void *data = PyUnicode_DATA(input);
+    Py_ssize_t size = PyUnicode_GET_LENGTH(input);
+    assert(kind != PyUnicode_4BYTE_KIND);
+
+    if (PyUnicode_IS_ASCII(input) && tt->ascii_only) {
+        return translation_table_translate_ascii(tt, data, size);
+    }
+
+    Py_UCS4 maxchar;
+    Py_ssize_t length;
+    if (kind == PyUnicode_1BYTE_KIND) {
+        length = translation_table_measure(tt, PyUnicode_1BYTE_KIND,
+                                           data, size, &maxchar);
+    }
+    else {
+        length = translation_table_measure(tt, PyUnicode_2BYTE_KIND,
+                                           data, size, &maxchar);
+    }
+    if (length < 0) {
+        PyErr_SetString(PyExc_OverflowError, "translated string is too long");
+        return NULL;
+    }
+    if (length == 0) {
+        _Py_RETURN_UNICODE_EMPTY();
+    }
+
+    PyObject *result = PyUnicode_New(length, maxchar);
+    if (result == NULL) {
+        return NULL;
+    }
+    if (kind == PyUnicode_1BYTE_KIND) {
+        translation_table_write(tt, PyUnicode_1BYTE_KIND, data, size, result);
+    }
+    else {
+        translation_table_write(tt, PyUnicode_2BYTE_KIND, data, size, result);
+    }
+    return unicode_result(result);
+}
+
 static PyObject *
 _PyUnicode_TranslateCharmap(PyObject *input,
                             PyObject *mapping,
@@ -9487,14 +9959,23 @@ _PyUnicode_TranslateCharmap(PyObject *input,
     if (size == 0)
         return PyUnicode_FromObject(input);
 
+    ignore = (errors != NULL && strcmp(errors, "ignore") == 0);
+
+    if (Py_IS_TYPE(mapping, &TranslationTableType)) {
+        const struct translation_table *tt = (struct translation_table *)mapping;
+        if (ignore && kind != PyUnicode_4BYTE_KIND) {
+            return translation_table_translate(tt, input);
+        }
+        /* non-BMP characters and error handlers use the generic path */
+        mapping = tt->mapping;
+    }
+
     /* allocate enough for a simple 1:1 translation without
        replacements, if we need more, we'll resize */
     _PyUnicodeWriter_Init(&writer);
     if (_PyUnicodeWriter_Prepare(&writer, size, 127) == -1)
         goto onError;
 
-    ignore = (errors != NULL && strcmp(errors, "ignore") == 0);
-
     if (PyUnicode_IS_ASCII(input)) {
         res = unicode_fast_translate(input, mapping, &writer, ignore, &i);
         if (res < 0) {
@@ -15848,6 +16329,9 @@ _PyUnicode_InitTypes(PyInterpreterState *interp)
     if (_PyStaticType_InitBuiltin(interp, &EncodingMapType) < 0) {
         goto error;
     }
+    if (_PyStaticType_InitBuiltin(interp, &TranslationTableType) < 0) {
+        goto error;
+    }
     if (_PyStaticType_InitBuiltin(interp, &PyFieldNameIter_Type) < 0) {
         goto error;
     }
@@ -16625,6 +17109,7 @@ void
 _PyUnicode_FiniTypes(PyInterpreterState *interp)
 {
     _PyStaticType_FiniBuiltin(interp, &EncodingMapType);
+    _PyStaticType_FiniBuiltin(interp, &TranslationTableType);
     _PyStaticType_FiniBuiltin(interp, &PyFieldNameIter_Type);
     _PyStaticType_FiniBuiltin(interp, &PyFormatterIter_Type);
 }
@@ -16660,7 +17145,14 @@ static PyMethodDef _string_methods[] = {
     {NULL, NULL}
 };
 
+static int
+_string_exec(PyObject *module)
+{
+    return PyModule_AddType(module, &TranslationTableType);
+}
+
 static PyModuleDef_Slot module_slots[] = {
+    {Py_mod_exec, _string_exec},
     {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
     {Py_mod_gil, Py_MOD_GIL_NOT_USED},
     {0, NULL}
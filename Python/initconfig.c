@@ -215,6 +215,9 @@ static const PyConfigSpec PYPRECONFIG_SPEC[] = {
     SPEC(configure_locale, BOOL, READ_ONLY),
 #ifdef MS_WINDOWS
     SPEC(legacy_windows_fs_encoding, BOOL, READ_ONLY),
+#endif
+#ifdef Py_GIL_DISABLED
+    SPEC(numa_heaps, BOOL, READ_ONLY),
 #endif
     SPEC(utf8_mode, BOOL, READ_ONLY),
 
@@ -318,6 +321,12 @@ The following implementation-specific options are available:\n\
          0 disables the limit; also PYTHONINTMAXSTRDIGITS\n\
 -X no_debug_ranges: don't include extra location information in code objects;\n\
          also PYTHONNODEBUGRANGES\n\
+"
+#ifdef Py_GIL_DISABLED
+"-X numa_heaps[=0|1]: bind mimalloc segments to the NUMA node of the allocating\n\
+         thread (1) or not (0); also PYTHON_NUMA_HEAPS\n"
+#endif
+"\
 -X perf: support the Linux \"perf\" profiler; also PYTHONPERFSUPPORT=1\n\
 -X perf_jit: support the Linux \"perf\" profiler with DWARF support;\n\
          also PYTHON_PERF_JIT_SUPPORT=1\n\
@@ -413,6 +422,8 @@ static const char usage_envvars[] =
 "                  (-X frozen_modules)\n"
 #ifdef Py_GIL_DISABLED
 "PYTHON_GIL      : when set to 0, disables the GIL (-X gil)\n"
+"PYTHON_NUMA_HEAPS: when set to 1, binds mimalloc segments to the NUMA node\n"
+"                  of the allocating thread (-X numa_heaps)\n"
 #endif
 "PYTHONINSPECT   : inspect interactively after running script (-i)\n"
 "PYTHONINTMAXSTRDIGITS: limit the size of int<->str conversions;\n"
@@ -305,6 +305,9 @@ _PyPreConfig_InitCompatConfig(PyPreConfig *config)
 #ifdef MS_WINDOWS
     config->legacy_windows_fs_encoding = -1;
 #endif
+#ifdef Py_GIL_DISABLED
+    config->numa_heaps = -1;
+#endif
 }
 
 
@@ -394,6 +397,9 @@ preconfig_copy(PyPreConfig *config, const PyPreConfig *config2)
 #ifdef MS_WINDOWS
     COPY_ATTR(legacy_windows_fs_encoding);
 #endif
+#ifdef Py_GIL_DISABLED
+    COPY_ATTR(numa_heaps);
+#endif
 
 #undef COPY_ATTR
 }
@@ -435,6 +441,9 @@ _PyPreConfig_AsDict(const PyPreConfig *config)
 #endif
     SET_ITEM_INT(dev_mode);
     SET_ITEM_INT(allocator);
+#ifdef Py_GIL_DISABLED
+    SET_ITEM_INT(numa_heaps);
+#endif
     return dict;
 
 fail:
@@ -742,6 +751,57 @@ preconfig_init_allocator(PyPreConfig *config)
 }
 
 
+#ifdef Py_GIL_DISABLED
+static PyStatus
+preconfig_init_numa_heaps(PyPreConfig *config, const _PyPreCmdline *cmdline)
+{
+    if (config->numa_heaps >= 0) {
+        return _PyStatus_OK();
+    }
+
+    const wchar_t *xopt;
+    xopt = _Py_get_xoption(&cmdline->xoptions, L"numa_heaps");
+    if (xopt) {
+        wchar_t *sep = wcschr(xopt, L'=');
+        if (sep) {
+            xopt = sep + 1;
+            if (wcscmp(xopt, L"1") == 0) {
+                config->numa_heaps = 1;
+            }
+            else if (wcscmp(xopt, L"0") == 0) {
+                config->numa_heaps = 0;
+            }
+            else {
+                return _PyStatus_ERR("invalid -X numa_heaps option value");
+            }
+        }
+        else {
+            config->numa_heaps = 1;
+        }
+        return _PyStatus_OK();
+    }
+
+    const char *opt = _Py_GetEnv(config->use_environment, "PYTHON_NUMA_HEAPS");
+    if (opt) {
+        if (strcmp(opt, "1") == 0) {
+            config->numa_heaps = 1;
+        }
+        else if (strcmp(opt, "0") == 0) {
+            config->numa_heaps = 0;
+        }
+        else {
+            return _PyStatus_ERR("invalid PYTHON_NUMA_HEAPS environment "
+                                 "variable value");
+        }
+        return _PyStatus_OK();
+    }
+
+    config->numa_heaps = 0;
+    return _PyStatus_OK();
+}
+#endif
+
+
 static PyStatus
 preconfig_read(PyPreConfig *config, _PyPreCmdline *cmdline)
 {
@@ -774,6 +834,13 @@ preconfig_read(PyPreConfig *config, _PyPreCmdline *cmdline)
         return status;
     }
 
+#ifdef Py_GIL_DISABLED
+    status = preconfig_init_numa_heaps(config, cmdline);
+    if (_PyStatus_EXCEPTION(status)) {
+        return status;
+    }
+#endif
+
     assert(config->coerce_c_locale >= 0);
     assert(config->coerce_c_locale_warn >= 0);
 #ifdef MS_WINDOWS
@@ -783,6 +850,9 @@ preconfig_read(PyPreConfig *config, _PyPreCmdline *cmdline)
     assert(config->isolated >= 0);
     assert(config->use_environment >= 0);
     assert(config->dev_mode >= 0);
+#ifdef Py_GIL_DISABLED
+    assert(config->numa_heaps >= 0);
+#endif
 
     return _PyStatus_OK();
 }
@@ -956,6 +1026,9 @@ _PyPreConfig_Write(const PyPreConfig *src_config)
             return _PyStatus_ERR("Unknown PYTHONMALLOC allocator");
         }
     }
+#ifdef Py_GIL_DISABLED
+    _PyRuntime.obmalloc.numa_heaps = (config.numa_heaps == 1);
+#endif
 
     preconfig_set_global_vars(&config);
 
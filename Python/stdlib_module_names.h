@@ -97,6 +97,7 @@ static const char* _Py_stdlib_module_names[] = {
 "_tracemalloc",
 "_types",
 "_typing",
+"_uring",
 "_uuid",
 "_warnings",
 "_weakref",
@@ -0,0 +1,169 @@
+"""Show how fast the pickler is on memo-heavy workloads.
+
+Every container, string and bytes object pickled is recorded in the
+pickler's memo table, and every object seen again is looked up in it, so
+these workloads spend much of their time in it.
+
+To run:
+
+    ./python Tools/scripts/pickle_memo_benchmark.py [--size N] [--repeat N]
+        [--baseline PYTHON] [workload ...]
+
+Each workload is pickled with the default settings and again with
+memoize_strings=False, using the highest protocol.  With --baseline, the
+workloads are also pickled by another interpreter, for example a build
+without the current memo table, and both are reported side by side.
+"""
+
+import argparse
+import json
+import pickle
+import subprocess
+import sys
+import time
+
+
+def many_strings(size):
+    return [str(i) * 3 for i in range(size)]
+
+
+def many_bytes(size):
+    return [str(i).encode() * 3 for i in range(size)]
+
+
+def string_dicts(size):
+    return [{'id': str(i), 'name': f'user{i}', 'email': f'user{i}@example.org'}
+            for i in range(size // 3)]
+
+
+def nested_lists(size):
+    return [[i, [str(i)], (i, str(i))] for i in range(size // 3)]
+
+
+def shared_strings(size):
+    words = [f'word{i}' for i in range(100)]
+    return [words[i % len(words)] for i in range(size)]
+
+
+def shared_objects(size):
+    # Each object is referenced 4 times, far apart: one memo insertion and
+    # three lookups per object, with a memo table much larger than the
+    # CPU caches.
+    objs = [[i] for i in range(size // 4)]
+    step = 7919
+    return [objs[i * step % len(objs)] for i in range(len(objs))] * 4
+
+
+def object_graph(size):
+    # Nodes referencing other nodes, as in an ORM session or a parse tree.
+    # They only reference nodes pickled before them, which are found in the
+    # memo, so that the pickler does not recurse deeply.
+    nodes = [{'id': i} for i in range(size // 4)]
+    for i, node in enumerate(nodes):
+        node['parent'] = nodes[i // 2]
+        node['prev'] = nodes[i - 1] if i else None
+    return nodes
+
+
+WORKLOADS = {
+    'many_strings': many_strings,
+    'many_bytes': many_bytes,
+    'string_dicts': string_dicts,
+    'nested_lists': nested_lists,
+    'shared_strings': shared_strings,
+    'shared_objects': shared_objects,
+    'object_graph': object_graph,
+}
+
+
+def bench(obj, repeat, **kwargs):
+    best = float('inf')
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        data = pickle.dumps(obj, pickle.HIGHEST_PROTOCOL, **kwargs)
+        best = min(best, time.perf_counter() - t0)
+    return best, len(data)
+
+
+def run(names, size, repeat):
+    """Return {name: (memo time, memo size, no memo time, no memo size)}.
+
+    The memoize_strings=False entries are None if the pickler does not
+    support it."""
+    results = {}
+    for name in names:
+        obj = WORKLOADS[name](size)
+        memo_time, memo_size = bench(obj, repeat)
+        try:
+            plain_time, plain_size = bench(obj, repeat,
+                                           memoize_strings=False)
+        except TypeError:
+            plain_time = plain_size = None
+        results[name] = (memo_time, memo_size, plain_time, plain_size)
+    return results
+
+
+def run_baseline(python, names, size, repeat):
+    cmd = [python, __file__, '--json', '--size', str(size),
+           '--repeat', str(repeat), *names]
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, check=True)
+    lines = proc.stdout.splitlines()
+    return lines[0].decode(), json.loads(lines[1])
+
+
+def format_time(t):
+    return '-' if t is None else f'{t * 1e3:.1f}ms'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--size', type=int, default=1_000_000,
+                        help='number of objects per workload')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='number of timed runs; the best is reported')
+    parser.add_argument('--baseline', metavar='PYTHON',
+                        help='also run the workloads with this interpreter')
+    parser.add_argument('--json', action='store_true',
+                        help=argparse.SUPPRESS)
+    parser.add_argument('workloads', nargs='*', default=list(WORKLOADS),
+                        metavar='workload',
+                        help='workloads to run (default: all): '
+                             + ', '.join(WORKLOADS))
+    args = parser.parse_args()
+    for name in args.workloads:
+        if name not in WORKLOADS:
+            parser.error(f'unknown workload {name!r} '
+                         f'(choose from {", ".join(WORKLOADS)})')
+
+    if args.json:
+        print(sys.version.replace('\n', ' '))
+        print(json.dumps(run(args.workloads, args.size, args.repeat)))
+        return
+
+    print(sys.version)
+    baseline = None
+    if args.baseline:
+        version, baseline = run_baseline(args.baseline, args.workloads,
+                                         args.size, args.repeat)
+        print(f'baseline: {version}')
+        print(f'{"workload":<16} {"baseline":>10} {"memo":>10} {"speedup":>8} '
+              f'{"no memo":>10} {"size ratio":>11}')
+    else:
+        print(f'{"workload":<16} {"memo":>10} {"no memo":>10} '
+              f'{"size ratio":>11}')
+    results = run(args.workloads, args.size, args.repeat)
+    for name, (memo_time, memo_size, plain_time, plain_size) in results.items():
+        ratio = '-' if plain_size is None else f'{plain_size / memo_size:.2f}x'
+        if baseline is None:
+            print(f'{name:<16} {format_time(memo_time):>10} '
+                  f'{format_time(plain_time):>10} {ratio:>11}')
+        else:
+            base_time = baseline[name][0]
+            print(f'{name:<16} {format_time(base_time):>10} '
+                  f'{format_time(memo_time):>10} '
+                  f'{base_time / memo_time:7.2f}x '
+                  f'{format_time(plain_time):>10} {ratio:>11}')
+
+
+if __name__ == '__main__':
+    main()